@@ -4,6 +4,8 @@
 #include <SDL.h>
 #include <random>
 #include "Point.h"
+#include "../Graphics/RenderSnapshot.h"
+#include "../Utils/SimulationClock.h"
 
 constexpr float SCREEN_WIDTH = 800;
 constexpr float SCREEN_HEIGHT = 600;
@@ -24,6 +26,7 @@ private:
 
     float x = 0; /**< The x-coordinate of the camera's position */
     float y = 0; /**< The y-coordinate of the camera's position */
+    Point previousPosition = {x, y}; /**< The position of the camera at the previous simulation tick, used to interpolate the rendering. */
     float w = SCREEN_WIDTH; /**< The width of the camera */
     float h = SCREEN_HEIGHT; /**< The height of the camera */
 
@@ -41,7 +44,7 @@ private:
     float shakeX = 0; /**< The x-coordinate of the camera's shake */
     float shakeY = 0; /**< The y-coordinate of the camera's shake */
     int shakeTime = 0; /**< The time to shake the camera, positives is the time to shake, 0 is not shaking, negatives shakes indefinitely */
-    Uint32 lastShakeUpdate = SDL_GetTicks(); /**< The time of the last shake update */
+    Uint32 lastShakeUpdate = SimulationClock::getTicks(); /**< The time of the last shake update */
     float shakeAmplitude = 2; /**< The amplitude of the camera shake */
 
 
@@ -65,6 +68,12 @@ public:
      */
     [[nodiscard]] float getY() const;
 
+    /**
+     * @brief Return the previousPosition attribute.
+     * @return The position of the camera at the previous simulation tick.
+     */
+    [[nodiscard]] Point getPreviousPosition() const;
+
     /**
      * @brief Return the width attribute.
      * @return The value of the w attribute.
@@ -79,9 +88,10 @@ public:
 
     /**
      * @brief Return the rendering point of the camera.
+     * @param alpha The fraction of the simulation step elapsed since the last tick, the camera is drawn between its last two positions.
      * @return A Point representing the rendering point.
      */
-    [[nodiscard]] Point getRenderingPoint() const;
+    [[nodiscard]] Point getRenderingPoint(float alpha = 1.0f) const;
 
     /**
      * @brief Return the bounding box of the camera.
@@ -126,6 +136,11 @@ public:
 
     /* METHODS */
 
+    /**
+     * @brief Save the current position as the position of the previous simulation tick.
+     */
+    void savePreviousPosition();
+
     /**
      * @brief Initialize the camera position according to players positions.
      * @param camera_point A point representing the camera point position.
@@ -140,11 +155,11 @@ public:
     void applyMovement(Point camera_point, double delta_time);
 
     /**
-     * @brief Renders the collisions by drawing obstacles.
-     * @param renderer Represents the renderer of the game.
+     * @brief Records the point followed by the camera.
+     * @param snapshot The snapshot recording the drawing of the tick.
      * @param camera_point Represents the camera point.
      */
-    void renderCameraPoint(SDL_Renderer *renderer, Point camera_point) const;
+    void renderCameraPoint(RenderSnapshot &snapshot, Point camera_point) const;
 
     /**
      * @brief Renders the collisions by drawing obstacles.
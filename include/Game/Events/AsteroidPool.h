@@ -0,0 +1,139 @@
+#ifndef PLAY_TOGETHER_ASTEROIDPOOL_H
+#define PLAY_TOGETHER_ASTEROIDPOOL_H
+
+#include <SDL_image.h>
+#include <cmath>
+#include <vector>
+#include "Asteroid.h"
+#include "../../Graphics/Sprite.h"
+#include "../../Graphics/RenderSnapshot.h"
+#include "../../Physics/Quad.h"
+#include "../../Sounds/SoundEffect.h"
+
+
+/**
+ * @file AsteroidPool.h
+ * @brief Defines the AsteroidPool class storing the simulated asteroids.
+ */
+
+/**
+ * @class AsteroidPool
+ * @brief Stores the asteroids of a level as a structure of arrays, so a tick only walks the columns it needs.
+ *
+ * The velocity is computed once from the angle when the asteroid is added. An asteroid is removed by moving the last
+ * one in its place (swap and pop), like the tree indexing the asteroids, so the indices of both always match.
+ */
+class AsteroidPool {
+private:
+    /* ATTRIBUTES */
+
+    std::vector<float> x; /**< The x-coordinate of each asteroid. */
+    std::vector<float> y; /**< The y-coordinate of each asteroid. */
+    std::vector<float> previousX; /**< The x-coordinate of each asteroid at the previous simulation tick, used to interpolate the rendering. */
+    std::vector<float> previousY; /**< The y-coordinate of each asteroid at the previous simulation tick, used to interpolate the rendering. */
+    std::vector<float> w; /**< The width of each asteroid. */
+    std::vector<float> h; /**< The height of each asteroid. */
+    std::vector<float> velocityX; /**< The horizontal velocity of each asteroid, in pixels per second. */
+    std::vector<float> velocityY; /**< The vertical velocity of each asteroid, in pixels per second. */
+    std::vector<float> angle; /**< The angle of each asteroid, in degrees. */
+
+    Sprite sprite = Sprite(spriteTexturePtr, AsteroidPool::idle, 64, 64); /**< The sprite shared by the asteroids, they all play the same animation. */
+    SoundEffect explosionSound = SoundEffect("Events/explosion.wav"); /**< The sound effect associated to asteroid's explosion. */
+
+    // LOADED TEXTURE
+    static SDL_Texture *spriteTexturePtr; /**< The texture of asteroid. */
+
+    // SPRITE ANIMATIONS
+    static constexpr Animation idle = {0, 8, 100, false}; /**< Idle animation */
+
+
+public:
+    /* ACCESSORS */
+
+    /**
+     * @brief Return the number of asteroids.
+     * @return The number of asteroids in the pool.
+     */
+    [[nodiscard]] size_t size() const;
+
+    /**
+     * @brief Return the y-coordinate of an asteroid.
+     * @param index The index of the asteroid.
+     * @return The y-coordinate of the asteroid.
+     */
+    [[nodiscard]] float getY(size_t index) const;
+
+    /**
+     * @brief Return the height of an asteroid.
+     * @param index The index of the asteroid.
+     * @return The height of the asteroid.
+     */
+    [[nodiscard]] float getH(size_t index) const;
+
+    /**
+     * @brief Get the bounding box of an asteroid.
+     * @param index The index of the asteroid.
+     * @return SDL_FRect representing the bounding box.
+     */
+    [[nodiscard]] SDL_FRect getBoundingBox(size_t index) const;
+
+    /**
+     * @brief Get the vertices of the bounding box of an asteroid.
+     * @param index The index of the asteroid.
+     * @return A Quad representing the vertices.
+     */
+    [[nodiscard]] Quad getVertices(size_t index) const;
+
+
+    /* MODIFIERS */
+
+    /**
+     * @brief Add an asteroid at the end of the pool.
+     * @param asteroid The description of the asteroid.
+     */
+    void push(const Asteroid &asteroid);
+
+    /**
+     * @brief Remove an asteroid, the last asteroid takes its index.
+     * @param index The index of the asteroid to remove.
+     */
+    void swapRemove(size_t index);
+
+
+    /* METHODS */
+
+    /**
+     * @brief Load all asteroid textures.
+     * @param renderer The renderer of the game.
+     * @return Returns true if all textures were loaded correctly, false otherwise.
+     */
+    static bool loadTextures(SDL_Renderer &renderer);
+
+    /**
+     * @brief Save the positions of the previous tick and move every asteroid along its velocity.
+     * @param delta_time The duration of the tick, in seconds.
+     */
+    void applyMovement(double delta_time);
+
+    /**
+     * @brief Triggers the explosion effect of an asteroid (before it is removed).
+     * @param index The index of the asteroid.
+     */
+    void explode(size_t index);
+
+    /**
+     * @brief Records the asteroids by their sprites, with their motion during the tick.
+     * @param snapshot The snapshot recording the drawing of the tick.
+     */
+    void render(RenderSnapshot &snapshot);
+
+    /**
+     * @brief Records the asteroids by their collision boxes.
+     * @param snapshot The snapshot recording the drawing of the tick.
+     */
+    void renderDebug(RenderSnapshot &snapshot) const;
+
+};
+
+
+#endif //PLAY_TOGETHER_ASTEROIDPOOL_H
@@ -0,0 +1,77 @@
+#ifndef PLAY_TOGETHER_SPAWNSAMPLER_H
+#define PLAY_TOGETHER_SPAWNSAMPLER_H
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <random>
+
+
+/**
+ * @file SpawnSampler.h
+ * @brief Defines the SpawnSampler class drawing spawn values without repeating the recent ones.
+ */
+
+/**
+ * @class SpawnSampler
+ * @brief Draws values from a table generated from a seed, a drawn value cools down during the next draws.
+ *
+ * The available values are kept in a free list and the cooling ones in a ring buffer, so a draw is O(1). The random
+ * stream is seeded once per session and the draws do not use the standard distributions (their results depend on the
+ * standard library), so the same seed gives the same values on every platform.
+ */
+class SpawnSampler {
+private:
+    /* ATTRIBUTES */
+
+    std::vector<float> values; /**< The table of values. */
+    std::vector<uint32_t> available; /**< Indices of the values that can be drawn (free list). */
+    std::vector<uint32_t> cooling; /**< Indices of the last drawn values, from the oldest (ring buffer). */
+    size_t coolingStart = 0; /**< Position of the oldest cooling index in the ring buffer. */
+    size_t coolingCount = 0; /**< Number of cooling indices in the ring buffer. */
+    std::mt19937 generator; /**< The random stream of the session. */
+
+
+public:
+    /* ACCESSORS */
+
+    /**
+     * @brief Return the number of values in the table.
+     * @return The number of values.
+     */
+    [[nodiscard]] size_t size() const;
+
+
+    /* METHODS */
+
+    /**
+     * @brief Generate the table and restart the random stream.
+     * @param count The number of values to generate.
+     * @param min The lower bound of the values.
+     * @param max The upper bound of the values.
+     * @param cooldown The number of draws during which a drawn value cannot be drawn again (lower than count).
+     * @param seed The seed of the session.
+     */
+    void generate(int count, float min, float max, size_t cooldown, size_t seed);
+
+    /**
+     * @brief Draw a value, it cools down during the next draws.
+     * @return The value drawn, 0 if the table is empty.
+     */
+    float sample();
+
+
+private:
+    /* SUB METHODS */
+
+    /**
+     * @brief Draw the next number of the stream in [0, bound).
+     * @param bound The upper bound of the number (not zero).
+     * @return The number drawn.
+     */
+    uint32_t next(uint32_t bound);
+
+};
+
+
+#endif //PLAY_TOGETHER_SPAWNSAMPLER_H
@@ -10,8 +10,12 @@
 #include <algorithm>
 #include <SDL_ttf.h>
 #include <queue>
+#include <thread>
+#include <atomic>
 #include "../Utils/Mediator.h"
 #include "../Utils/MessageQueue.h"
+#include "../Utils/SimulationClock.h"
+#include "../Utils/JobSystem.h"
 #include "Level.h"
 #include "GameManagers/PlayerCollisionManager.h"
 #include "GameManagers/InputManager.h"
@@ -46,38 +50,55 @@ class Game {
 private:
     /* ATTRIBUTES */
     static constexpr float effectiveFrameRateUpdateIntervalSeconds = 1.0f;
-    static constexpr float networkInputSendIntervalSeconds = 1.0f / 60.0f;
     static constexpr float networkSyncCorrectionIntervalSeconds = 0.50f;
+    static constexpr int maxSimulationStepsPerFrame = 8; /**< The maximum number of ticks simulated before a frame, the late time is dropped beyond it. */
+    static constexpr size_t parallelPlayersGrain = 16; /**< The minimum number of players handled by a job of the parallel player loops. */
 
-    SDL_Window *window; /**< SDL window for rendering. */
-    SDL_Renderer *renderer; /**< SDL renderer for rendering graphics. */
+    SDL_Window *window; /**< SDL window for rendering, nullptr for a headless game. */
+    SDL_Renderer *renderer; /**< SDL renderer for rendering graphics, nullptr for a headless game. */
 
+    JobSystem jobSystem; /**< Worker threads shared by the parallel stages of the game (created before the managers using it). */
+    TaskGraph updateGraph; /**< The stages of a tick after the input, the independent ones run concurrently. */
+    double updateStepSeconds = 0; /**< The duration of the tick run by the update graph in seconds. */
+    bool trapsShake = false; /**< True if a trap shakes the camera during the tick run by the update graph. */
     std::unique_ptr<InputManager> inputManager; /**< Input manager for handling input events. */
     std::unique_ptr<TextureManager> textureManager; /**< Texture manager for handling texture loading. */
-    std::unique_ptr<RenderManager> renderManager; /**< Renderer object for rendering the game. */
+    std::unique_ptr<RenderManager> renderManager; /**< Renderer object for rendering the game, not created for a headless game. */
     std::unique_ptr<SaveManager> saveManager; /**< Save manager for saving and loading the game state. */
     std::unique_ptr<BroadPhaseManager> broadPhaseManager; /**< Broad phase manager for handling the collision broad phase in the game. */
     std::unique_ptr<PlayerManager> playerManager; /**< Player manager for handling the players in the game. */
     std::unique_ptr<PlayerCollisionManager> playerCollisionManager; /**< Player collision manager for handling the player collisions in the game. */
     std::unique_ptr<EventCollisionManager> eventCollisionManager; /**< Event collision manager for handling the event collisions in the game. */
 
-    int frameRate = 60; /**< The refresh rate of the game. */
+    int frameRate = 60; /**< The refresh rate of the game (the rate of the network updates for a headless game). */
     int effectiveFrameFps = frameRate; /**< The effective fps. */
     Uint32 lastPlaytimeUpdate = SDL_GetTicks(); /**< The last time that playtime was updated. */
     Uint32 playtime = 0; /**< The time in milliseconds elapsed since the game started. */
 
-    GameState gameState = GameState::STOPPED; /**< The current game state. */
+    std::atomic<GameState> gameState = GameState::STOPPED; /**< The current game state, read by the render and the simulation threads. */
+    std::atomic<bool> running = false; /**< True while run() is running, the game is reset once the simulation is over. */
+    std::atomic<bool> saveRequested = false; /**< True if the simulation thread must save the game after its next ticks. */
     bool *quitFlagPtr = nullptr; /**< Reference to the quit flag. */
     MessageQueue *messageQueue; /**< The message queue for communication between threads. */
     Camera camera; /**< The camera object */
     Level level; /**< The level object */
     Music music; /**< Represents the music that is currently played in the game. */
-    size_t seed;
+    size_t seed; /**< The seed of the session, it drives the asteroid spawns of the host and of the clients. */
+
+    std::jthread simulationThread; /**< The thread simulating the ticks while the calling thread renders (declared last, so it stops first). */
 
 
 public:
     /* CONSTRUCTORS */
 
+    /**
+     * @brief Constructor of the Game class.
+     * @param window The window of the game, nullptr for a headless game.
+     * @param renderer The renderer of the game, nullptr for a headless game (no rendering, no local player).
+     * @param frameRate The refresh rate of the game.
+     * @param quitFlag The flag set to quit the application.
+     * @param messageQueue The message queue for communication between threads.
+     */
     Game(SDL_Window *window, SDL_Renderer *renderer, int frameRate, bool *quitFlag, MessageQueue *messageQueue);
 
 
@@ -89,6 +110,18 @@ public:
      */
     [[nodiscard]] GameState getGameState() const;
 
+    /**
+     * @brief Check if the game runs without window nor renderer (dedicated server).
+     * @return True if the game is headless, false otherwise.
+     */
+    [[nodiscard]] bool isHeadless() const;
+
+    /**
+     * @brief Returns the renderer of the game.
+     * @return The SDL renderer, nullptr for a headless game.
+     */
+    [[nodiscard]] SDL_Renderer *getRenderer() const;
+
     /**
      * @brief Returns the input manager of the game.
      * @return A pointer of InputManager object representing the input manager of the game.
@@ -125,6 +158,12 @@ public:
      */
     [[nodiscard]] BroadPhaseManager &getBroadPhaseManager();
 
+    /**
+     * @brief Returns the job system of the game.
+     * @return A reference to the JobSystem shared by the parallel stages of the game.
+     */
+    [[nodiscard]] JobSystem &getJobSystem();
+
     /**
      * @brief Returns the camera of the game.
      * @return A pointer of Camera object representing the camera of the game.
@@ -137,6 +176,12 @@ public:
      */
     [[nodiscard]] Level* getLevel();
 
+    /**
+     * @brief Get the seed of the session.
+     * @return The seed driving the asteroid spawns.
+     */
+    [[nodiscard]] size_t getSeed() const;
+
     /**
      * @brief Get the frame rate of the game.
      * @return The frame rate of the game.
@@ -179,7 +224,7 @@ public:
     /* PUBLIC METHODS */
 
     /**
-     * @brief Initializes the game by loading the level and the character.
+     * @brief Initializes the game by loading the level and the character (no character for a headless game).
      * @param slot The save slot to use when loading the game. (0 by default)
      */
     void initializeHostedGame(int slot = 0);
@@ -193,28 +238,45 @@ public:
      * @param movingPlatforms1D The list of 1D moving platforms to load.
      * @param movingPlatforms2D The list of 2D moving platforms to load.
      * @param crushers The list of crushers to load.
+     * @param session_seed The seed of the session of the server, so the asteroid spawns can be reproduced.
      */
     void loadLevel(const std::string &map_name, short last_checkpoint, const nlohmann::json::array_t &players, const nlohmann::json::object_t &cameraData,
-                   const nlohmann::json::array_t &movingPlatforms1D, const nlohmann::json::array_t &movingPlatforms2D, const nlohmann::json::array_t &crushers);
+                   const nlohmann::json::array_t &movingPlatforms1D, const nlohmann::json::array_t &movingPlatforms2D, const nlohmann::json::array_t &crushers,
+                   size_t session_seed);
 
     /**
-     * @brief Updates the game logic.
-     * @param delta_time The time elapsed since the last frame in seconds.
+     * @brief Advances the game logic by one simulation tick.
+     * @param delta_time The duration of the tick in seconds (SimulationClock::getStepSeconds() in the game loop).
      */
     void update(double delta_time);
 
     /**
-     * @brief Runs the game loop.
+     * @brief Runs the game loop until the game stops.
+     *
+     * The simulation advances by fixed ticks on its own thread, while the calling thread (owning the renderer and the
+     * window) polls the events and draws the last tick recorded at the refresh rate. A headless game simulates on the
+     * calling thread.
      */
     void run();
 
+    /**
+     * @brief Asks the render thread to replace the level, it loads the textures while the simulation is stopped.
+     * @param map_name The name of the new map.
+     */
+    void requestLevel(const std::string &map_name);
+
+    /**
+     * @brief Saves the game, after the current ticks if the simulation thread is running.
+     */
+    void save();
+
     /**
     * @brief Toggles the pause state of the game.
     */
     void togglePause();
 
     /**
-     * @brief Stops the game loop and exits the game.
+     * @brief Stops the game loop, the game is reset once the simulation is over.
      */
     void stop();
 
@@ -228,6 +290,49 @@ private:
 
     /* PRIVATE METHODS */
 
+    /**
+     * @brief Builds the stages of a tick and their dependencies, run by update() every tick.
+     */
+    void buildUpdateGraph();
+
+    /**
+     * @brief Simulation loop, it runs the ticks at the fixed step and sends the network updates at the refresh rate.
+     * @param stopToken Token requested to stop the simulation thread.
+     */
+    void simulate(const std::stop_token &stopToken);
+
+    /**
+     * @brief Starts the simulation thread, the render thread draws nothing until its first tick.
+     */
+    void startSimulation();
+
+    /**
+     * @brief Stops the simulation thread and waits for the end of its ticks.
+     */
+    void stopSimulation();
+
+    /**
+     * @brief Processes the messages of the other threads, called while the simulation is stopped.
+     */
+    void processMessages();
+
+    /**
+     * @brief Removes the players and resets the save slot and the music once the game is stopped.
+     */
+    void reset();
+
+#ifdef DEVELOPMENT_MODE
+    /**
+     * @brief Prints the average duration of every stage of a tick since the last call, then resets it.
+     */
+    void printUpdateTimings();
+#endif
+
+    /**
+     * @brief Saves the position of the players and the camera before a tick, the rendering interpolates from it.
+     */
+    void savePreviousPositions();
+
     /**
      * @brief Applies the movement to all players in the game.
      * @param delta_time The time elapsed since the last frame in seconds.
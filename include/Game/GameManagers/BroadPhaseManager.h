@@ -1,48 +1,111 @@
 #ifndef PLAY_TOGETHER_BROADPHASEMANAGER_H
 #define PLAY_TOGETHER_BROADPHASEMANAGER_H
 
+#include <span>
+#include <atomic>
 #include "../Game.h"
+#include "../../Physics/AABBBatch.h"
+#include "../../Physics/Quad.h"
 
 /**
  * @file BroadPhaseManager.h
  * @brief Defines the BroadPhaseManager class responsible for the collision broad phase.
  */
 
+constexpr float BROAD_PHASE_HYSTERESIS = 500.0f; /**< Margin added around the static broad phase area, the static sets are rebuilt once the camera leaves it. */
+constexpr float PLAYER_NEIGHBOURHOOD_MARGIN = 16.0f; /**< Margin added around the swept box of a player, it covers the colliders and the corrections of the narrow phase. */
+
+
+/**
+ * @struct Neighbourhood
+ * @brief Handles of the objects near one player, gathered from the swept bounding box of the player.
+ */
+struct Neighbourhood {
+    std::vector<Handle<AABB>> saveZones; /**< Handles of the save zones near the player. */
+    std::vector<Handle<AABB>> rescueZones; /**< Handles of the rescue zones near the player. */
+    std::vector<Handle<AABB>> toggleGravityZones; /**< Handles of the toggle gravity zones near the player. */
+    std::vector<Handle<AABB>> increaseFallSpeedZones; /**< Handles of the increase fall speed zones near the player. */
+    std::vector<Handle<Polygon>> deathZones; /**< Handles of the death zones near the player. */
+    std::vector<Handle<Polygon>> obstacles; /**< Handles of the obstacles near the player. */
+    std::vector<Handle<TreadmillLever>> treadmillLevers; /**< Handles of the treadmill levers near the player. */
+    std::vector<Handle<PlatformLever>> platformLevers; /**< Handles of the platform levers near the player. */
+    std::vector<Handle<CrusherLever>> crusherLevers; /**< Handles of the crusher levers near the player. */
+    std::vector<Handle<MovingPlatform1D>> movingPlatforms1D; /**< Handles of the 1D platforms near the player. */
+    std::vector<Handle<MovingPlatform2D>> movingPlatforms2D; /**< Handles of the 2D platforms near the player. */
+    std::vector<Handle<SwitchingPlatform>> switchingPlatforms; /**< Handles of the switching platforms near the player. */
+    std::vector<Handle<WeightPlatform>> weightPlatforms; /**< Handles of the weight platforms near the player. */
+    std::vector<Handle<Treadmill>> treadmills; /**< Handles of the treadmills near the player. */
+    std::vector<Handle<Crusher>> crushers; /**< Handles of the crushers near the player. */
+    std::vector<Handle<SizePowerUp>> sizePowerUp; /**< Handles of the size power-up near the player. */
+    std::vector<Handle<SpeedPowerUp>> speedPowerUp; /**< Handles of the speed power-up near the player. */
+    std::vector<Handle<Coin>> coins; /**< Handles of the coins near the player. */
+    std::vector<Handle<Item>> items; /**< Handles of the items near the player. */
+};
+
 
 class BroadPhaseManager {
 private:
+    /* TYPES */
+
+    /**
+     * @struct StaticBounds
+     * @brief The bounds of a collection of objects which do not move, kept until the collection changes.
+     */
+    struct StaticBounds {
+        AABBBatch batch; /**< The bounds of every object of the collection, indexed like the collection. */
+        uint32_t generation = 0; /**< The generation of the collection when the bounds were gathered (0 before the first sweep). */
+    };
+
+
     /* ATTRIBUTES */
 
     Game *gamePtr; /**< A pointer to the game object. */
 
     // ZONES
-    std::vector<AABB> saveZones; /**< Collection of polygons representing save zones. */
-    std::vector<AABB> rescueZones; /**< Collection of polygons representing rescue zones. */
-    std::vector<Polygon> deathZones; /**< Collection of polygons representing death zones. */
-    std::vector<Polygon> obstacles; /**< Collection of polygons representing obstacles. */
-    std::vector<AABB> toggleGravityZones; /**< Collection of polygons representing toggle gravity zones. */
-    std::vector<AABB> increaseFallSpeedZones; /**< Collection of polygons representing increase fall speed zones. */
+    std::vector<Handle<AABB>> saveZones; /**< Handles of the save zones in the broad phase area. */
+    std::vector<Handle<AABB>> rescueZones; /**< Handles of the rescue zones in the broad phase area. */
+    std::vector<Handle<Polygon>> deathZones; /**< Handles of the death zones in the broad phase area. */
+    std::vector<Handle<Polygon>> obstacles; /**< Handles of the obstacles in the broad phase area. */
+    std::vector<Handle<AABB>> toggleGravityZones; /**< Handles of the toggle gravity zones in the broad phase area. */
+    std::vector<Handle<AABB>> increaseFallSpeedZones; /**< Handles of the increase fall speed zones in the broad phase area. */
 
     // LEVERS
-    std::vector<TreadmillLever> treadmillLevers; /**< Collection of TreadmillLever representing treadmill levers. */
-    std::vector<PlatformLever> platformLevers; /**< Collection of PlatformLever representing platform levers. */
-    std::vector<CrusherLever> crusherLevers; /**< Collection of CrusherLever representing crusher levers. */
+    std::vector<Handle<TreadmillLever>> treadmillLevers; /**< Handles of the treadmill levers in the broad phase area. */
+    std::vector<Handle<PlatformLever>> platformLevers; /**< Handles of the platform levers in the broad phase area. */
+    std::vector<Handle<CrusherLever>> crusherLevers; /**< Handles of the crusher levers in the broad phase area. */
 
     // PLATFORMS
-    std::vector<MovingPlatform1D> movingPlatforms1D; /**< Collection of MovingPlatform1D representing 1D platforms. */
-    std::vector<MovingPlatform2D> movingPlatforms2D; /**< Collection of MovingPlatform2D representing 2D platforms. */
-    std::vector<SwitchingPlatform> switchingPlatforms; /**< Collection of switchingPlatform representing switching platforms. */
-    std::vector<WeightPlatform> weightPlatforms; /**< Collection of WeightPlatform representing weight platforms. */
-    std::vector<Treadmill> treadmills; /**< Collection of Treadmill representing treadmills. */
+    std::vector<Handle<MovingPlatform1D>> movingPlatforms1D; /**< Handles of the 1D platforms in the broad phase area. */
+    std::vector<Handle<MovingPlatform2D>> movingPlatforms2D; /**< Handles of the 2D platforms in the broad phase area. */
+    std::vector<Handle<SwitchingPlatform>> switchingPlatforms; /**< Handles of the switching platforms in the broad phase area. */
+    std::vector<Handle<WeightPlatform>> weightPlatforms; /**< Handles of the weight platforms in the broad phase area. */
+    std::vector<Handle<Treadmill>> treadmills; /**< Handles of the treadmills in the broad phase area. */
 
     // TRAPS
-    std::vector<Crusher> crushers; /**< Collection of Crusher representing crushers. */
+    std::vector<Handle<Crusher>> crushers; /**< Handles of the crushers in the broad phase area. */
 
     // ITEMS
-    std::vector<SizePowerUp> sizePowerUp; /**< Collection of SizePowerUp representing size power-up. */
-    std::vector<SpeedPowerUp> speedPowerUp; /**< Collection of SizePowerUp representing size power-up. */
-    std::vector<Coin> coins; /**< Collection of Coin representing coins. */
-    std::vector<Item*> items; /**< Collection of items. */
+    std::vector<Handle<SizePowerUp>> sizePowerUp; /**< Handles of the size power-up in the broad phase area. */
+    std::vector<Handle<SpeedPowerUp>> speedPowerUp; /**< Handles of the speed power-up in the broad phase area. */
+    std::vector<Handle<Coin>> coins; /**< Handles of the coins in the broad phase area. */
+    std::vector<Handle<Item>> items; /**< Handles of the items in the broad phase area. */
+
+    // SPATIAL QUERIES
+    std::vector<size_t> candidates; /**< Indices returned by the last spatial grid or tree query (reused every frame). */
+
+    // INCREMENTAL MODE
+    std::atomic<bool> incremental = true; /**< Flag indicating if the static sets are reused while the camera stays inside the static area (set from the console thread). */
+    bool staticIncremental = true; /**< The mode used for the last rebuild of the static sets, a change of mode rebuilds them. */
+    SDL_FRect staticArea = {0, 0, 0, 0}; /**< The area used for the last rebuild of the static sets. */
+    uint32_t staticGeneration = 0; /**< The generation of the level used for the last rebuild of the static sets. */
+    size_t fullRebuildCount = 0; /**< The number of frames where the static sets have been rebuilt. */
+    size_t reusedFrameCount = 0; /**< The number of frames where the static sets have been reused. */
+
+    // BOUNDS (structure of arrays, gathered again only when a new level is loaded or an object is picked)
+    StaticBounds sizePowerUpBounds; /**< Bounds of every size power-up of the level. */
+    StaticBounds speedPowerUpBounds; /**< Bounds of every speed power-up of the level. */
+    StaticBounds coinsBounds; /**< Bounds of every coin of the level. */
+    StaticBounds itemsBounds; /**< Bounds of every item of the level. */
 
 
 public:
@@ -54,25 +117,52 @@ public:
 
     /* ACCESSORS */
 
-    [[nodiscard]] std::vector<AABB> &getSaveZones();
-    [[nodiscard]] std::vector<AABB> &getRescueZones();
-    [[nodiscard]] std::vector<AABB> &getToggleGravityZones();
-    [[nodiscard]] std::vector<AABB> &getIncreaseFallSpeedZones();
-    [[nodiscard]] std::vector<Polygon> &getDeathZones();
-    [[nodiscard]] std::vector<Polygon> &getObstacles();
-    [[nodiscard]] std::vector<TreadmillLever> &getTreadmillLevers();
-    [[nodiscard]] std::vector<PlatformLever> &getPlatformLevers();
-    [[nodiscard]] std::vector<CrusherLever> &getCrusherLevers();
-    [[nodiscard]] std::vector<MovingPlatform1D> &getMovingPlatforms1D();
-    [[nodiscard]] std::vector<MovingPlatform2D> &getMovingPlatforms2D();
-    [[nodiscard]] std::vector<SwitchingPlatform> &getSwitchingPlatforms();
-    [[nodiscard]] std::vector<WeightPlatform> &getWeightPlatforms();
-    [[nodiscard]] std::vector<Treadmill> &getTreadmills();
-    [[nodiscard]] std::vector<Crusher> &getCrushers();
-    [[nodiscard]] std::vector<SizePowerUp> &getSizePowerUps();
-    [[nodiscard]] std::vector<SpeedPowerUp> &getSpeedPowerUps();
-    [[nodiscard]] std::vector<Coin> &getCoins();
-    [[nodiscard]] std::vector<Item*> &getItems();
+    [[nodiscard]] std::span<const Handle<AABB>> getSaveZones() const;
+    [[nodiscard]] std::span<const Handle<AABB>> getRescueZones() const;
+    [[nodiscard]] std::span<const Handle<AABB>> getToggleGravityZones() const;
+    [[nodiscard]] std::span<const Handle<AABB>> getIncreaseFallSpeedZones() const;
+    [[nodiscard]] std::span<const Handle<Polygon>> getDeathZones() const;
+    [[nodiscard]] std::span<const Handle<Polygon>> getObstacles() const;
+    [[nodiscard]] std::span<const Handle<TreadmillLever>> getTreadmillLevers() const;
+    [[nodiscard]] std::span<const Handle<PlatformLever>> getPlatformLevers() const;
+    [[nodiscard]] std::span<const Handle<CrusherLever>> getCrusherLevers() const;
+    [[nodiscard]] std::span<const Handle<MovingPlatform1D>> getMovingPlatforms1D() const;
+    [[nodiscard]] std::span<const Handle<MovingPlatform2D>> getMovingPlatforms2D() const;
+    [[nodiscard]] std::span<const Handle<SwitchingPlatform>> getSwitchingPlatforms() const;
+    [[nodiscard]] std::span<const Handle<WeightPlatform>> getWeightPlatforms() const;
+    [[nodiscard]] std::span<const Handle<Treadmill>> getTreadmills() const;
+    [[nodiscard]] std::span<const Handle<Crusher>> getCrushers() const;
+    [[nodiscard]] std::span<const Handle<SizePowerUp>> getSizePowerUps() const;
+    [[nodiscard]] std::span<const Handle<SpeedPowerUp>> getSpeedPowerUps() const;
+    [[nodiscard]] std::span<const Handle<Coin>> getCoins() const;
+    [[nodiscard]] std::span<const Handle<Item>> getItems() const;
+
+    /**
+     * @brief Return the incremental attribute.
+     * @return True if the static sets are reused while the camera stays inside the static area, false if they are rebuilt every frame.
+     */
+    [[nodiscard]] bool getIncremental() const;
+
+    /**
+     * @brief Return the number of frames where the static sets (zones, obstacles and death zones) have been rebuilt.
+     * @return The number of full rebuilds.
+     */
+    [[nodiscard]] size_t getFullRebuildCount() const;
+
+    /**
+     * @brief Return the number of frames where the static sets have been reused and only the moving objects have been checked.
+     * @return The number of reused frames.
+     */
+    [[nodiscard]] size_t getReusedFrameCount() const;
+
+
+    /* MUTATORS */
+
+    /**
+     * @brief Set the incremental attribute, the next frame rebuilds the static sets.
+     * @param state True to reuse the static sets while the camera stays inside the static area, false to rebuild them every frame.
+     */
+    void setIncremental(bool state);
 
 
     /* METHODS */
@@ -82,16 +172,34 @@ public:
      */
     void broadPhase();
 
+    /**
+     * @brief Gather the objects near a player from its swept bounding box, so the narrow phase only tests its true neighbours.
+     * @param player The player handled by the narrow phase.
+     * @param[out] result The handles of the objects near the player (the vectors are cleared and reused).
+     * @note The static zones are filtered from the static sets of the broad phase, and the moving objects are queried
+     *       from the trees of the level, so the cost depends on the density around the player and not on the size of the level.
+     *       The objects refreshed by the broad phase (treadmills, items and levers) are filtered from its sets.
+     */
+    void gatherNeighbourhood(const Player &player, Neighbourhood &result);
+
 
 private:
 
     /* SUB METHODS */
+
+    /**
+     * @brief Rebuild the static sets (zones, obstacles and death zones) if the broad phase area leaves the static area.
+     * @param broad_phase_area The broad phase area of this frame.
+     * @return True if the static sets have been rebuilt, false if they have been reused.
+     */
+    bool updateStaticSets(const SDL_FRect &broad_phase_area);
+
     void checkSavesZones(const SDL_FRect& broad_phase_area);
     void checkRescueZones(const SDL_FRect& broad_phase_area);
     void checkToggleGravityZones(const SDL_FRect& broad_phase_area);
     void checkIncreaseFallSpeedZones(const SDL_FRect& broad_phase_area);
-    void checkDeathZones(const std::vector<Point>& broad_phase_area);
-    void checkObstacles(const std::vector<Point>& broad_phase_area);
+    void checkDeathZones(const SDL_FRect& broad_phase_area_box, const Quad& broad_phase_area);
+    void checkObstacles(const SDL_FRect& broad_phase_area_box, const Quad& broad_phase_area);
     void checkTreadmillLevers(const SDL_FRect& broad_phase_area);
     void checkPlatformLevers(const SDL_FRect& broad_phase_area);
     void checkCrusherLevers(const SDL_FRect& broad_phase_area);
@@ -105,6 +213,69 @@ private:
     void checkCoins(const SDL_FRect& broad_phase_area);
     void checkItems(const SDL_FRect& broad_phase_area);
 
+    /**
+     * @brief Test the bounds of a collection of objects which do not move against the broad phase area at once.
+     * @param collection The collection of the level (objects or pointers to objects).
+     * @param bounds The bounds of the collection, gathered again only when the generation of the collection changes.
+     * @param broad_phase_area The broad phase area.
+     * @param[in,out] result The handles of the objects overlapping the area, which are flagged as on screen.
+     *                       Only the objects entering or leaving the area are shown or hidden.
+     */
+    template<typename T, typename Element>
+    void sweep(std::vector<Element> &collection, StaticBounds &bounds, const SDL_FRect &broad_phase_area, std::vector<Handle<T>> &result);
+
+    /**
+     * @brief Query the tree of a collection of moving objects for the objects overlapping the broad phase area.
+     * @param broad_phase_area The broad phase area.
+     * @param[in,out] result The handles of the objects overlapping the area, which are flagged as on screen.
+     *                       Only the objects entering or leaving the area are shown or hidden (and woken up or put to sleep),
+     *                       so the cost does not depend on the collection size.
+     */
+    template<typename T>
+    void collect(const SDL_FRect &broad_phase_area, std::vector<Handle<T>> &result);
+
+    /**
+     * @brief Get the box swept by a player during the frame, grown by the neighbourhood margin.
+     * @param player The player.
+     * @return The union of the box at the start of the move, the current box, the box of the next frame and the hit zone of the player.
+     */
+    static SDL_FRect getSweptArea(const Player &player);
+
+    /**
+     * @brief Keep the zones of a static set overlapping the swept area of a player.
+     * @param type The type of the zones.
+     * @param handles The static set of the zones.
+     * @param swept_area The swept area of the player.
+     * @param[out] result The handles of the zones overlapping the area.
+     */
+    void gatherZones(AABBType type, std::span<const Handle<AABB>> handles, const SDL_FRect &swept_area, std::vector<Handle<AABB>> &result) const;
+
+    /**
+     * @brief Keep the zones of a static set overlapping the swept area of a player.
+     * @param type The type of the zones.
+     * @param handles The static set of the zones.
+     * @param swept_area The swept area of the player.
+     * @param[out] result The handles of the zones overlapping the area.
+     */
+    void gatherZones(PolygonType type, std::span<const Handle<Polygon>> handles, const SDL_FRect &swept_area, std::vector<Handle<Polygon>> &result) const;
+
+    /**
+     * @brief Query the tree of a collection of moving objects for the objects near a player.
+     * @param swept_area The swept area of the player.
+     * @param[out] result The handles of the objects overlapping the area.
+     */
+    template<typename T>
+    void gatherMoving(const SDL_FRect &swept_area, std::vector<Handle<T>> &result);
+
+    /**
+     * @brief Keep the objects of a broad phase set overlapping the swept area of a player.
+     * @param handles The broad phase set.
+     * @param swept_area The swept area of the player.
+     * @param[out] result The handles of the objects overlapping the area.
+     */
+    template<typename T>
+    void gatherVisible(std::span<const Handle<T>> handles, const SDL_FRect &swept_area, std::vector<Handle<T>> &result);
+
 };
 
 
@@ -13,6 +13,8 @@ private:
     /* ATTRIBUTES */
 
     Game *gamePtr; /**< A pointer to the game object. */
+    std::vector<size_t> candidates; /**< Indices returned by the last tree or grid query (reused every frame). */
+    std::vector<bool> exploding; /**< Flag of each asteroid exploding during this frame (reused every frame). */
 
 
 public:
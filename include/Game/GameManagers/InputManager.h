@@ -2,6 +2,8 @@
 #define PLAY_TOGETHER_INPUTMANAGER_H
 
 #include <SDL_events.h>
+#include <vector>
+#include <mutex>
 #include "../Player.h"
 #include "../Game.h"
 
@@ -17,6 +19,10 @@ private:
 
     Game *gamePtr; /**< A pointer to the game object. */
     uint16_t lastKeyboardStateMask = 0; /**< The last keyboard state mask. */
+    std::mutex keyEventsMutex; /**< Mutex protecting the key events queued for the simulation thread. */
+    std::vector<SDL_KeyboardEvent> keyEvents; /**< The key events polled since the last tick. */
+    uint16_t polledKeyboardStateMask = 0; /**< The keyboard state mask once the key events polled are applied. */
+    std::vector<SDL_KeyboardEvent> tickKeyEvents; /**< The key events applied by the current tick (swapped with the queue). */
 
 
 public:
@@ -29,10 +35,23 @@ public:
     /* METHODS */
 
     /**
-     * @brief Handles the keyboard events.
+     * @brief Polls the SDL events: handles the quit, the pause and the menu, and queues the key events for the next tick.
+     * @note Called by the thread owning the window, the simulation thread applies the key events.
      */
     void handleKeyboardEvents();
 
+    /**
+     * @brief Queues a key event, the local player handles it at the next tick.
+     * @param keyEvent The key event (SDL_KEYDOWN or SDL_KEYUP).
+     */
+    void queueKeyEvent(const SDL_KeyboardEvent &keyEvent);
+
+    /**
+     * @brief Applies the key events queued since the last tick to the local player, and sends its keyboard state.
+     * @note Called by the simulation thread at the start of a tick.
+     */
+    void applyKeyEvents();
+
     /**
      * @brief Handles the key down event.
      * @param player The player object.
@@ -48,9 +67,10 @@ public:
     void handleKeyUpEvent(Player *player, const SDL_KeyboardEvent &keyEvent) const;
 
     /**
-     * @brief Sends the keyboard state to the network.
+     * @brief Sends the keyboard state to the network, stamped with the current tick (its input sequence).
+     * @param keyboardStateMask The keyboard state mask applied by the tick.
      */
-    void sendKeyboardStateToNetwork();
+    void sendKeyboardStateToNetwork(uint16_t keyboardStateMask);
 
     /**
      * @brief Sends the sync correction to the network.
@@ -2,9 +2,11 @@
 #define PLAY_TOGETHER_PLAYERCOLLISIONMANAGER_H
 
 #include <queue>
+#include <vector>
 #include "../../Physics/Collision.h"
 #include "../Level.h"
 #include "../Game.h"
+#include "../../Utils/AllocationCounter.h"
 
 /**
  * @file PlayerCollisionManager.h
@@ -12,12 +14,88 @@
  */
 
 
+struct Neighbourhood; // Defined in BroadPhaseManager.h, which includes this header through Game.h
+
+constexpr size_t NARROW_PHASE_PLAYERS_PER_JOB = 2; /**< Minimum number of living players resolved by a job, the narrow phase is spread over the workers from 4 players. */
+constexpr size_t COMMAND_BUFFER_CAPACITY = 64; /**< Number of commands reserved in each command buffer, so recording a command does not allocate. */
+
+
 //data necessary to bring back to the old state the player
 typedef struct {
     Item* item;
-    time_t t;
+    Uint32 t; // Game time when the item was picked up (SimulationClock)
+    int playerID; // The player who picked up the item, the effect is reverted on him
 } GameData;
 
+/**
+ * @enum WorldCommandType
+ * @brief The changes of the shared world a player can cause during the narrow phase.
+ */
+enum class WorldCommandType {
+    KILL_PLAYER, /**< Kill the player. */
+    TOGGLE_TREADMILL_LEVER, /**< Toggle a treadmill lever. */
+    TOGGLE_PLATFORM_LEVER, /**< Toggle a platform lever. */
+    TOGGLE_CRUSHER_LEVER, /**< Toggle a crusher lever. */
+    INCREASE_WEIGHT, /**< Increase the weight of a weight platform. */
+    DECREASE_WEIGHT, /**< Decrease the weight of a weight platform. */
+    PICK_SIZE_POWER_UP, /**< Apply a size power-up to the player and remove it. */
+    PICK_SPEED_POWER_UP, /**< Apply a speed power-up to the player and remove it. */
+    PICK_COIN, /**< Apply a coin to the player and remove it. */
+    PICK_ITEM, /**< Apply an item to the player for a limited time and remove it. */
+    REACH_CHECKPOINT, /**< Save the checkpoint of a save zone. */
+    SET_RESCUE_ZONE, /**< Move the dead players to a rescue zone. */
+    RESPAWN_PLAYER /**< Respawn a dead player. */
+};
+
+/**
+ * @struct WorldCommand
+ * @brief A change of the shared world recorded during the narrow phase and applied once every player is resolved.
+ */
+struct WorldCommand {
+    WorldCommandType type; /**< The kind of change. */
+    size_t player; /**< The index of the living player who caused the change. */
+    uint32_t index; /**< The index of the handle of the object to change. */
+    uint32_t generation; /**< The generation of the handle of the object to change. */
+    int value; /**< The ID of the checkpoint or of the dead player to respawn. */
+};
+
+/**
+ * @struct CommandBuffer
+ * @brief The commands recorded by one worker of the narrow phase.
+ */
+struct CommandBuffer {
+    std::vector<WorldCommand> commands; /**< The commands, in the order they were recorded. */
+    size_t player = 0; /**< The index of the living player currently resolved by the worker. */
+
+    /**
+     * @brief Record a change of an object of the level.
+     * @param type The kind of change.
+     * @param handle The handle of the object, it is resolved again when the command is applied.
+     */
+    template<typename T>
+    void record(WorldCommandType type, Handle<T> handle) {
+        commands.push_back({type, player, handle.index, handle.generation, 0});
+    }
+
+    /**
+     * @brief Record a change which does not target an object of the level.
+     * @param type The kind of change.
+     * @param value The ID of the checkpoint or of the dead player to respawn.
+     */
+    void record(WorldCommandType type, int value = 0) {
+        commands.push_back({type, player, 0, 0, value});
+    }
+};
+
+
+/**
+ * @class PlayerCollisionManager
+ * @brief Resolves the collisions of the players, one player per worker of the job system.
+ *
+ * A worker only changes the player it resolves. Every change of the shared world (levers, weights, items,
+ * checkpoints, living and dead players) is recorded in the command buffer of the worker and applied at the end
+ * of the phase, in the order of the players, so the result does not depend on the number of threads.
+ */
 class PlayerCollisionManager {
 private:
     /* ATTRIBUTES */
@@ -25,6 +103,14 @@ private:
     Game *gamePtr; /**< A pointer to the game object. */
     // Queue in order to keep track of the effects applied on the player
     std::queue<GameData*> timeQueue;
+    std::vector<Neighbourhood> neighbourhoods; /**< The neighbourhood of each living player, gathered before the parallel phase. */
+    std::vector<CommandBuffer> commandBuffers; /**< The command buffer of each worker of the job system. */
+    std::vector<WorldCommand> commands; /**< The commands of every worker, merged and sorted by player before being applied. */
+    std::vector<Player *> resolvedPlayers; /**< The living players resolved during this frame, they keep their address while the commands move them between the states. */
+    std::vector<uint32_t> pickedSizePowerUps; /**< The size power-ups picked during this frame, removed once every command is applied. */
+    std::vector<uint32_t> pickedSpeedPowerUps; /**< The speed power-ups picked during this frame, removed once every command is applied. */
+    std::vector<uint32_t> pickedCoins; /**< The coins picked during this frame, removed once every command is applied. */
+    std::vector<uint32_t> pickedItems; /**< The items picked during this frame, removed once every command is applied. */
 
 
 
@@ -46,71 +132,106 @@ public:
 
 private:
 
+    /**
+     * @brief Handles all collisions of one living player, run by a worker of the job system.
+     * @param player The player object.
+     * @param neighbourhood The objects near the player.
+     * @param buffer The command buffer receiving the changes of the shared world.
+     * @param delta_time The time elapsed since the last frame.
+     */
+    void handlePlayerCollisions(Player &player, const Neighbourhood &neighbourhood, CommandBuffer &buffer, double delta_time);
+
+    /**
+     * @brief Revert the effects of the items picked up more than 4 seconds ago.
+     */
+    void expireItems();
+
+    /**
+     * @brief Apply the commands recorded by every worker, in the order of the players.
+     * @note A command whose handle is no longer valid (its object was removed by a previous command) is skipped.
+     */
+    void applyCommands();
+
+
     /* PLAYER NORMAL MAVITY */
 
     /**
      * @brief Handles collisions between a player and obstacles.
      * @param player The player object.
+     * @param neighbourhood The objects near the player.
      */
-    void handleCollisionsWithObstacles(Player *player);
+    void handleCollisionsWithObstacles(Player *player, const Neighbourhood &neighbourhood);
 
     /**
      * @brief Handles collisions between a player and treadmill levers.
      * @param player The player object.
+     * @param neighbourhood The objects near the player.
+     * @param buffer The command buffer receiving the changes of the shared world.
      * @return True if the player hits a treadmill lever, false otherwise.
      */
-    bool handleCollisionsWithTreadmillLevers(const Player *player);
+    bool handleCollisionsWithTreadmillLevers(const Player *player, const Neighbourhood &neighbourhood, CommandBuffer &buffer);
 
     /**
      * @brief Handles collisions between a player and platform levers.
      * @param player The player object.
+     * @param neighbourhood The objects near the player.
+     * @param buffer The command buffer receiving the changes of the shared world.
      * @return True if the player hits a platform lever, false otherwise.
      */
-    bool handleCollisionsWithPlatformLevers(const Player *player);
+    bool handleCollisionsWithPlatformLevers(const Player *player, const Neighbourhood &neighbourhood, CommandBuffer &buffer);
 
     /**
      * @brief Handles collisions between a player and crusher levers.
      * @param player The player object.
+     * @param neighbourhood The objects near the player.
+     * @param buffer The command buffer receiving the changes of the shared world.
      * @return True if the player hits a crusher lever, false otherwise.
      */
-    bool handleCollisionsWithCrusherLevers(const Player *player);
+    bool handleCollisionsWithCrusherLevers(const Player *player, const Neighbourhood &neighbourhood, CommandBuffer &buffer);
 
     /**
      * @brief Handles collisions between a player and 1D moving platforms.
      * @param player The player object.
+     * @param neighbourhood The objects near the player.
      */
-    void handleCollisionsWithMovingPlatform1D(Player *player);
+    void handleCollisionsWithMovingPlatform1D(Player *player, const Neighbourhood &neighbourhood);
 
     /**
      * @brief Handles collisions between a player and 2D moving platforms.
      * @param player The player object.
+     * @param neighbourhood The objects near the player.
      */
-    void handleCollisionsWithMovingPlatform2D(Player *player);
+    void handleCollisionsWithMovingPlatform2D(Player *player, const Neighbourhood &neighbourhood);
 
     /**
      * @brief Handles collisions between a player and switching platforms.
      * @param player The player object.
+     * @param neighbourhood The objects near the player.
      */
-    void handleCollisionsWithSwitchingPlatform(Player *player);
+    void handleCollisionsWithSwitchingPlatform(Player *player, const Neighbourhood &neighbourhood);
 
     /**
      * @brief Handles collisions between a player and weight platforms.
      * @param player The player object.
+     * @param neighbourhood The objects near the player.
+     * @param buffer The command buffer receiving the changes of the shared world.
      */
-    void handleCollisionsWithWeightPlatform(Player *player);
+    void handleCollisionsWithWeightPlatform(Player *player, const Neighbourhood &neighbourhood, CommandBuffer &buffer);
 
     /**
      * @brief Handles collisions between a player and treadmills.
      * @param player The player object.
+     * @param neighbourhood The objects near the player.
      */
-    void handleCollisionsWithTreadmills(Player *player);
+    void handleCollisionsWithTreadmills(Player *player, const Neighbourhood &neighbourhood);
 
     /**
      * @brief Handles collisions between the player and crushers.
      * @param player The player object.
+     * @param neighbourhood The objects near the player.
      * @return True if the player dies, false otherwise.
      */
-    bool handleCollisionsWithCrushers(Player *player);
+    bool handleCollisionsWithCrushers(Player *player, const Neighbourhood &neighbourhood);
 
     /**
      * @brief Handles collisions between the player and camera borders.
@@ -121,68 +242,59 @@ private:
     /**
      * @brief Handles collisions between the player and death zones.
      * @param player The player object.
+     * @param neighbourhood The objects near the player.
      * @return True if the player dies, false otherwise.
      */
-    bool handleCollisionsWithDeathZones(const Player &player);
+    bool handleCollisionsWithDeathZones(const Player &player, const Neighbourhood &neighbourhood);
 
     /**
-     * @brief Handles collisions between the player and save zones.
-     * @param player The player object.
-     */
-    void handleCollisionsWithSaveZones(Player &player);
-
-    /**
-     * @brief Handles collisions between the player and rescue zones.
-     * @param player The player object.
-     */
-    void handleCollisionsWithRescueZones(const Player &player);
-
-    /**
-     * @brief Handles collisions between the player and toggle gravity zones.
+     * @brief Update the trigger zones overlapped by the player and apply the zones the player enters or exits.
      * @param player The player object.
+     * @param neighbourhood The objects near the player.
+     * @param buffer The command buffer receiving the changes of the shared world.
      * @param delta_time The time elapsed since the last frame.
      */
-    void handleCollisionsWithToggleGravityZones(Player &player, double delta_time);
-
-    /**
-     * @brief Handles collisions between the player and increase fall speed zones.
-     * @param player The player object.
-     */
-    void handleCollisionsWithIncreaseFallSpeedZones(Player &player);
+    void handleTriggerZones(Player &player, const Neighbourhood &neighbourhood, CommandBuffer &buffer, double delta_time);
 
     /**
      * @brief Handles collisions between the player and size power-up items.
      * @param player Reference to the player object.
+     * @param neighbourhood The objects near the player.
+     * @param buffer The command buffer receiving the changes of the shared world.
      */
-    void handleCollisionsWithSizePowerUps(Player *player);
+    void handleCollisionsWithSizePowerUps(const Player *player, const Neighbourhood &neighbourhood, CommandBuffer &buffer);
 
     /**
      * @brief Handles collisions between the player and size power-up items.
      * @param player Reference to the player object.
+     * @param neighbourhood The objects near the player.
+     * @param buffer The command buffer receiving the changes of the shared world.
      */
-    void handleCollisionsWithSpeedPowerUps(Player *player);
+    void handleCollisionsWithSpeedPowerUps(const Player *player, const Neighbourhood &neighbourhood, CommandBuffer &buffer);
 
     /**
      * @brief Handles collisions between the player and coins items.
      * @param player Reference to the player object.
-     * @param level Reference to the level object.
-     * @param coins Vector of Coin.
-     * @param playerManager The manager responsible for handling player-related operations.
+     * @param neighbourhood The objects near the player.
+     * @param buffer The command buffer receiving the changes of the shared world.
      */
-    void handleCollisionsWithCoins(Player *player);
+    void handleCollisionsWithCoins(const Player *player, const Neighbourhood &neighbourhood, CommandBuffer &buffer);
 
     /**
      * @brief Handles collisions between the player and items.
      * @param player The player object.
+     * @param neighbourhood The objects near the player.
+     * @param buffer The command buffer receiving the changes of the shared world.
      */
-    void handleCollisionsWithItem(Player *player);
+    void handleCollisionsWithItem(const Player *player, const Neighbourhood &neighbourhood, CommandBuffer &buffer);
 
     /**
      * @brief Handles collisions between the player and dead players.
      * @param player Reference to the player object.
+     * @param buffer The command buffer receiving the changes of the shared world.
      * @return True if the player hits a dead player, false otherwise.
      */
-    bool handleCollisionsWithDeadPlayers(const Player *player);
+    bool handleCollisionsWithDeadPlayers(const Player *player, CommandBuffer &buffer);
 
 };
 
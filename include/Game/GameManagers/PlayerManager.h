@@ -2,6 +2,7 @@
 #define PLAY_TOGETHER_PLAYERMANAGER_H
 
 #include "../Game.h"
+#include "../PlayerSlotMap.h"
 #include "../Events/Rescue.h"
 
 
@@ -17,9 +18,7 @@ private:
 
     Game *game;
     Rescue currentRescueZone;
-    std::vector<Player> alivePlayers;
-    std::vector<Player> neutralPlayers;
-    std::vector<Player> deadPlayers;
+    PlayerSlotMap players; /**< Every player with its lifecycle state, a player never moves while it is in the game. */
 
 
 public:
@@ -32,21 +31,21 @@ public:
 
     /**
      * @brief Get the players in the game.
-     * @return A vector of Player objects representing the players in the game.
+     * @return A view of the living players, invalidated when a player dies or is removed.
      */
-    [[nodiscard]] std::vector<Player> &getAlivePlayers();
+    [[nodiscard]] PlayerSlotMap::View getAlivePlayers();
 
     /**
      * @brief Get the neutral players in the game.
-     * @return A vector of Player objects representing the neutral players in the game.
+     * @return A view of the neutral players, invalidated when a player dies, respawns or is removed.
      */
-    [[nodiscard]] std::vector<Player> &getNeutralPlayers();
+    [[nodiscard]] PlayerSlotMap::View getNeutralPlayers();
 
     /**
      * @brief Get the dead players in the game.
-     * @return A vector of Player objects representing the dead players in the game.
+     * @return A view of the dead players, invalidated when a player dies, respawns or is removed.
      */
-    [[nodiscard]] std::vector<Player> &getDeadPlayers();
+    [[nodiscard]] PlayerSlotMap::View getDeadPlayers();
 
     /**
      * @brief Get the total number of players in the game.
@@ -54,6 +53,13 @@ public:
      */
     [[nodiscard]] size_t getPlayerCount() const;
 
+    /**
+     * @brief Get the lifecycle state of a player.
+     * @param player A player of the game.
+     * @return The state of the player.
+     */
+    [[nodiscard]] PlayerState getPlayerState(const Player &player) const;
+
 
     /* MUTATORS */
 
@@ -72,16 +78,16 @@ public:
     void setTheBestPlayer();
 
     /**
-     * @brief Get the player with the given id.
+     * @brief Get the living or dead player with the given id.
      * @param id The id of the player to find.
-     * @return A pointer to the Player object with the given id.
+     * @return A pointer to the Player object with the given id (valid until the player is removed), nullptr if there is none.
      */
     Player *findPlayerById(int id);
 
     /**
-     * @brief Get the index of the player with the given id.
+     * @brief Get the index of the living player with the given id.
      * @param id The id of the player to find.
-     * @return The index of the player with the given id.
+     * @return The index of the player in getAlivePlayers(), -1 if there is no such living player.
      */
     int findPlayerIndexById(int id);
 
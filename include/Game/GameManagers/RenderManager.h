@@ -2,7 +2,11 @@
 #define PLAY_TOGETHER_RENDERMANAGER_H
 
 #include <SDL_render.h>
+#include <array>
+#include <mutex>
+#include <atomic>
 #include "../Game.h"
+#include "../../Graphics/RenderSnapshot.h"
 
 /**
  * @file RenderManager.h
@@ -12,16 +16,40 @@
 
 class RenderManager {
 private:
+    /* TYPES */
+
+    /**
+     * @struct Frame
+     * @brief The drawing of a simulation tick, immutable once published to the render thread.
+     */
+    struct Frame {
+        RenderSnapshot world; /**< The moving objects, drawn between the backgrounds and the middleground. */
+        RenderSnapshot overlay; /**< The debug shapes drawn over everything (camera point, player colliders). */
+        Point cameraStart = {0, 0}; /**< The rendering point of the camera at the previous tick. */
+        Point cameraEnd = {0, 0}; /**< The rendering point of the camera at the tick. */
+        bool textures = true; /**< True if the objects were recorded by their textures, false by their collision boxes. */
+        Uint64 captureCounter = 0; /**< The performance counter at the end of the tick, the interpolation starts from it. */
+    };
+
+
+    /* ATTRIBUTES */
+
     SDL_Renderer *renderer; /**< The SDL_Renderer to render the game. */
     Game *gamePtr; /**< A pointer to the game object. */
     static std::vector<TTF_Font *> fonts; /**< A vector of TTF_Font objects for rendering text. */
 
-    // Debug rendering attributes
-    bool render_textures = true;
-    bool render_camera_point = false;
-    bool render_camera_area = false;
-    bool render_player_colliders = false;
-    bool render_fps = false;
+    std::array<Frame, 2> frames; /**< The frame drawn by the render thread and the frame recorded by the simulation thread. */
+    std::mutex framesMutex; /**< Mutex protecting the exchange of the frames. */
+    size_t frontFrame = 0; /**< The index of the frame drawn by the render thread. */
+    bool frameReady = false; /**< True if the other frame has been recorded and is waiting to be drawn. */
+    bool frameRequested = true; /**< True if the render thread waits for a new frame, the other frame may be recorded. */
+
+    // Debug rendering attributes (toggled by the console thread)
+    std::atomic<bool> render_textures = true;
+    std::atomic<bool> render_camera_point = false;
+    std::atomic<bool> render_camera_area = false;
+    std::atomic<bool> render_player_colliders = false;
+    std::atomic<bool> render_fps = false;
 
 
 public:
@@ -52,7 +80,20 @@ public:
     /* METHODS */
 
     /**
-     * @brief Renderer the game.
+     * @brief Record the tick just simulated into the back frame, if the render thread has taken the previous one.
+     * @note Called by the simulation thread only, it never waits for the render thread.
+     */
+    void capture();
+
+    /**
+     * @brief Drop both frames, they may point to the textures of a level being replaced.
+     * @note Called while the simulation thread is stopped.
+     */
+    void clearFrames();
+
+    /**
+     * @brief Renderer the game: take the last frame recorded and draw it between its last two ticks.
+     * @note Called by the thread owning the renderer only.
      */
     void render();
 
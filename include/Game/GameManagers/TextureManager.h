@@ -3,6 +3,7 @@
 
 #include <SDL_image.h>
 #include <vector>
+#include <array>
 #include <string>
 #include <iostream>
 #include <fstream>
@@ -26,7 +27,7 @@ private:
 
     std::vector<Texture> platforms; /**< Collection of Texture representing the platforms. */
     std::vector<Texture> crushers; /**< Collection of Texture representing the crusher textures. */
-    SDL_Texture *lever = nullptr; /**< SDL_Texture representing the lever texture. */
+    Texture lever; /**< Texture representing the lever texture. */
     std::vector<SDL_Texture*> backgrounds; /**< Collection of SDL_Texture representing the background textures. */
     SDL_Texture *middleground = nullptr; /**< SDL_Texture representing the middle ground texture. */
     std::vector<SDL_Texture*> foregrounds; /**< Collection of SDL_Texture representing the foreground textures. */
@@ -44,7 +45,7 @@ public:
     [[nodiscard]] int getWorldID() const;
     [[nodiscard]] std::vector<Texture>& getPlatforms();
     [[nodiscard]] std::vector<Texture>& getCrushers();
-    [[nodiscard]] SDL_Texture& getLever();
+    [[nodiscard]] const Texture& getLever() const;
     [[nodiscard]] std::vector<SDL_Texture*>& getBackgrounds();
     [[nodiscard]] SDL_Texture* getMiddleground();
     [[nodiscard]] std::vector<SDL_Texture*>& getForegrounds();
@@ -61,7 +62,7 @@ public:
 
     /**
      * @brief Load the textures of the world.
-     * @param renderer Represents the renderer of the game.
+     * @param renderer Represents the renderer of the game, nullptr to only read the sizes of the textures (headless server).
      * @param world_id Represents the ID of the world to load.
      */
     void loadWorldTextures(SDL_Renderer *renderer, int world_id);
@@ -72,37 +73,47 @@ private:
      * @brief Load the textures of the platforms.
      * @param renderer Represents the renderer of the game.
      */
-    void loadPlatformTextures(SDL_Renderer &renderer);
+    void loadPlatformTextures(SDL_Renderer *renderer);
 
     /**
      * @brief Load the texture of the treadmills.
      * @param renderer Represents the renderer of the game.
      */
-    void loadTreadmillTexture(SDL_Renderer &renderer);
+    void loadTreadmillTexture(SDL_Renderer *renderer);
 
     /**
      * @brief Load the textures of the crushers.
      * @param renderer Represents the renderer of the game.
      */
-    void loadCrusherTextures(SDL_Renderer &renderer);
+    void loadCrusherTextures(SDL_Renderer *renderer);
 
     /**
      * @brief Load the texture of the lever.
      * @param renderer Represents the renderer of the game.
      */
-    void loadLeverTexture(SDL_Renderer &renderer);
+    void loadLeverTexture(SDL_Renderer *renderer);
 
     /**
      * @brief Load the background textures.
      * @param renderer Represents the renderer of the game.
      */
-    void loadBackgroundTextures(SDL_Renderer &renderer);
+    void loadBackgroundTextures(SDL_Renderer *renderer);
 
     /**
      * @brief Load the middleground textures.
      * @param renderer Represents the renderer of the game.
      */
-    void loadForegroundTextures(SDL_Renderer &renderer);
+    void loadForegroundTextures(SDL_Renderer *renderer);
+
+    /**
+     * @brief Load a texture, or only read its size without the renderer.
+     * @param renderer Represents the renderer of the game, nullptr to only read the size of the image.
+     * @param file_path The path of the PNG file.
+     * @param[out] texture The loaded texture.
+     * @param offsets The offset of the texture compared to the collision box.
+     * @return True if the texture has been loaded, false otherwise.
+     */
+    static bool loadTexture(SDL_Renderer *renderer, const std::string &file_path, Texture &texture, SDL_FRect offsets = {0, 0, 0, 0});
 
 
 
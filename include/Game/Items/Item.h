@@ -102,17 +102,15 @@ public:
 
     /**
      * @brief Pure virtual method to renders the item's sprite.
-     * @param renderer Represents the renderer of the game.
-     * @param camera Represents the camera of the game.
+     * @param snapshot The snapshot recording the drawing of the tick.
      */
-    virtual void render(SDL_Renderer *renderer, Point camera) = 0;
+    virtual void render(RenderSnapshot &snapshot) = 0;
 
     /**
      * @brief Renders the collisions by drawing a rectangle.
-     * @param renderer Represents the renderer of the game.
-     * @param camera Represents the camera of the game.
+     * @param snapshot The snapshot recording the drawing of the tick.
      */
-    void renderDebug(SDL_Renderer *renderer, Point camera) const;
+    void renderDebug(RenderSnapshot &snapshot) const;
 
 };
 
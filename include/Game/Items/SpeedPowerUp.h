@@ -41,10 +41,9 @@ public:
 
     /**
      * @brief Renders the power-up's sprite.
-     * @param renderer Represents the renderer of the game.
-     * @param camera Represents the camera of the game.
+     * @param snapshot The snapshot recording the drawing of the tick.
      */
-    void render(SDL_Renderer *renderer, Point camera) override;
+    void render(RenderSnapshot &snapshot) override;
 
 };
 
@@ -3,12 +3,16 @@
 
 #include <sstream>
 #include <fstream>
+#include <type_traits>
 #include "../Graphics/Layer.h"
+#include "../Graphics/RenderSnapshot.h"
 #include "../Physics/Polygon.h"
 #include "../Physics/AABB.h"
+#include "../Physics/SpatialGrid.h"
+#include "../Physics/DynamicAABBTree.h"
 #include "../Sounds/Music.h"
 #include "Camera.h"
-#include "Events/Asteroid.h"
+#include "Events/AsteroidPool.h"
 #include "Levers/Lever.h"
 #include "Platforms/MovingPlatform1D.h"
 #include "Platforms/MovingPlatform2D.h"
@@ -20,6 +24,8 @@
 #include "Items/SpeedPowerUp.h"
 #include "Items/Coin.h"
 #include "../Utils/Mediator.h"
+#include "../Utils/Handle.h"
+#include "../Utils/ActiveSet.h"
 #include "../../dependencies/json.hpp"
 #include "GameManagers/TextureManager.h"
 #include "Levers/TreadmillLever.h"
@@ -69,9 +75,36 @@ private:
     std::vector<AABB> toggleGravityZones; /**< Collection of AABBs representing toggle gravity zones. */
     std::vector<AABB> increaseFallSpeedZones; /**< Collection of AABBs representing increase fall speed zones. */
 
+    // SPATIAL INDEX
+    SpatialGrid collisionZonesGrid; /**< Uniform grid indexing the collision zones. */
+    SpatialGrid deathZonesGrid; /**< Uniform grid indexing the death zones. */
+    SpatialGrid saveZonesGrid; /**< Uniform grid indexing the save zones. */
+    SpatialGrid rescueZonesGrid; /**< Uniform grid indexing the rescue zones. */
+    SpatialGrid toggleGravityZonesGrid; /**< Uniform grid indexing the toggle gravity zones. */
+    SpatialGrid increaseFallSpeedZonesGrid; /**< Uniform grid indexing the increase fall speed zones. */
+    SpatialGrid treadmillLeversGrid; /**< Uniform grid indexing the treadmill levers. */
+    SpatialGrid platformLeversGrid; /**< Uniform grid indexing the platform levers. */
+    SpatialGrid crusherLeversGrid; /**< Uniform grid indexing the crusher levers. */
+
+    // DYNAMIC INDEX
+    DynamicAABBTree movingPlatforms1DTree; /**< Tree indexing the 1D platforms, refitted after every movement. */
+    DynamicAABBTree movingPlatforms2DTree; /**< Tree indexing the 2D platforms, refitted after every movement. */
+    DynamicAABBTree switchingPlatformsTree; /**< Tree indexing the switching platforms, refitted after every movement. */
+    DynamicAABBTree weightPlatformsTree; /**< Tree indexing the weight platforms, refitted after every movement. */
+    DynamicAABBTree crushersTree; /**< Tree indexing the crushers, refitted after every movement. */
+    DynamicAABBTree treadmillsTree; /**< Tree indexing the treadmills, they never move. */
+    DynamicAABBTree asteroidsTree; /**< Tree indexing the asteroids, refitted after every movement. */
+
+    // ACTIVE SETS (only the awake objects are simulated, an object sleeps while it is hidden or stopped)
+    ActiveSet movingPlatforms1DActive; /**< The awake 1D platforms. */
+    ActiveSet movingPlatforms2DActive; /**< The awake 2D platforms. */
+    ActiveSet switchingPlatformsActive; /**< The awake switching platforms (they switch even when hidden). */
+    ActiveSet weightPlatformsActive; /**< The awake weight platforms. */
+    ActiveSet treadmillsActive; /**< The awake treadmills. */
+    ActiveSet crushersActive; /**< The awake crushers. */
 
     // EVENTS
-    std::vector<Asteroid> asteroids; /**< Collection of Asteroid representing asteroids. */
+    AsteroidPool asteroids; /**< The asteroids, stored as a structure of arrays. */
 
     // LEVERS
     std::vector<TreadmillLever> treadmillLevers; /**< Collection of TreadmillLever representing treadmill levers. */
@@ -94,6 +127,14 @@ private:
     std::vector<Coin> coins; /**< Collection of Coin representing coins. */
     std::vector<Item*> items; /**< Collection of items. */
 
+    // HANDLES
+    static inline uint32_t nextGeneration = 1; /**< The next generation given to a collection (unique for every level). */
+    uint32_t generation = nextGeneration++; /**< The generation of the collections never modified after loading. */
+    uint32_t sizePowerUpGeneration = generation; /**< The generation of the sizePowerUp collection. */
+    uint32_t speedPowerUpGeneration = generation; /**< The generation of the speedPowerUp collection. */
+    uint32_t coinsGeneration = generation; /**< The generation of the coins collection. */
+    uint32_t itemsGeneration = generation; /**< The generation of the items collection. */
+
 
 public:
     /* CONSTRUCTORS */
@@ -138,28 +179,28 @@ public:
     /**
      * @brief Return the zones of a specific type.
      * @param type Represents the type of zone.
-     * @return A vector of Polygon.
+     * @return A reference to the vector of Polygon.
      */
-    [[nodiscard]] std::vector<Polygon> getZones(PolygonType type) const;
+    [[nodiscard]] const std::vector<Polygon> &getZones(PolygonType type) const;
 
     /**
      * @brief Return the zones of a specific type.
      * @param type Represents the type of zone.
-     * @return A vector of AABB.
+     * @return A reference to the vector of AABB.
      */
-    [[nodiscard]] std::vector<AABB> getZones(AABBType type) const;
+    [[nodiscard]] const std::vector<AABB> &getZones(AABBType type) const;
 
     /**
      * @brief Return the asteroids attribute.
-     * @return A vector of Asteroid.
+     * @return A reference to the AsteroidPool of the level.
      */
-    [[nodiscard]] std::vector<Asteroid> getAsteroids() const;
+    [[nodiscard]] AsteroidPool &getAsteroids();
 
     /**
      * @brief Return the treadmillLevers attribute.
      * @return A vector of TreadmillLever.
      */
-    [[nodiscard]] std::vector<TreadmillLever> getTreadmillLevers() const;
+    [[nodiscard]] std::vector<TreadmillLever>& getTreadmillLevers();
 
     /**
      * @brief Return the platformLevers attribute.
@@ -231,7 +272,7 @@ public:
      * @brief Return an Item from the items attribute.
      * @return An item.
      */
-    [[nodiscard]] std::vector<Item*> getItems() const;
+    [[nodiscard]] std::vector<Item*>& getItems();
 
     /**
      * @brief Return the last checkpoint reached by the player.
@@ -240,73 +281,149 @@ public:
     [[nodiscard]] short getLastCheckpoint() const;
 
 
-    /* MUTATORS */
-
     /**
-     * @brief Set the last checkpoint reached by the player.
-     * @param checkpoint Represents the last checkpoint reached by the player.
+     * @brief Return a zone from its handle.
+     * @param type Represents the type of zone.
+     * @param handle The handle of the zone.
+     * @return A pointer to the zone, nullptr if the handle is no longer valid.
      */
-    void setLastCheckpoint(short checkpoint);
+    [[nodiscard]] const Polygon *getZone(PolygonType type, Handle<Polygon> handle) const;
 
     /**
-     * @brief Set the asteroids attribute.
-     * @param value Represents the asteroids attribute.
+     * @brief Return a zone from its handle.
+     * @param type Represents the type of zone.
+     * @param handle The handle of the zone.
+     * @return A pointer to the zone, nullptr if the handle is no longer valid.
+     */
+    [[nodiscard]] const AABB *getZone(AABBType type, Handle<AABB> handle) const;
+
+    /**
+     * @brief Create a handle to an object of the level.
+     * @param index The index of the object in its collection.
+     * @return The handle of the object.
+     */
+    template<typename T>
+    [[nodiscard]] Handle<T> getHandle(size_t index) const {
+        return {static_cast<uint32_t>(index), getGeneration<T>()};
+    }
+
+    /**
+     * @brief Return an object of the level from its handle.
+     * @param handle The handle of the object.
+     * @return A pointer to the object, nullptr if the handle is no longer valid.
+     */
+    template<typename T>
+    [[nodiscard]] T *get(Handle<T> handle) {
+        if constexpr (std::is_same_v<T, Item>) {
+            if (handle.generation != itemsGeneration || handle.index >= items.size()) return nullptr;
+            return items[handle.index];
+        }
+        else if constexpr (std::is_same_v<T, TreadmillLever>) return resolveHandle(treadmillLevers, generation, handle);
+        else if constexpr (std::is_same_v<T, PlatformLever>) return resolveHandle(platformLevers, generation, handle);
+        else if constexpr (std::is_same_v<T, CrusherLever>) return resolveHandle(crusherLevers, generation, handle);
+        else if constexpr (std::is_same_v<T, MovingPlatform1D>) return resolveHandle(movingPlatforms1D, generation, handle);
+        else if constexpr (std::is_same_v<T, MovingPlatform2D>) return resolveHandle(movingPlatforms2D, generation, handle);
+        else if constexpr (std::is_same_v<T, SwitchingPlatform>) return resolveHandle(switchingPlatforms, generation, handle);
+        else if constexpr (std::is_same_v<T, WeightPlatform>) return resolveHandle(weightPlatforms, generation, handle);
+        else if constexpr (std::is_same_v<T, Treadmill>) return resolveHandle(treadmills, generation, handle);
+        else if constexpr (std::is_same_v<T, Crusher>) return resolveHandle(crushers, generation, handle);
+        else if constexpr (std::is_same_v<T, SizePowerUp>) return resolveHandle(sizePowerUp, sizePowerUpGeneration, handle);
+        else if constexpr (std::is_same_v<T, SpeedPowerUp>) return resolveHandle(speedPowerUp, speedPowerUpGeneration, handle);
+        else if constexpr (std::is_same_v<T, Coin>) return resolveHandle(coins, coinsGeneration, handle);
+        else static_assert(sizeof(T) == 0, "Level: No collection for this handle type");
+    }
+
+    /**
+     * @brief Return the tree indexing a collection of moving objects.
+     * @return The tree, its indices are the ones of the collection.
+     */
+    template<typename T>
+    [[nodiscard]] const DynamicAABBTree &getTree() const {
+        if constexpr (std::is_same_v<T, MovingPlatform1D>) return movingPlatforms1DTree;
+        else if constexpr (std::is_same_v<T, MovingPlatform2D>) return movingPlatforms2DTree;
+        else if constexpr (std::is_same_v<T, SwitchingPlatform>) return switchingPlatformsTree;
+        else if constexpr (std::is_same_v<T, WeightPlatform>) return weightPlatformsTree;
+        else if constexpr (std::is_same_v<T, Crusher>) return crushersTree;
+        else if constexpr (std::is_same_v<T, Treadmill>) return treadmillsTree;
+        else if constexpr (std::is_same_v<T, Asteroid>) return asteroidsTree;
+        else static_assert(sizeof(T) == 0, "Level: No tree for this type");
+    }
+
+    /**
+     * @brief Get the indices of the zones of a specific type that may overlap an area.
+     * @param type Represents the type of zone. (only collision and death zones are indexed)
+     * @param area The area to query.
+     * @param[out] result The indices of the zones in the collection returned by getZones().
+     */
+    void queryZones(PolygonType type, const SDL_FRect &area, std::vector<size_t> &result) const;
+
+    /**
+     * @brief Get the indices of the zones of a specific type that may overlap an area.
+     * @param type Represents the type of zone.
+     * @param area The area to query.
+     * @param[out] result The indices of the zones in the collection returned by getZones().
      */
-    void setAsteroids(const std::vector<Asteroid> &value);
+    void queryZones(AABBType type, const SDL_FRect &area, std::vector<size_t> &result) const;
 
     /**
-     * @brief Activate a lever from treadmillLevers.
-     * @param lever The lever to activate.
+     * @brief Get the indices of the treadmill levers that may overlap an area.
+     * @param area The area to query.
+     * @param[out] result The indices of the levers in treadmillLevers.
      */
-    void activateTreadmillLever(const TreadmillLever &lever);
+    void queryTreadmillLevers(const SDL_FRect &area, std::vector<size_t> &result) const;
 
     /**
-     * @brief Activate a lever from platformLevers.
-     * @param lever The lever to activate.
+     * @brief Get the indices of the platform levers that may overlap an area.
+     * @param area The area to query.
+     * @param[out] result The indices of the levers in platformLevers.
      */
-    void activatePlatformLever(const PlatformLever &lever);
+    void queryPlatformLevers(const SDL_FRect &area, std::vector<size_t> &result) const;
 
     /**
-     * @brief Activate a lever from crusherLevers.
-     * @param lever The lever to activate.
+     * @brief Get the indices of the crusher levers that may overlap an area.
+     * @param area The area to query.
+     * @param[out] result The indices of the levers in crusherLevers.
      */
-    void activateCrusherLever(const CrusherLever &lever);
+    void queryCrusherLevers(const SDL_FRect &area, std::vector<size_t> &result) const;
+
+
+    /* MUTATORS */
 
     /**
-     * @brief Increase the weight of a platform in weightPlatforms attribute.
-     * @param platform The platform to increase the weight.
+     * @brief Set the last checkpoint reached by the player.
+     * @param checkpoint Represents the last checkpoint reached by the player.
      */
-    void increaseWeightForPlatform(const WeightPlatform &platform);
+    void setLastCheckpoint(short checkpoint);
 
     /**
-     * @brief Decrease the weight of a platform in weightPlatforms attribute.
-     * @param platform The platform to decrease the weight.
+     * @brief Remove an asteroid, the last asteroid takes its index.
+     * @param index The index of the asteroid to remove.
      */
-    void decreaseWeightForPlatform(const WeightPlatform &platform);
+    void removeAsteroid(size_t index);
 
     /**
-     * @brief Remove an item from sizePowerUp attribute.
-     * @param item The item to remove.
+     * @brief Remove items from sizePowerUp attribute, the handles of the collection are invalidated once.
+     * @param indices The indices of the items to remove, sorted in descending order by the call.
      */
-    void removeItemFromSizePowerUp(SizePowerUp const &item);
+    void removeItemsFromSizePowerUp(std::vector<uint32_t> &indices);
 
     /**
-     * @brief Remove an item from speedPowerUp attribute.
-     * @param item The item to remove.
+     * @brief Remove items from speedPowerUp attribute, the handles of the collection are invalidated once.
+     * @param indices The indices of the items to remove, sorted in descending order by the call.
      */
-    void removeItemFromSpeedPowerUp(SpeedPowerUp const &item);
+    void removeItemsFromSpeedPowerUp(std::vector<uint32_t> &indices);
 
     /**
-     * @brief Remove an item from coins attribute.
-     * @param item The item to remove.
+     * @brief Remove items from coins attribute, the handles of the collection are invalidated once.
+     * @param indices The indices of the coins to remove, sorted in descending order by the call.
      */
-    void removeItemFromCoins(Coin const &item);
+    void removeItemsFromCoins(std::vector<uint32_t> &indices);
 
     /**
-     * @brief Remove an item.
-     * @param item The item to remove.
+     * @brief Remove items, the handles of the collection are invalidated once.
+     * @param indices The indices of the items to remove, sorted in descending order by the call.
      */
-    void removeItem(Item const &item);
+    void removeItems(std::vector<uint32_t> &indices);
 
 
     /* PUBLIC METHODS */
@@ -334,8 +451,9 @@ public:
     /**
      * @brief Generates a specified number of asteroids in the game.
      * @param nbAsteroid The number of asteroids must have in the game.
+     * @param camera The position of the camera, the asteroids spawn above it.
      */
-    void generateAsteroid(int nbAsteroid, Point camera, size_t seed);
+    void generateAsteroid(int nbAsteroid, Point camera);
 
     /**
      * @brief Add an asteroid received from network to the game.
@@ -343,6 +461,35 @@ public:
      */
     void addAsteroid(Asteroid const &asteroid);
 
+    /**
+     * @brief Show or hide a moving object, it is woken up or put to sleep in O(1).
+     * @param index The index of the object in its collection.
+     * @param state True if the object is in the broad phase area, false otherwise.
+     */
+    template<typename T>
+    void setIsOnScreen(size_t index, bool state) {
+        getCollection<T>()[index].setIsOnScreen(state);
+        refreshActivity<T>(index);
+    }
+
+    /**
+     * @brief Wake up or put to sleep the platforms linked to a lever, once the lever has been toggled.
+     * @param lever The lever.
+     */
+    void refreshActivity(const PlatformLever &lever);
+
+    /**
+     * @brief Wake up or put to sleep the crushers linked to a lever, once the lever has been toggled.
+     * @param lever The lever.
+     */
+    void refreshActivity(const CrusherLever &lever);
+
+    /**
+     * @brief Wake up or put to sleep the treadmills linked to a lever, once the lever has been toggled.
+     * @param lever The lever.
+     */
+    void refreshActivity(const TreadmillLever &lever);
+
     /**
      * @brief Disable or enable all platforms movement.
      */
@@ -382,74 +529,64 @@ public:
     void renderPolygonsDebug(SDL_Renderer *renderer, Point camera) const;
 
     /**
-     * @brief Renders asteroids by drawing sprites.
-     * @param renderer Represents the renderer of the game.
-     * @param camera Represents the camera of the game.
+     * @brief Records the asteroids by their sprites, with their motion during the tick.
+     * @param snapshot The snapshot recording the drawing of the tick.
      */
-    void renderAsteroids(SDL_Renderer *renderer, Point camera);
+    void renderAsteroids(RenderSnapshot &snapshot);
 
     /**
-     * @brief Renders asteroids by drawing collisions boxes.
-     * @param renderer Represents the renderer of the game.
-     * @param camera Represents the camera of the game.
+     * @brief Records the asteroids by their collisions boxes.
+     * @param snapshot The snapshot recording the drawing of the tick.
      */
-    void renderAsteroidsDebug(SDL_Renderer *renderer, Point camera) const;
+    void renderAsteroidsDebug(RenderSnapshot &snapshot) const;
 
     /**
-     * @brief Renders the levers by drawing textures.
-     * @param renderer Represents the renderer of the game.
-     * @param camera Represents the camera of the game.
+     * @brief Records the levers by their textures.
+     * @param snapshot The snapshot recording the drawing of the tick.
      */
-    void renderLevers(SDL_Renderer *renderer, Point camera) const;
+    void renderLevers(RenderSnapshot &snapshot) const;
 
     /**
-     * @brief Renders the levers by drawing collisions boxes.
-     * @param renderer Represents the renderer of the game.
-     * @param camera Represents the camera of the game.
+     * @brief Records the levers by their collisions boxes.
+     * @param snapshot The snapshot recording the drawing of the tick.
      */
-    void renderLeversDebug(SDL_Renderer *renderer, Point camera) const;
+    void renderLeversDebug(RenderSnapshot &snapshot) const;
 
     /**
-     * @brief Renders the platforms by drawing textures.
-     * @param renderer Represents the renderer of the game.
-     * @param camera Represents the camera of the game.
+     * @brief Records the platforms by their textures, with the motion of the awake ones during the tick.
+     * @param snapshot The snapshot recording the drawing of the tick.
      */
-    void renderPlatforms(SDL_Renderer *renderer, Point camera);
+    void renderPlatforms(RenderSnapshot &snapshot);
 
     /**
-     * @brief Renders the platforms by drawing collisions boxes.
-     * @param renderer Represents the renderer of the game.
-     * @param camera Represents the camera of the game.
+     * @brief Records the platforms by their collisions boxes.
+     * @param snapshot The snapshot recording the drawing of the tick.
      */
-    void renderPlatformsDebug(SDL_Renderer *renderer, Point camera) const;
+    void renderPlatformsDebug(RenderSnapshot &snapshot) const;
 
     /**
-     * @brief Renders the crushers by drawing textures.
-     * @param renderer Represents the renderer of the game.
-     * @param camera Represents the camera of the game.
+     * @brief Records the crushers by their textures, with the motion of the awake ones during the tick.
+     * @param snapshot The snapshot recording the drawing of the tick.
      */
-    void renderTraps(SDL_Renderer *renderer, Point camera) const;
+    void renderTraps(RenderSnapshot &snapshot) const;
 
     /**
-     * @brief Renders the crushers by drawing collisions boxes.
-     * @param renderer Represents the renderer of the game.
-     * @param camera Represents the camera of the game.
+     * @brief Records the crushers by their collisions boxes.
+     * @param snapshot The snapshot recording the drawing of the tick.
      */
-    void renderTrapsDebug(SDL_Renderer *renderer, Point camera) const;
+    void renderTrapsDebug(RenderSnapshot &snapshot) const;
 
     /**
-     * @brief Renders the items by sprites.
-     * @param renderer Represents the renderer of the game.
-     * @param camera Represents the camera of the game.
+     * @brief Records the items by their sprites.
+     * @param snapshot The snapshot recording the drawing of the tick.
      */
-    void renderItems(SDL_Renderer *renderer, Point camera);
+    void renderItems(RenderSnapshot &snapshot);
 
     /**
-     * @brief Renders the items by drawing rectangles.
-     * @param renderer Represents the renderer of the game.
-     * @param camera Represents the camera of the game.
+     * @brief Records the items by rectangles.
+     * @param snapshot The snapshot recording the drawing of the tick.
      */
-    void renderItemsDebug(SDL_Renderer *renderer, Point camera) const;
+    void renderItemsDebug(RenderSnapshot &snapshot) const;
 
 
 private:
@@ -517,6 +654,91 @@ private:
      */
     void loadItemsFromMap(const std::string &map_file_name);
 
+    /**
+     * @brief Build the uniform grids indexing the static geometry of the level (zones and levers).
+     */
+    void buildSpatialIndex();
+
+    /**
+     * @brief Build the trees indexing the moving objects of the level (platforms, treadmills and crushers) and their active sets.
+     */
+    void buildDynamicIndex();
+
+    /**
+     * @brief Return the collection storing a type of moving object.
+     * @return The collection.
+     */
+    template<typename T>
+    [[nodiscard]] std::vector<T> &getCollection() {
+        if constexpr (std::is_same_v<T, MovingPlatform1D>) return movingPlatforms1D;
+        else if constexpr (std::is_same_v<T, MovingPlatform2D>) return movingPlatforms2D;
+        else if constexpr (std::is_same_v<T, SwitchingPlatform>) return switchingPlatforms;
+        else if constexpr (std::is_same_v<T, WeightPlatform>) return weightPlatforms;
+        else if constexpr (std::is_same_v<T, Treadmill>) return treadmills;
+        else if constexpr (std::is_same_v<T, Crusher>) return crushers;
+        else static_assert(sizeof(T) == 0, "Level: No collection for this type");
+    }
+
+    /**
+     * @brief Return the set of the awake objects of a collection.
+     * @return The active set, its indices are the ones of the collection.
+     */
+    template<typename T>
+    [[nodiscard]] ActiveSet &getActiveSet() {
+        if constexpr (std::is_same_v<T, MovingPlatform1D>) return movingPlatforms1DActive;
+        else if constexpr (std::is_same_v<T, MovingPlatform2D>) return movingPlatforms2DActive;
+        else if constexpr (std::is_same_v<T, SwitchingPlatform>) return switchingPlatformsActive;
+        else if constexpr (std::is_same_v<T, WeightPlatform>) return weightPlatformsActive;
+        else if constexpr (std::is_same_v<T, Treadmill>) return treadmillsActive;
+        else if constexpr (std::is_same_v<T, Crusher>) return crushersActive;
+        else static_assert(sizeof(T) == 0, "Level: No active set for this type");
+    }
+
+    /**
+     * @brief Wake up an object if it moves and is on screen, put it to sleep otherwise.
+     * @param index The index of the object in its collection.
+     * @note A switching platform only needs to move, it follows its beat even when it is hidden.
+     *       An object put to sleep is updated one last time, so it does not keep the movement of its last tick.
+     */
+    template<typename T>
+    void refreshActivity(size_t index) {
+        T &object = getCollection<T>()[index];
+        ActiveSet &active = getActiveSet<T>();
+
+        bool awake = object.getIsMoving() && (std::is_same_v<T, SwitchingPlatform> || object.getIsOnScreen());
+        if (awake) {
+            // No interpolation from the position it had when it fell asleep (treadmills never move)
+            if (active.insert(index)) {
+                if constexpr (!std::is_same_v<T, Treadmill>) object.savePreviousPosition();
+            }
+        } else if (active.erase(index)) {
+            if constexpr (std::is_same_v<T, Treadmill>) object.calculateMovement(0);
+            else object.applyMovement(0);
+        }
+    }
+
+    /**
+     * @brief Rebuild the active set of a collection from the state of every object.
+     */
+    template<typename T>
+    void rebuildActiveSet() {
+        getActiveSet<T>().reset(getCollection<T>().size());
+        for (size_t i = 0; i < getCollection<T>().size(); i++) refreshActivity<T>(i);
+    }
+
+    /**
+     * @brief Return the current generation of the collection storing a type of object.
+     * @return The generation of the collection.
+     */
+    template<typename T>
+    [[nodiscard]] uint32_t getGeneration() const {
+        if constexpr (std::is_same_v<T, SizePowerUp>) return sizePowerUpGeneration;
+        else if constexpr (std::is_same_v<T, SpeedPowerUp>) return speedPowerUpGeneration;
+        else if constexpr (std::is_same_v<T, Coin>) return coinsGeneration;
+        else if constexpr (std::is_same_v<T, Item>) return itemsGeneration;
+        else return generation;
+    }
+
 
 };
 
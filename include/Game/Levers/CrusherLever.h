@@ -36,6 +36,15 @@ public:
     CrusherLever(float x, float y, float size, bool is_activated, const Texture& texture, const std::vector<Crusher*> &crushers);
 
 
+    /* ACCESSORS */
+
+    /**
+     * @brief Return the crushers attribute.
+     * @return The crushers affected by the lever.
+     */
+    [[nodiscard]] const std::vector<Crusher*> &getCrushers() const;
+
+
 private:
 
     /* METHODS */
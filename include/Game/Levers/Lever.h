@@ -3,6 +3,7 @@
 
 #include <SDL_rect.h>
 #include "../../Graphics/Texture.h"
+#include "../../Graphics/RenderSnapshot.h"
 #include "../../Sounds/SoundEffect.h"
 
 /**
@@ -108,17 +109,15 @@ public:
 
     /**
      * @brief Render the lever by drawing its texture.
-     * @param renderer The renderer used to render the lever.
-     * @param camera The camera used to render the lever.
+     * @param snapshot The snapshot recording the drawing of the tick.
      */
-    void render(SDL_Renderer *renderer, Point camera) const;
+    void render(RenderSnapshot &snapshot) const;
 
     /**
      * @brief Renders the lver by its drawing its collision box.
-     * @param renderer Represents the renderer of the game.
-     * @param camera Represents the camera of the game.
+     * @param snapshot The snapshot recording the drawing of the tick.
      */
-    void renderDebug(SDL_Renderer *renderer, Point camera) const;
+    void renderDebug(RenderSnapshot &snapshot) const;
 
 
 private:
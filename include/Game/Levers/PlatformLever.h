@@ -24,6 +24,21 @@ public:
     PlatformLever(float x, float y, float size, bool is_activated, const Texture& texture, const std::vector<MovingPlatform1D*> &platforms1D, const std::vector<MovingPlatform2D*> &platforms2D);
 
 
+    /* ACCESSORS */
+
+    /**
+     * @brief Return the movingPlatform1D attribute.
+     * @return The 1D moving platforms affected by the lever.
+     */
+    [[nodiscard]] const std::vector<MovingPlatform1D*> &getMovingPlatforms1D() const;
+
+    /**
+     * @brief Return the movingPlatform2D attribute.
+     * @return The 2D moving platforms affected by the lever.
+     */
+    [[nodiscard]] const std::vector<MovingPlatform2D*> &getMovingPlatforms2D() const;
+
+
 private:
 
     /* METHODS */
@@ -28,6 +28,15 @@ public:
     TreadmillLever(float x, float y, float size, bool is_activated, int type, const Texture& texture, const std::vector<Treadmill*> &treadmills);
 
 
+    /* ACCESSORS */
+
+    /**
+     * @brief Return the treadmills attribute.
+     * @return The treadmills affected by the lever.
+     */
+    [[nodiscard]] const std::vector<Treadmill*> &getTreadmills() const;
+
+
 private:
 
     /* METHODS */
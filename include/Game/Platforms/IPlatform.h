@@ -8,6 +8,7 @@
 #include <cmath>
 #include "../Point.h"
 #include "../../Graphics/Texture.h"
+#include "../../Graphics/RenderSnapshot.h"
 
 /**
  * @file Platform.h
@@ -36,6 +37,7 @@ public:
     [[nodiscard]] virtual float getW() const = 0;
     [[nodiscard]] virtual float getH() const = 0;
     [[nodiscard]] virtual bool getIsMoving() const = 0;
+    [[nodiscard]] virtual bool getIsOnScreen() const = 0;
     [[nodiscard]] virtual SDL_FRect getBoundingBox() const = 0;
 
     // MODIFIERS
@@ -44,8 +46,8 @@ public:
 
     // METHODS
     virtual void applyMovement(double delta_time) = 0;
-    virtual void render(SDL_Renderer *renderer, Point camera) const = 0;
-    virtual void renderDebug(SDL_Renderer *renderer, Point camera) const = 0;
+    virtual void render(RenderSnapshot &snapshot) const = 0;
+    virtual void renderDebug(RenderSnapshot &snapshot) const = 0;
 
 };
 
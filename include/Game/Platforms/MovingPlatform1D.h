@@ -23,6 +23,7 @@ private:
 
     float x; /**< The x-coordinate of the platform's position. */
     float y; /**< The y-coordinate of the platform's position. */
+    Point previousPosition = {x, y}; /**< The position of the platform at the previous simulation tick, used to interpolate the rendering. */
     float w; /**< The width of the platform. (in pixels) */
     float h; /**< The height of the platform. */
     float size; /**< The size of the platform. */
@@ -62,6 +63,12 @@ public:
      */
     [[nodiscard]] float getY() const override;
 
+    /**
+     * @brief Return the previousPosition attribute.
+     * @return The position of the platform at the previous simulation tick.
+     */
+    [[nodiscard]] Point getPreviousPosition() const;
+
     /**
      * @brief Return the weight attribute.
      * @return The value of the weight attribute.
@@ -98,6 +105,12 @@ public:
      */
     [[nodiscard]] bool getIsMoving() const override;
 
+    /**
+     * @brief Return the isOnScreen attribute.
+     * @return The value of the isOnScreen attribute.
+     */
+    [[nodiscard]] bool getIsOnScreen() const override;
+
     /**
      * @brief Get the bounding box of the platform.
      * @return SDL_Rect representing the platform box.
@@ -152,6 +165,11 @@ public:
 
     /* PUBLIC METHODS */
 
+    /**
+     * @brief Save the current position as the position of the previous simulation tick.
+     */
+    void savePreviousPosition();
+
     /**
      * @brief Selects whether to calculate x- or y-axis movement.
      * @param delta_time The time elapsed since the last frame in seconds.
@@ -161,17 +179,15 @@ public:
 
     /**
      * @brief Renders the platforms by drawing its textures.
-     * @param renderer Represents the renderer of the game.
-     * @param camera Represents the camera of the game.
+     * @param snapshot The snapshot recording the drawing of the tick.
      */
-    void render(SDL_Renderer *renderer, Point camera) const override;
+    void render(RenderSnapshot &snapshot) const override;
 
     /**
      * @brief Renders the platforms by its drawing its collision box.
-     * @param renderer Represents the renderer of the game.
-     * @param camera Represents the camera of the game.
+     * @param snapshot The snapshot recording the drawing of the tick.
      */
-    void renderDebug(SDL_Renderer *renderer, Point camera) const override;
+    void renderDebug(RenderSnapshot &snapshot) const override;
 
 
 private:
@@ -6,6 +6,7 @@
 #include <ranges>
 #include <vector>
 #include "IPlatform.h"
+#include "../../Utils/SimulationClock.h"
 
 /**
  * @file SwitchingPlatform.h
@@ -22,11 +23,12 @@ private:
 
     float x; /**< The x-coordinate of the platform's position. */
     float y; /**< The y-coordinate of the platform's position. */
+    Point previousPosition = {x, y}; /**< The position of the platform at the previous simulation tick, used to interpolate the rendering. */
     float w; /**< The width of the platform. (in pixels) */
     float h; /**< The height of the platform. */
     float size; /**< The size of the platform. */
     double bpm; /**< The beat per minute of the platform. */
-    Uint32 startTime = SDL_GetTicks(); /**< The time set at the beginning of every beat */
+    Uint32 startTime = SimulationClock::getTicks(); /**< The time set at the beginning of every beat */
     int actualPoint = 0; /**< The current point the platform's position. */
     std::vector<Point> steps; /** Collection of Point representing every possible position of the platform. */
     bool isMoving = true; /** Flag indicating if the platform is currently moving. */
@@ -56,6 +58,12 @@ public:
      */
     [[nodiscard]] float getY() const override;
 
+    /**
+     * @brief Return the previousPosition attribute.
+     * @return The position of the platform at the previous simulation tick.
+     */
+    [[nodiscard]] Point getPreviousPosition() const;
+
     /**
      * @brief Return the weight attribute.
      * @return The value of the weight attribute.
@@ -74,6 +82,12 @@ public:
      */
     [[nodiscard]] bool getIsMoving() const override;
 
+    /**
+     * @brief Return the isOnScreen attribute.
+     * @return The value of the isOnScreen attribute.
+     */
+    [[nodiscard]] bool getIsOnScreen() const override;
+
     /**
      * @brief Get the bounding box of the platform.
      * @return SDL_Rect representing the platform box.
@@ -98,6 +112,11 @@ public:
 
     /* PUBLIC METHODS */
 
+    /**
+     * @brief Save the current position as the position of the previous simulation tick.
+     */
+    void savePreviousPosition();
+
     /**
      * @brief Calculate the new position of the platform according to its bpm.
      */
@@ -105,17 +124,15 @@ public:
 
     /**
      * @brief Renders the platforms by drawing its textures.
-     * @param renderer Represents the renderer of the game.
-     * @param camera Represents the camera of the game.
+     * @param snapshot The snapshot recording the drawing of the tick.
      */
-    void render(SDL_Renderer *renderer, Point camera) const override;
+    void render(RenderSnapshot &snapshot) const override;
 
     /**
      * @brief Renders the platforms by its drawing its collision box.
-     * @param renderer Represents the renderer of the game.
-     * @param camera Represents the camera of the game.
+     * @param snapshot The snapshot recording the drawing of the tick.
      */
-    void renderDebug(SDL_Renderer *renderer, Point camera) const override;
+    void renderDebug(RenderSnapshot &snapshot) const override;
 
 };
 
@@ -97,6 +97,12 @@ public:
      */
     [[nodiscard]] bool getIsMoving() const;
 
+    /**
+     * @brief Return the isOnScreen attribute.
+     * @return The value of the isOnScreen attribute.
+     */
+    [[nodiscard]] bool getIsOnScreen() const;
+
     /**
      * @brief Get the bounding box of the platform.
      * @return SDL_Rect representing the platform box.
@@ -125,10 +131,10 @@ public:
     void setIsOnScreen(bool state);
 
     /**
-     * @brief Set the texture of the treadmill.
-     * @param texturePtr The new texture of the treadmill.
+     * @brief Set the texture of the treadmills, the size of a frame is deduced from it.
+     * @param texture The new texture of the treadmills (only its size if the textures are not loaded).
      */
-    static void setTexture(SDL_Texture *texturePtr);
+    static void setTexture(const Texture &texture);
 
 
     /* METHODS */
@@ -141,17 +147,15 @@ public:
 
     /**
      * @brief Renders the treadmill by drawing its sprite.
-     * @param renderer Represents the renderer of the game.
-     * @param camera Represents the camera of the game.
+     * @param snapshot The snapshot recording the drawing of the tick.
      */
-    void render(SDL_Renderer *renderer, Point camera);
+    void render(RenderSnapshot &snapshot);
 
     /**
      * @brief Renders the treadmill by its drawing its collision box.
-     * @param renderer Represents the renderer of the game.
-     * @param camera Represents the camera of the game.
+     * @param snapshot The snapshot recording the drawing of the tick.
      */
-    void renderDebug(SDL_Renderer *renderer, Point camera) const;
+    void renderDebug(RenderSnapshot &snapshot) const;
 
 };
 
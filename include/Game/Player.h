@@ -7,8 +7,12 @@
 #include <chrono>
 #include <iostream>
 #include "Point.h"
+#include "../Physics/Quad.h"
+#include "../Physics/TriggerSet.h"
 #include "../Graphics/Animation.h"
 #include "../Graphics/Sprite.h"
+#include "../Graphics/RenderSnapshot.h"
+#include "../Utils/SimulationClock.h"
 
 /**
  * @file Player.h
@@ -34,6 +38,7 @@ private:
     // CHARACTERISTIC ATTRIBUTES
     float x; /**< The x-coordinate of the player's position. (in pixels) */
     float y; /**< The y-coordinate of the player's position. */
+    Point previousPosition = {x, y}; /**< The position of the player at the previous simulation tick, used to interpolate the rendering. */
     float width; /**< The width of the player. (in pixels) */
     float height; /**< The height of the player. */
     float size = 2; /**< The size of the player. */
@@ -72,7 +77,7 @@ private:
     float directionY = 0; /**< Current vertical direction of the player (-1 for up, 1 for down, 0 for no movement). */
     bool isGrounded = false; /**< Flag indicating whether the player is currently on a ground. */
     bool isJumping = false; /**< Flag indicating whether the player is currently in a jump. */
-    Uint32 lastTimeOnPlatform = SDL_GetTicks(); /**< Timestamp of the last time the player was on a platform. */
+    Uint32 lastTimeOnPlatform = SimulationClock::getTicks(); /**< Timestamp of the last time the player was on a platform. */
     float jumpInitialVelocity = 525.f; /**< Initial velocity of the player's jump. */
     float jumpMaxHeight = 100.f; /**< Maximum height of the player's jump. */
     float maxFallSpeed = 600.f; /**< Maximum falling speed of the player. */
@@ -80,7 +85,7 @@ private:
     float coyoteTime = 0.15f; /**< Time window in seconds during which the player can still jump after starting to fall. */
     float jumpStartHeight = 0; /**< Current height of the player's jump. */
     float jumpVelocity = 0; /**< Current velocity of the player's jump. */
-    size_t currentZoneID = 0; /**< The ID of the current zone the player is in. */
+    TriggerSet triggers; /**< The trigger zones overlapped by the player, updated once per tick. */
     bool isOnPlatform = false; /**< Flag indicating whether the player is currently on a weight platform. */
     bool wasOnPlatform = false; /**< Flag indicating whether the player was on a weight platform during the last frame. */
 
@@ -182,6 +187,12 @@ public:
      */
     [[nodiscard]] float getY() const;
 
+    /**
+     * @brief Return the previousPosition attribute.
+     * @return The position of the player at the previous simulation tick.
+     */
+    [[nodiscard]] Point getPreviousPosition() const;
+
     /**
      * @brief Return the weight attribute.
      * @return The value of the weight attribute.
@@ -236,6 +247,12 @@ public:
      */
     [[nodiscard]] float getMoveY() const;
 
+    /**
+     * @brief Return the buffer attribute.
+     * @return The part of the network correction not applied yet.
+     */
+    [[nodiscard]] Buffer getBuffer() const;
+
     /**
      * @brief Return the currentDirection attribute.
      * @return The value of the currentDirection attribute (-1 for left, 1 for right)
@@ -291,10 +308,10 @@ public:
     [[nodiscard]] bool getIsJumping() const;
 
     /**
-     * @brief Return the id of the current zone in which the player is.
-     * @return The current zone ID.
+     * @brief Return the trigger zones overlapped by the player.
+     * @return A reference to the TriggerSet of the player.
      */
-    [[nodiscard]] size_t getCurrentZoneID() const;
+    [[nodiscard]] TriggerSet &getTriggers();
 
     /**
      * @brief Return the isOnPlatform attribute.
@@ -320,43 +337,43 @@ public:
 
     /**
      * @brief Gets the vertices of the player's bounding box.
-     * @return A vector of Point representing the vertices.
+     * @return A Quad representing the vertices.
      */
-    [[nodiscard]] std::vector<Point> getVertices() const;
+    [[nodiscard]] Quad getVertices() const;
 
     /**
      * @brief Gets the vertices of the player's bounding box of the next frame.
-     * @return A vector of Point representing the vertices of the next frame.
+     * @return A Quad representing the vertices of the next frame.
      */
-    [[nodiscard]] std::vector<Point> getVerticesNextFrame() const;
+    [[nodiscard]] Quad getVerticesNextFrame() const;
 
     /**
      * @brief Gets the vertices of the player's horizontal collider, based on its current direction.
-     * @return A vector of Point representing the vertices.
+     * @return A Quad representing the vertices.
      * @see getLeftColliderVertices() and getRightColliderVertices() for detailed usage.
      */
-    [[nodiscard]] std::vector<Point> getHorizontalColliderVertices() const;
+    [[nodiscard]] Quad getHorizontalColliderVertices() const;
 
     /**
      * @brief Gets the vertices of the player's ground collider.
-     * @return A vector of Point representing the vertices.
+     * @return A Quad representing the vertices.
      * @see getGroundColliderBoundingBox() to get the bounding box of the ground collider.
      */
-    [[nodiscard]] std::vector<Point> getGroundColliderVertices() const;
+    [[nodiscard]] Quad getGroundColliderVertices() const;
 
     /**
      * @brief Gets the vertices of the player's roof collider.
-     * @return A vector of Point representing the vertices.
+     * @return A Quad representing the vertices.
      * @see getRoofColliderBoundingBox() to get the bounding box of the roof collider.
      */
-    [[nodiscard]] std::vector<Point> getRoofColliderVertices() const;
+    [[nodiscard]] Quad getRoofColliderVertices() const;
 
     /**
      * @brief Gets the vertices of the player's hit zone.
-     * @return A vector of Point representing the vertices.
+     * @return A Quad representing the vertices.
      * @see getHitZoneBoundingBox() to get the bounding box of the hit zone.
      */
-    [[nodiscard]] std::vector<Point> getHitZoneVertices() const;
+    [[nodiscard]] Quad getHitZoneVertices() const;
 
     /**
      * @brief Gets the horizontal collider bounding box of the player's, based on its current direction.
@@ -393,6 +410,13 @@ public:
      */
     [[nodiscard]] SDL_FRect getBoundingBox() const;
 
+    /**
+     * @brief Gets the bounding box of the player at the start of its last move.
+     * @return SDL_Rect representing the bounding box before the move of this frame.
+     * @see getBoundingBox() to get the bounding box once the player moved.
+     */
+    [[nodiscard]] SDL_FRect getBoundingBoxPreviousMove() const;
+
     /**
      * @brief Gets the bounding box of the player of the next frame.
      * @return SDL_Rect representing the bounding box of the next frame.
@@ -527,12 +551,6 @@ public:
     */
     void setSpriteID(short id);
 
-    /**
-     * @brief Set the current zone ID of the player.
-     * @param id The zone ID to set.
-     */
-    void setCurrentZoneID(size_t id);
-
     /**
      * @brief Set the isOnPlatform attribute.
      * @param state The new value of the isOnPlatform attribute.
@@ -598,6 +616,11 @@ public:
 
     /* PUBLIC METHODS */
 
+    /**
+     * @brief Save the current position as the position of the previous simulation tick.
+     */
+    void savePreviousPosition();
+
     /**
      * @brief Sets the player's sprite texture to the default texture.
      */
@@ -701,24 +724,21 @@ public:
 
     /**
      * @brief Renders the player's sprite.
-     * @param renderer Represents the renderer of the game.
-     * @param camera Represents the camera of the game.
+     * @param snapshot The snapshot recording the drawing of the tick.
      */
-    void render(SDL_Renderer *renderer, Point camera);
+    void render(RenderSnapshot &snapshot);
 
     /**
      * @brief Renders the player's box, used for debugging.
-     * @param renderer Represents the renderer of the game.
-     * @param camera Represents the camera of the game.
+     * @param snapshot The snapshot recording the drawing of the tick.
      */
-    void renderDebug(SDL_Renderer *renderer, Point camera) const;
+    void renderDebug(RenderSnapshot &snapshot) const;
 
     /**
      * @brief Renders the player's colliders, used for debugging.
-     * @param renderer Represents the renderer of the game.
-     * @param camera Represents the camera of the game.
+     * @param snapshot The snapshot recording the drawing of the tick.
      */
-    void renderColliders(SDL_Renderer *renderer, Point camera) const;
+    void renderColliders(RenderSnapshot &snapshot) const;
 
 
 private:
@@ -727,17 +747,17 @@ private:
 
     /**
      * @brief Gets the vertices of the player's left collider.
-     * @return A vector of Point representing the vertices.
+     * @return A Quad representing the vertices.
      * @see getHorizontalColliderVertices() for main use.
      */
-    [[nodiscard]] std::vector<Point> getLeftColliderVertices() const;
+    [[nodiscard]] Quad getLeftColliderVertices() const;
 
     /**
      * @brief Gets the vertices of the player's right collider.
-     * @return A vector of Point representing the vertices.
+     * @return A Quad representing the vertices.
      * @see getHorizontalColliderVertices() for main use.
      */
-    [[nodiscard]] std::vector<Point> getRightColliderVertices() const;
+    [[nodiscard]] Quad getRightColliderVertices() const;
 
     /**
      * @brief Gets the bounding box of the player's left collider.
@@ -0,0 +1,171 @@
+#ifndef PLAY_TOGETHER_PLAYERSLOTMAP_H
+#define PLAY_TOGETHER_PLAYERSLOTMAP_H
+
+#include <deque>
+#include <vector>
+#include <array>
+#include <ranges>
+#include <cstdint>
+#include <unordered_map>
+#include "Player.h"
+
+/**
+ * @file PlayerSlotMap.h
+ * @brief Defines the PlayerSlotMap class storing the players in stable slots.
+ */
+
+/**
+ * @enum PlayerState
+ * @brief The lifecycle state of a player.
+ */
+enum class PlayerState {
+    ALIVE, /**< The player is playing. */
+    NEUTRAL, /**< The player is dying or respawning, its animation decides its next state. */
+    DEAD /**< The player waits in the rescue zone to be respawned. */
+};
+
+/**
+ * @struct SlotPlayer
+ * @brief Resolve the index of a slot of a PlayerSlotMap to its player.
+ */
+template<typename Storage>
+struct SlotPlayer {
+    Storage *players = nullptr; /**< The slots of the map. */
+
+    auto &operator()(uint32_t slot) const { return (*players)[slot]; }
+};
+
+/**
+ * @class PlayerSlotMap
+ * @brief Stores every player in a slot that never moves, with its lifecycle state.
+ *
+ * A player keeps its slot (and its address) from insert() to erase(), a changed state only moves the index of the
+ * slot from a state list to another (swap and pop), so every operation costs O(1). The views iterate the players of
+ * a state, their order is not the order of insertion.
+ */
+class PlayerSlotMap {
+public:
+    /* TYPES */
+
+    using View = std::ranges::transform_view<std::ranges::ref_view<const std::vector<uint32_t>>, SlotPlayer<std::deque<Player>>>; /**< The players of a state. */
+    using ConstView = std::ranges::transform_view<std::ranges::ref_view<const std::vector<uint32_t>>, SlotPlayer<const std::deque<Player>>>; /**< The players of a state, read only. */
+
+
+private:
+    /* TYPES */
+
+    /**
+     * @struct Slot
+     * @brief The state of a slot.
+     */
+    struct Slot {
+        PlayerState state = PlayerState::ALIVE; /**< The state of the player. */
+        uint32_t position = 0; /**< The position of the slot in the list of its state. */
+    };
+
+
+    /* ATTRIBUTES */
+
+    std::deque<Player> players; /**< The players, a deque never moves its elements when it grows. */
+    std::vector<Slot> slots; /**< The state of each slot. */
+    std::array<std::vector<uint32_t>, 3> lists; /**< The indices of the slots of each state. */
+    std::vector<uint32_t> freeSlots; /**< The indices of the unused slots. */
+    std::unordered_map<int, uint32_t> slotsById; /**< The slot of each player id. */
+
+
+public:
+    /* ACCESSORS */
+
+    /**
+     * @brief Get the players of a state.
+     * @param state The state of the players.
+     * @return A view of the players, invalidated when a player enters or leaves the state.
+     */
+    [[nodiscard]] View view(PlayerState state);
+
+    /**
+     * @brief Get the players of a state.
+     * @param state The state of the players.
+     * @return A read only view of the players, invalidated when a player enters or leaves the state.
+     */
+    [[nodiscard]] ConstView view(PlayerState state) const;
+
+    /**
+     * @brief Get the number of players of a state.
+     * @param state The state of the players.
+     * @return The number of players.
+     */
+    [[nodiscard]] size_t count(PlayerState state) const;
+
+    /**
+     * @brief Get the player with the given id.
+     * @param id The id of the player.
+     * @return A pointer to the player, valid until it is erased, nullptr if there is no such player.
+     */
+    [[nodiscard]] Player *find(int id);
+
+    /**
+     * @brief Get the state of a player.
+     * @param player A player of the map.
+     * @return The state of the player.
+     */
+    [[nodiscard]] PlayerState getState(const Player &player) const;
+
+    /**
+     * @brief Get the position of a player in the view of its state.
+     * @param player A player of the map.
+     * @return The position of the player.
+     */
+    [[nodiscard]] size_t getPosition(const Player &player) const;
+
+
+    /* MODIFIERS */
+
+    /**
+     * @brief Change the state of a player.
+     * @param player A player of the map.
+     * @param state The new state of the player.
+     */
+    void setState(const Player &player, PlayerState state);
+
+
+    /* METHODS */
+
+    /**
+     * @brief Add a player in a free slot.
+     * @param player The player to add, it replaces the player with the same id.
+     * @param state The state of the player.
+     * @return A reference to the stored player.
+     */
+    Player &insert(const Player &player, PlayerState state);
+
+    /**
+     * @brief Remove a player, its slot is reused by the next insertion.
+     * @param id The id of the player.
+     */
+    void erase(int id);
+
+    /**
+     * @brief Remove every player.
+     */
+    void clear();
+
+
+private:
+    /* SUB METHODS */
+
+    /**
+     * @brief Remove a slot from the list of its state, the last slot of the list takes its position.
+     * @param slot The index of the slot.
+     */
+    void unlink(uint32_t slot);
+
+    /**
+     * @brief Add a slot at the end of the list of a state.
+     * @param slot The index of the slot.
+     * @param state The state of the slot.
+     */
+    void link(uint32_t slot, PlayerState state);
+};
+
+#endif //PLAY_TOGETHER_PLAYERSLOTMAP_H
@@ -10,5 +10,17 @@ struct Point {
     float y; /**< The y-coordinate of the point. */
 };
 
+/**
+ * @brief Shift a camera so an object is drawn between its position at the previous simulation tick and its current one.
+ * @param camera The rendering point of the camera.
+ * @param previous The position of the object at the previous simulation tick.
+ * @param current The current position of the object.
+ * @param alpha The fraction of the simulation step elapsed since the last tick, between 0 and 1.
+ * @return The rendering point to give to the render method of the object.
+ */
+inline Point interpolateCamera(Point camera, Point previous, Point current, float alpha) {
+    return {camera.x + (1 - alpha) * (current.x - previous.x), camera.y + (1 - alpha) * (current.y - previous.y)};
+}
+
 #endif //PLAY_TOGETHER_POINT_H
 
@@ -3,7 +3,9 @@
 
 #include <cmath>
 #include "../../Graphics/Texture.h"
+#include "../../Graphics/RenderSnapshot.h"
 #include "../Point.h"
+#include "../../Utils/SimulationClock.h"
 #include "../../Sounds/SoundEffect.h"
 
 struct CrusherBuffer {
@@ -17,6 +19,7 @@ private:
     // CHARACTERISTICS ATTRIBUTES
     float x; /**< The x-coordinate of the crusher's position. */
     float y; /**< The y-coordinate of the crusher's position. */
+    Point previousPosition = {x, y}; /**< The position of the crusher at the previous simulation tick, used to interpolate the rendering. */
     float w; /**< The width of the crusher. (in pixels) */
     float h; /**< The height of the crusher. */
     float size; /**< The size of the crusher. */
@@ -31,7 +34,7 @@ private:
 
     // TIME ATTRIBUTES
     int timer = 0; /**< The timer of the crusher. */
-    Uint32 lastUpdate = SDL_GetTicks(); /**< The last time the crusher was updated. */
+    Uint32 lastUpdate = SimulationClock::getTicks(); /**< The last time the crusher was updated. */
     const Uint32 moveUpTime; /**< The time the crusher will take to move up in seconds. */
     const Uint32 waitUpTime; /**< The time to wait up before going down in milliseconds. */
     const Uint32 waitDownTime; /**< The time to wait down before going up in milliseconds. */
@@ -62,6 +65,12 @@ public:
      */
     [[nodiscard]] float getY() const;
 
+    /**
+     * @brief Return the previousPosition attribute.
+     * @return The position of the crusher at the previous simulation tick.
+     */
+    [[nodiscard]] Point getPreviousPosition() const;
+
     /**
      * @brief Return the weight attribute.
      * @return The value of the weight attribute.
@@ -152,6 +161,11 @@ public:
 
     /* METHODS */
 
+    /**
+     * @brief Save the current position as the position of the previous simulation tick.
+     */
+    void savePreviousPosition();
+
     /**
      * @brief Calculate the new position of the crusher according.
      * @param delta_time Represents the time elapsed since the last update.
@@ -162,17 +176,15 @@ public:
 
     /**
      * @brief Renders the crusher by drawing its textures.
-     * @param renderer Represents the renderer of the game.
-     * @param camera Represents the camera of the game.
+     * @param snapshot The snapshot recording the drawing of the tick.
      */
-    void render(SDL_Renderer *renderer, Point camera) const;
+    void render(RenderSnapshot &snapshot) const;
 
     /**
      * @brief Renders the crusher by its drawing its collision box.
-     * @param renderer Represents the renderer of the game.
-     * @param camera Represents the camera of the game.
+     * @param snapshot The snapshot recording the drawing of the tick.
      */
-    void renderDebug(SDL_Renderer *renderer, Point camera) const;
+    void renderDebug(RenderSnapshot &snapshot) const;
 
 
 private:
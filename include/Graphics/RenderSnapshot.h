@@ -0,0 +1,120 @@
+#ifndef PLAY_TOGETHER_RENDERSNAPSHOT_H
+#define PLAY_TOGETHER_RENDERSNAPSHOT_H
+
+#include <SDL.h>
+#include <vector>
+#include "../Game/Point.h"
+
+
+/**
+ * @file RenderSnapshot.h
+ * @brief Defines the RenderSnapshot class recording the drawing of a simulation tick.
+ */
+
+/**
+ * @class RenderSnapshot
+ * @brief Draw calls recorded in world coordinates by the simulation thread and replayed by the thread owning the renderer.
+ *
+ * The objects record their textures, animation frames, flips and positions once a tick is simulated, so the rendering
+ * never reads the objects while the next tick moves them. Like the SDL renderer, the snapshot keeps a current draw
+ * color and a current motion, the motion being the displacement of the object during the tick: the replay draws
+ * every call between the previous position and the recorded one.
+ */
+class RenderSnapshot {
+private:
+    /* TYPES */
+
+    /**
+     * @enum DrawType
+     * @brief The SDL call replayed by a command.
+     */
+    enum class DrawType {
+        COPY, /**< SDL_RenderCopyExF of a texture. */
+        FILL_RECT, /**< SDL_RenderFillRectF with the color of the command. */
+        DRAW_LINE /**< SDL_RenderDrawLineF with the color of the command, from (x, y) to (w, h). */
+    };
+
+    /**
+     * @struct DrawCommand
+     * @brief A recorded draw call.
+     */
+    struct DrawCommand {
+        DrawType type; /**< The SDL call to replay. */
+        SDL_Color color; /**< The draw color of a rectangle or a line. */
+        SDL_Texture *texture; /**< The texture to copy, nullptr for a shape. */
+        SDL_Rect srcRect; /**< The frame of the texture to copy (the animation frame of a sprite). */
+        SDL_FRect rect; /**< The destination in world coordinates, the two ends of a line. */
+        double angle; /**< The rotation of the texture in degrees. */
+        SDL_RendererFlip flip; /**< The flip of the texture. */
+        Point motion; /**< The displacement of the object during the tick. */
+    };
+
+
+    /* ATTRIBUTES */
+
+    std::vector<DrawCommand> commands; /**< The recorded calls, in drawing order (the capacity is kept between the ticks). */
+    SDL_Color color = {0, 0, 0, 255}; /**< The draw color of the next shapes. */
+    Point motion = {0, 0}; /**< The motion of the next calls. */
+
+
+public:
+    /* MODIFIERS */
+
+    /**
+     * @brief Set the draw color of the next rectangles and lines.
+     * @param r The red component.
+     * @param g The green component.
+     * @param b The blue component.
+     * @param a The alpha component.
+     */
+    void setDrawColor(Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+
+    /**
+     * @brief Set the displacement during the tick of the object recorded next.
+     * @param newMotion The current position minus the previous one, {0, 0} for a still object.
+     */
+    void setMotion(Point newMotion);
+
+
+    /* METHODS */
+
+    /**
+     * @brief Remove every recorded call, the draw color and the motion are reset.
+     */
+    void clear();
+
+    /**
+     * @brief Record the copy of a texture.
+     * @param texture The texture.
+     * @param srcRect The frame of the texture to copy.
+     * @param rect The destination in world coordinates.
+     * @param angle The rotation in degrees.
+     * @param flip The flip of the texture.
+     */
+    void copy(SDL_Texture *texture, const SDL_Rect &srcRect, const SDL_FRect &rect, double angle, SDL_RendererFlip flip);
+
+    /**
+     * @brief Record a filled rectangle of the current draw color.
+     * @param rect The rectangle in world coordinates.
+     */
+    void fillRect(const SDL_FRect &rect);
+
+    /**
+     * @brief Record a line of the current draw color.
+     * @param x1 The x-coordinate of the first end in world coordinates.
+     * @param y1 The y-coordinate of the first end in world coordinates.
+     * @param x2 The x-coordinate of the second end in world coordinates.
+     * @param y2 The y-coordinate of the second end in world coordinates.
+     */
+    void drawLine(float x1, float y1, float x2, float y2);
+
+    /**
+     * @brief Replay the recorded calls.
+     * @param renderer The renderer, only used by the thread owning it.
+     * @param camera The rendering point of the camera.
+     * @param alpha The fraction of the simulation step elapsed since the tick, the calls are drawn between their last two positions.
+     */
+    void render(SDL_Renderer *renderer, Point camera, float alpha) const;
+};
+
+#endif //PLAY_TOGETHER_RENDERSNAPSHOT_H
@@ -3,6 +3,7 @@
 
 #include "Texture.h"
 #include "Animation.h"
+#include "../Utils/SimulationClock.h"
 
 
 /**
@@ -21,7 +22,7 @@ private:
     // Animation attributes
     Animation animation = {}; /**< The current animation of the sprite. */
     int animationIndexX = 0; /**< The current position in the animation of the sprite. */
-    Uint32 lastAnimationUpdate = SDL_GetTicks(); /**< The last time the animation was updated. */
+    Uint32 lastAnimationUpdate = SimulationClock::getTicks(); /**< The last time the animation was updated. */
     SDL_Rect srcRect = {0 , 0, 0, 0}; /**< The square that will be copied in the texture. */
 
     // Unique animation attributes
@@ -38,11 +39,11 @@ public:
     /**
      * @brief Constructor for the Sprite class.
      * @param animation Initial animation of the sprite.
-     * @param texture The texture used for the sprite.
+     * @param texture The texture used for the sprite, nullptr if the textures are not loaded (headless server).
      * @param width The width of a tile in the texture.
      * @param height he height of a tile in the texture.
      */
-    Sprite(SDL_Texture &texture, Animation animation, int width, int height);
+    Sprite(SDL_Texture *texture, Animation animation, int width, int height);
 
 
     /* ACCESSORS */
@@ -33,6 +33,13 @@ public:
     Texture() = default;
     explicit Texture(SDL_Texture &texture, SDL_FRect offsets = {0, 0, 0, 0});
 
+    /**
+     * @brief Constructor of a texture without pixels, only its size is known (used by the headless server).
+     * @param size The size of the image.
+     * @param offsets The offset of the texture compared to the collision box.
+     */
+    explicit Texture(SDL_Rect size, SDL_FRect offsets = {0, 0, 0, 0});
+
 
     /* ACCESSORS */
 
@@ -71,9 +78,9 @@ public:
 
     /**
      * @brief Set the texture attribute.
-     * @param texture The new texture of the sprite.
+     * @param newTexture The new texture of the sprite, nullptr if the textures are not loaded (headless server).
      */
-    void setTexture(SDL_Texture &newTexture);
+    void setTexture(SDL_Texture *newTexture);
 
     /**
      * @brief Set the flipHorizontal attribute.
@@ -6,6 +6,9 @@
 #include <thread>
 
 #include "../Game/Game.h"
+#include "WireProtocol.h"
+#include "SnapshotManager.h"
+#include "PredictionManager.h"
 #include "../Utils/Mediator.h"
 #include "../../dependencies/json.hpp"
 
@@ -38,6 +41,8 @@ private:
     std::unique_ptr<std::jthread> serverUDPThreadPtr; /**< Pointer to the UDP server thread. */
     std::unique_ptr<std::jthread> clientUDPThreadPtr; /**< Pointer to the UDP client thread. */
     std::mutex clientAddressesMutex = {}; /**< Mutex to protect the client addresses map. */
+    SnapshotManager snapshotManager; /**< The snapshots sent (server) or received (client) by the sync corrections. */
+    PredictionManager predictionManager; /**< The inputs received (server) or predicted (client), acknowledged by the sync corrections. */
 
 #ifdef _WIN32
     std::map<SOCKET, sockaddr_in> clientAddresses; /**< Map storing client addresses. */
@@ -66,13 +71,26 @@ public:
      */
     [[nodiscard]] bool isClientRunning() const;
 
+    /**
+     * @brief Get the snapshots of the sync corrections.
+     * @return A reference to the snapshot manager.
+     */
+    [[nodiscard]] SnapshotManager &getSnapshotManager();
+
+    /**
+     * @brief Get the inputs acknowledged by the sync corrections.
+     * @return A reference to the prediction manager.
+     */
+    [[nodiscard]] PredictionManager &getPredictionManager();
+
 
     /* PUBLIC METHODS */
 
     /**
      * @brief Starts the TCP and UDP servers.
+     * @param port The port listened by both servers.
      */
-    void startServers();
+    void startServers(unsigned short port = 8080);
 
     /**
      * @brief Starts the TCP and UDP clients.
@@ -97,19 +115,26 @@ public:
      * @param message The message to send.
      * @param playerIgnored The player to ignore. (0 for no player ignored)
      */
-    void broadcastMessage(int protocol, const std::string &message, int socketIgnored) const;
+    void broadcastMessage(int protocol, std::string_view message, int socketIgnored) const;
 
     /**
      * @brief Sends the keyboard state to all clients (UDP).
+     * @param inputSequence The input sequence, the tick the keyboard state is applied at.
      * @param keyboardStateMask The mask of the keyboard state.
      */
-    void sendPlayerUpdate(uint16_t keyboardStateMask) const;
+    void sendPlayerUpdate(uint16_t inputSequence, uint16_t keyboardStateMask) const;
 
     /**
-     * @brief Sends the sync correction to all clients (UDP).
-     * @param message The message to send.
+     * @brief Sends the last snapshot captured to all clients, as the delta of the last one each client acknowledged (UDP).
+     * @param tick The current tick, each client gets the last of its inputs simulated.
+     */
+    void sendSyncCorrection(uint64_t tick);
+
+    /**
+     * @brief Acknowledges a snapshot to the server, it becomes the baseline of the next sync corrections (UDP).
+     * @param sequence The sequence of the snapshot.
      */
-    void sendSyncCorrection(nlohmann::json &message);
+    void sendSnapshotAck(uint16_t sequence) const;
 
     /**
      * @brief Sends the creation of an asteroid to all clients (UDP).
@@ -0,0 +1,180 @@
+#ifndef PLAY_TOGETHER_PREDICTIONMANAGER_H
+#define PLAY_TOGETHER_PREDICTIONMANAGER_H
+
+#include <array>
+#include <mutex>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+
+/**
+ * @file PredictionManager.h
+ * @brief Defines the PredictionManager class reconciling the movement predicted by a client with the server.
+ */
+
+/**
+ * @struct PredictionCorrection
+ * @brief The error of a prediction, the move to add to the local player.
+ */
+struct PredictionCorrection {
+    float deltaX = 0; /**< The error on the x-coordinate. */
+    float deltaY = 0; /**< The error on the y-coordinate. */
+};
+
+/**
+ * @struct AuthoritativeState
+ * @brief The position of the local player received from the server, with the last input simulated.
+ */
+struct AuthoritativeState {
+    int32_t sequence = -1; /**< The last input sequence simulated by the server, PredictionManager::NO_INPUT if none. */
+    float x = 0; /**< The authoritative x-coordinate. */
+    float y = 0; /**< The authoritative y-coordinate. */
+};
+
+/**
+ * @enum Reconciliation
+ * @brief The result of the reconciliation of an authoritative state.
+ */
+enum class Reconciliation {
+    CORRECTED, /**< The prediction was wrong, the correction is added to the player. */
+    WITHIN_TOLERANCE, /**< The prediction was right, nothing changes. */
+    NO_PREDICTION /**< The input was not predicted (not recorded yet, too old or none), the player is smoothed to the server state. */
+};
+
+/**
+ * @class PredictionManager
+ * @brief Keeps the inputs of the local player with their predicted positions, and the inputs processed by the server.
+ *
+ * The client stamps its keyboard state with the tick it is applied at (the input sequence) and moves its player at
+ * once. The position predicted at the end of each tick is kept in a ring buffer. The server records the last input
+ * received from each client, with its own tick: the input is applied from the next server tick until the next input,
+ * so the sync correction acknowledges the last input sequence simulated. The client compares the authoritative
+ * position with the one it predicted for this sequence: the error is added to the player and to every later prediction,
+ * which rewinds the player to the server state and replays the moves of the inputs not acknowledged yet. The player
+ * does not move back by the round trip of the network, only by the divergence of the two simulations.
+ *
+ * The extrapolation of the server counts its own ticks as client ticks: it holds only if both peers simulate at the
+ * same rate and the client does not drop ticks (Game::simulate drops the late time beyond maxSimulationStepsPerFrame).
+ * An input sent at another rate is never acknowledged. After dropped ticks, the acknowledged sequence can be ahead of
+ * the predictions: it is not reconciled, and the next input sent resynchronizes the server.
+ *
+ * The authoritative states are received on the UDP thread and queued, the simulation thread reconciles them between
+ * two ticks, where it records the predictions and moves the player.
+ */
+class PredictionManager {
+public:
+    /* ATTRIBUTES */
+
+    static constexpr size_t HISTORY_SIZE = 256; /**< The number of predictions kept (about 2 seconds of ticks), an older input is not reconciled. */
+    static constexpr int32_t NO_INPUT = -1; /**< The acknowledgement sent before the first input of a client. */
+    static constexpr float TOLERANCE = 0.5f; /**< The error in pixels below which a prediction is kept as it is. */
+
+
+private:
+    /* TYPES */
+
+    /**
+     * @struct PredictedState
+     * @brief The position of the local player at the end of a tick.
+     */
+    struct PredictedState {
+        uint16_t sequence = 0; /**< The input sequence of the tick. */
+        bool valid = false; /**< True if the state holds the prediction of its sequence. */
+        float x = 0; /**< The predicted x-coordinate. */
+        float y = 0; /**< The predicted y-coordinate. */
+    };
+
+    /**
+     * @struct ReceivedInput
+     * @brief The last input received from a client.
+     */
+    struct ReceivedInput {
+        uint16_t sequence = 0; /**< The input sequence. */
+        uint64_t tickRate = 0; /**< The tick rate of the client. */
+        uint64_t tick = 0; /**< The server tick at the reception, the input is applied from the next one. */
+    };
+
+
+    /* ATTRIBUTES */
+
+    std::array<PredictedState, HISTORY_SIZE> history; /**< The predictions, indexed by sequence modulo HISTORY_SIZE (simulation thread). */
+
+    std::optional<AuthoritativeState> pendingState; /**< The last authoritative state received, not reconciled yet. */
+    std::mutex pendingStateMutex; /**< The authoritative states are received on the UDP thread. */
+
+    std::unordered_map<int, ReceivedInput> receivedInputs; /**< The last input received from each client. */
+    mutable std::mutex receivedInputsMutex; /**< The inputs are received on the UDP thread. */
+
+
+public:
+    /* ACCESSORS */
+
+    /**
+     * @brief Get the last input sequence of a client simulated by the server (server).
+     * @param clientID The ID of the client.
+     * @param tick The current server tick, every tick since the reception replayed the last input received.
+     * @param tickRate The tick rate of the server.
+     * @return The input sequence, NO_INPUT if no input was received or the client simulates at another rate.
+     */
+    [[nodiscard]] int32_t getProcessedInput(int clientID, uint64_t tick, uint64_t tickRate) const;
+
+
+    /* METHODS */
+
+    /**
+     * @brief Record an input received from a client (server).
+     * @param clientID The ID of the client.
+     * @param sequence The input sequence.
+     * @param tickRate The tick rate of the client.
+     * @param tick The current server tick.
+     */
+    void receiveInput(int clientID, uint16_t sequence, uint64_t tickRate, uint64_t tick);
+
+    /**
+     * @brief Forget the inputs of a client (server).
+     * @param clientID The ID of the client.
+     */
+    void removeClient(int clientID);
+
+    /**
+     * @brief Record the position of the local player at the end of a tick (client, simulation thread).
+     * @param sequence The input sequence of the tick.
+     * @param x The predicted x-coordinate, pending corrections included.
+     * @param y The predicted y-coordinate, pending corrections included.
+     */
+    void record(uint16_t sequence, float x, float y);
+
+    /**
+     * @brief Queue an authoritative state, it replaces the one not reconciled yet (client, UDP thread).
+     * @param state The authoritative state of the local player.
+     */
+    void receiveAuthoritativeState(const AuthoritativeState &state);
+
+    /**
+     * @brief Take the authoritative state queued (client, simulation thread).
+     * @param state The authoritative state, set if one is queued.
+     * @return True if a state was queued.
+     */
+    bool takeAuthoritativeState(AuthoritativeState &state);
+
+    /**
+     * @brief Compare an authoritative state with the prediction of its input (client, simulation thread).
+     * @param state The authoritative state.
+     * @param correction The error of the prediction, set if the prediction is corrected.
+     * @return CORRECTED if the error is above the tolerance (the later predictions are moved by the correction),
+     * WITHIN_TOLERANCE if it is not, NO_PREDICTION if the input of the state was not predicted.
+     */
+    Reconciliation reconcile(const AuthoritativeState &state, PredictionCorrection &correction);
+
+    /**
+     * @brief Forget every prediction, when the player is moved without them (client, simulation thread).
+     */
+    void clearPredictions();
+
+    /**
+     * @brief Forget every prediction and input.
+     */
+    void reset();
+};
+
+#endif //PLAY_TOGETHER_PREDICTIONMANAGER_H
@@ -0,0 +1,214 @@
+#ifndef PLAY_TOGETHER_SNAPSHOTMANAGER_H
+#define PLAY_TOGETHER_SNAPSHOTMANAGER_H
+
+#include <array>
+#include <deque>
+#include <vector>
+#include <mutex>
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+#include "WireProtocol.h"
+
+/**
+ * @file SnapshotManager.h
+ * @brief Defines the SnapshotManager class sending the state of the game as deltas of acknowledged snapshots.
+ */
+
+/**
+ * @struct QuantizedPosition
+ * @brief A position quantized to a fraction of pixel.
+ */
+struct QuantizedPosition {
+    int32_t x = 0; /**< The quantized x-coordinate. */
+    int32_t y = 0; /**< The quantized y-coordinate. */
+
+    bool operator==(const QuantizedPosition &) const = default;
+};
+
+/**
+ * @struct SnapshotPlayer
+ * @brief The state of a player in a snapshot.
+ */
+struct SnapshotPlayer {
+    int32_t id = 0; /**< The network ID of the player (0 for the server player). */
+    QuantizedPosition position; /**< The position of the player. */
+};
+
+/**
+ * @struct Snapshot
+ * @brief The state of the game sent to the clients.
+ */
+struct Snapshot {
+    uint16_t sequence = 0; /**< The sequence number of the snapshot. */
+    bool valid = false; /**< True if the snapshot holds the state of its sequence. */
+    std::vector<SnapshotPlayer> players; /**< The alive players, sorted by ID. */
+    std::vector<QuantizedPosition> platforms1D; /**< The 1D platforms, in the order of the level. */
+    std::vector<QuantizedPosition> platforms2D; /**< The 2D platforms, in the order of the level. */
+    std::vector<QuantizedPosition> crushers; /**< The crushers, in the order of the level. */
+};
+
+/**
+ * @class SnapshotManager
+ * @brief Keeps the last snapshots and encodes each one as a delta of the last snapshot acknowledged by a client.
+ *
+ * The server captures a snapshot at each sync correction. A client acknowledges every snapshot it decodes, the next
+ * one is sent as the delta of the last acknowledged snapshot (or of an empty one if there is none), so only the
+ * changed positions are sent. A delta is encoded once per baseline and shared by every client with this baseline.
+ *
+ * Delta of a position list: varint count, varint changed count, then (varint index gap, varint dx, varint dy) per
+ * changed position. Delta of the players: varint changed count, (varint id, varint dx, varint dy) per changed or new
+ * player, varint removed count, varint id per removed player. Every varint here is signed except the counts and gaps.
+ */
+class SnapshotManager {
+public:
+    /* ATTRIBUTES */
+
+    static constexpr size_t HISTORY_SIZE = 32; /**< The number of snapshots kept, an older baseline is not used. */
+    static constexpr float POSITION_SCALE = 8; /**< The positions are quantized to 1 / POSITION_SCALE pixel. */
+    static constexpr int32_t NO_BASELINE = -1; /**< The baseline of a full snapshot. */
+
+
+private:
+    /* TYPES */
+
+    /**
+     * @struct EncodedDelta
+     * @brief The delta of the current snapshot from a baseline.
+     */
+    struct EncodedDelta {
+        int32_t baseline = NO_BASELINE; /**< The sequence of the baseline. */
+        size_t size = 0; /**< The size of the delta, 0 if it did not fit in a datagram. */
+        std::array<char, WireProtocol::MAX_MESSAGE_SIZE> buffer{}; /**< The encoded delta. */
+    };
+
+
+    /* ATTRIBUTES */
+
+    std::array<Snapshot, HISTORY_SIZE> history; /**< The last snapshots, indexed by sequence modulo HISTORY_SIZE. */
+    uint16_t lastSequence = 0; /**< The sequence of the last snapshot captured (server) or applied (client). */
+    bool hasLastSequence = false; /**< False until a snapshot is captured or applied. */
+
+    std::deque<EncodedDelta> encodedDeltas; /**< The deltas of the current snapshot, reused between captures (a deque keeps them in place). */
+    size_t encodedCount = 0; /**< The number of deltas encoded for the current snapshot. */
+
+    std::unordered_map<int, uint16_t> acknowledged; /**< The last snapshot acknowledged by each client. */
+    mutable std::mutex acknowledgedMutex; /**< The acknowledgements are received on the UDP thread. */
+
+
+public:
+    /* ACCESSORS */
+
+    /**
+     * @brief Get the sequence of the last snapshot captured.
+     * @return The sequence.
+     */
+    [[nodiscard]] uint16_t getLastSequence() const;
+
+    /**
+     * @brief Get the baseline of the next delta sent to a client.
+     * @param clientID The ID of the client.
+     * @return The sequence of the last snapshot acknowledged by the client, NO_BASELINE if it is not kept.
+     */
+    [[nodiscard]] int32_t getBaseline(int clientID) const;
+
+
+    /* METHODS */
+
+    /**
+     * @brief Quantize a coordinate.
+     * @param value The coordinate.
+     * @return The quantized coordinate.
+     */
+    [[nodiscard]] static int32_t quantize(float value);
+
+    /**
+     * @brief Restore a quantized coordinate.
+     * @param value The quantized coordinate.
+     * @return The coordinate.
+     */
+    [[nodiscard]] static float dequantize(int32_t value);
+
+    /**
+     * @brief Start a new snapshot (server), the caller fills it before encoding it.
+     * @return The snapshot, empty, with the next sequence.
+     */
+    Snapshot &capture();
+
+    /**
+     * @brief Encode the delta of the last snapshot captured from a baseline (server).
+     * @param baseline The sequence of the baseline, NO_BASELINE for a full snapshot.
+     * @return The encoded delta, shared by every client with the same baseline, empty if it does not fit in a datagram.
+     */
+    std::string_view encode(int32_t baseline);
+
+    /**
+     * @brief Record the acknowledgement of a snapshot by a client (server).
+     * @param clientID The ID of the client.
+     * @param sequence The sequence of the snapshot.
+     */
+    void acknowledge(int clientID, uint16_t sequence);
+
+    /**
+     * @brief Forget the acknowledgements of a client (server).
+     * @param clientID The ID of the client.
+     */
+    void removeClient(int clientID);
+
+    /**
+     * @brief Decode a snapshot from the delta of its baseline (client).
+     * @param reader The reader positioned at the delta.
+     * @param sequence The sequence of the snapshot.
+     * @param baseline The sequence of the baseline, NO_BASELINE for a full snapshot.
+     * @return The decoded snapshot, nullptr if the message is invalid, older than the last one or its baseline is missing.
+     */
+    const Snapshot *decode(WireReader &reader, uint16_t sequence, int32_t baseline);
+
+    /**
+     * @brief Forget every snapshot and acknowledgement.
+     */
+    void reset();
+
+
+private:
+    /* SUB METHODS */
+
+    /**
+     * @brief Find a snapshot of the history.
+     * @param sequence The sequence of the snapshot, NO_BASELINE for none.
+     * @return The snapshot, nullptr if it is not kept.
+     */
+    [[nodiscard]] const Snapshot *find(int32_t sequence) const;
+
+    /**
+     * @brief Encode the delta of a position list.
+     * @param writer The writer receiving the delta.
+     * @param positions The current positions.
+     * @param baseline The positions of the baseline (missing ones are at 0).
+     */
+    static void encodePositions(WireWriter &writer, const std::vector<QuantizedPosition> &positions, const std::vector<QuantizedPosition> &baseline);
+
+    /**
+     * @brief Decode the delta of a position list.
+     * @param reader The reader positioned at the delta.
+     * @param positions The positions of the baseline, replaced by the current ones.
+     */
+    static void decodePositions(WireReader &reader, std::vector<QuantizedPosition> &positions);
+
+    /**
+     * @brief Encode the delta of the players.
+     * @param writer The writer receiving the delta.
+     * @param players The current players, sorted by ID.
+     * @param baseline The players of the baseline, sorted by ID.
+     */
+    static void encodePlayers(WireWriter &writer, const std::vector<SnapshotPlayer> &players, const std::vector<SnapshotPlayer> &baseline);
+
+    /**
+     * @brief Decode the delta of the players.
+     * @param reader The reader positioned at the delta.
+     * @param players The players of the baseline, replaced by the current ones (sorted by ID).
+     */
+    static void decodePlayers(WireReader &reader, std::vector<SnapshotPlayer> &players);
+};
+
+#endif //PLAY_TOGETHER_SNAPSHOTMANAGER_H
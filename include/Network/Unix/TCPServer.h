@@ -6,18 +6,27 @@
 #include <map>
 #include <mutex>
 #include <vector>
+#include <array>
+#include <memory>
+#include <unordered_map>
 #include <string>
+#include <string_view>
 #include <iostream>
 #include <unistd.h>
 #include <sys/socket.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <fcntl.h>
+#include <cerrno>
 #include <thread>
 #include <ranges>
 #include <algorithm>
 #include <cstring>
 
 #include "../TCPError.h"
+#include "../WireProtocol.h"
 #include "../../Utils/Mediator.h"
 #include "../../../dependencies/json.hpp"
 
@@ -26,12 +35,34 @@
  */
 class TCPServer {
 private:
+    /* TYPES */
+
+    /**
+     * @struct Connection
+     * @brief The buffers of a connected client.
+     */
+    struct Connection {
+        int socket = -1; /**< The client socket file descriptor. */
+        std::vector<char> readBuffer; /**< The bytes received and not yet framed (event loop thread only). */
+        std::string writeBuffer; /**< The framed bytes not yet sent. */
+        size_t writeOffset = 0; /**< The number of bytes of the write buffer already sent. */
+        bool writing = false; /**< True while the socket is watched for writability. */
+    };
+
+
     /* ATTRIBUTES */
 
+    static constexpr size_t READ_CHUNK_SIZE = 4096; /**< The number of bytes read at once from a client. */
+    static constexpr int MAX_MESSAGE_SIZE = 16 * 1024 * 1024; /**< A larger announced size closes the connection. */
+    static constexpr int MAX_EVENTS = 64; /**< The number of events handled per wait. */
+
     int socketFileDescriptor = -1; /**< The server socket file descriptor. */
+    int epollFileDescriptor = -1; /**< The epoll instance watching the server and client sockets. */
+    int wakeFileDescriptor = -1; /**< The eventfd waking the event loop when the server stops. */
     unsigned int maxClients = 3; /**< Maximum number of clients that can connect to the server. */
-    std::vector<std::jthread> clientThreads; /**< Threads to handle client connections. */
-    std::atomic<bool> stopRequested = false; /**< Flag to indicate if the server should stop. (exit the accept loop) */
+    mutable std::unordered_map<int, std::unique_ptr<Connection>> connections; /**< The connected clients, by socket. */
+    mutable std::mutex connectionsMutex; /**< Protects the connections and their write buffers (the messages are sent from any thread). */
+    std::atomic<bool> stopRequested = false; /**< Flag to indicate if the server should stop. (exit the event loop) */
     std::map<int, sockaddr_in> *clientAddressesPtr = nullptr; /**< Pointer to the map of client IDs and their addresses. (file descriptor, address) */
     std::mutex *clientAddressesMutexPtr = nullptr; /**< Pointer to the mutex to protect the client addresses map. */
 
@@ -58,7 +89,7 @@ public:
      * @param port The port number to listen on.
      * @return True if initialization is successful, false otherwise.
      */
-    void initialize(short port);
+    void initialize(unsigned short port);
 
     /**
      * @brief Starts the TCP server to accept incoming connections.
@@ -73,21 +104,14 @@ public:
      * @param message The message to send.
      * @return True if the message is sent successfully, false otherwise.
      */
-    bool send(int clientSocket, const std::string &message) const;
+    bool send(int clientSocket, std::string_view message) const;
 
     /**
      * @brief Broadcasts a message to all connected clients.
      * @param message The message to broadcast.
      * @return True if the message is sent successfully to all clients, false otherwise.
      */
-    bool broadcast(const std::string &message, int socketIgnored) const;
-
-    /**
-     * @brief Receives a message from the specified client.
-     * @param clientSocket The client socket file descriptor.
-     * @return The received message.
-     */
-    [[nodiscard]] std::string receive(int clientSocket) const;
+    bool broadcast(std::string_view message, int socketIgnored) const;
 
     /**
      * @brief Sends the game properties to the specified client.
@@ -118,21 +142,56 @@ public:
 private:
 
     /**
-     * @brief Waits for a new client connection.
-     * @return The client socket file descriptor if successful, -1 if an error occurs.
+     * @brief Waits for the events of the sockets and handles them until the server stops.
      */
-    int waitForConnection();
+    void runEventLoop();
 
     /**
-     * @brief Accepts incoming client connections.
+     * @brief Accepts every pending client connection.
      */
     void acceptConnections();
 
     /**
-     * @brief Handles messages from a client.
+     * @brief Registers a new client, or rejects it if the server is full.
+     * @param clientSocket The client socket file descriptor (non-blocking).
+     * @param clientAddress The client address.
+     */
+    void openConnection(int clientSocket, const sockaddr_in &clientAddress);
+
+    /**
+     * @brief Closes the connection of a client and notifies the other clients.
      * @param clientSocket The client socket file descriptor.
      */
-    void handleMessage(int clientSocket);
+    void closeConnection(int clientSocket);
+
+    /**
+     * @brief Reads every byte available from a client.
+     * @param connection The connection of the client.
+     * @return False if the client closed the connection or an error occurred.
+     */
+    static bool readConnection(Connection &connection);
+
+    /**
+     * @brief Handles every complete message of the read buffer of a client.
+     * @param connection The connection of the client.
+     * @return False if the client asked to disconnect or sent an invalid size.
+     */
+    static bool handleMessages(Connection &connection);
+
+    /**
+     * @brief Appends a framed message to the write buffer of a client and sends what the socket accepts.
+     * @param connection The connection of the client (connectionsMutex held).
+     * @param message The message to send.
+     * @return False if an error occurred.
+     */
+    bool queueMessage(Connection &connection, std::string_view message) const;
+
+    /**
+     * @brief Sends what the socket accepts from the write buffer of a client, the rest waits for writability.
+     * @param connection The connection of the client (connectionsMutex held).
+     * @return False if an error occurred.
+     */
+    bool flushConnection(Connection &connection) const;
 
     /**
      * @brief Close all client connections and clear resources.
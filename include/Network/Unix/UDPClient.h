@@ -4,6 +4,7 @@
 #define PLAY_TOGETHER_UDPCLIENT_H
 
 #include <string>
+#include <string_view>
 #include <unistd.h>
 #include <sys/socket.h>
 #include <netinet/in.h>
@@ -14,6 +15,7 @@
 #include <mutex>
 
 #include "../UDPError.h"
+#include "../WireProtocol.h"
 #include "../../Utils/Mediator.h"
 
 /**
@@ -67,7 +69,7 @@ public:
      * @param message The message to send.
      * @return True if the message is sent successfully, false otherwise.
      */
-    bool send(const std::string &message) const;
+    bool send(std::string_view message) const;
 
     /**
      * @brief Receives a message from the server.
@@ -6,18 +6,29 @@
 #include <map>
 #include <mutex>
 #include <vector>
+#include <array>
+#include <span>
+#include <atomic>
+#include <unordered_map>
 #include <string>
+#include <string_view>
 #include <iostream>
 #include <unistd.h>
 #include <sys/socket.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
+#include <sys/eventfd.h>
+#include <poll.h>
+#include <cerrno>
 #include <thread>
 #include <ranges>
 #include <algorithm>
 #include <cstring>
 
 #include "../UDPError.h"
+#include "../WireProtocol.h"
+#include "../SnapshotManager.h"
+#include "../PredictionManager.h"
 #include "../../Utils/Mediator.h"
 
 /**
@@ -27,10 +38,15 @@ class UDPServer {
 private:
     /* ATTRIBUTES */
 
+    static constexpr size_t BATCH_SIZE = 32; /**< The maximum number of datagrams received or sent per system call. */
+
     int socketFileDescriptor = -1; /**< The server socket file descriptor. */
-    bool stopRequested = false; /**< Flag to indicate if the server should stop. */
+    int wakeFileDescriptor = -1; /**< The eventfd waking the receiving thread when the server stops. */
+    std::atomic<bool> stopRequested = false; /**< Flag to indicate if the server should stop. */
     std::map<int, sockaddr_in> *clientAddressesPtr = nullptr; /**< Pointer to the map of client IDs and their addresses. */
     std::mutex *clientAddressesMutexPtr = nullptr; /**< Pointer to the mutex to protect the client addresses map. */
+    std::unordered_map<uint64_t, int> clientsByAddress; /**< The client ID of each address already seen (receiving thread only). */
+    std::array<std::array<char, WireProtocol::MAX_MESSAGE_SIZE>, BATCH_SIZE> receiveBuffers{}; /**< The datagrams of a received batch. */
 
 
 public:
@@ -54,7 +70,7 @@ public:
      * @brief Initializes the UDP server with the given port.
      * @param port The port number to listen on.
      */
-    void initialize(short port);
+    void initialize(unsigned short port);
 
     /**
      * @brief Starts the UDP server to handle incoming messages.
@@ -69,7 +85,7 @@ public:
      * @param message The message to send.
      * @return True if the message is sent successfully, false otherwise.
      */
-    bool send(const sockaddr_in& clientAddress, const std::string &message) const;
+    bool send(const sockaddr_in& clientAddress, std::string_view message) const;
 
     /**
      * @brief Broadcasts a message to all connected clients.
@@ -77,25 +93,21 @@ public:
      * @param socketIgnored The socket to ignore when broadcasting. (0 to broadcast to all clients)
      * @return True if the message is sent successfully to all clients, false otherwise.
      */
-    bool broadcast(const std::string &message, int socketIgnored) const;
-
-    /**
-     * @brief Receives a message from a client.
-     * @param clientAddress The client address structure.
-     * @return The received message.
-     */
-    [[nodiscard]] std::string receive(sockaddr_in& clientAddress, int timeout) const;
+    bool broadcast(std::string_view message, int socketIgnored) const;
 
     /**
      * @brief Sends a synchronous correction message to the client.
      * @param clientSocket The client socket file descriptor.
-     * @param message The message to send.
+     * @param sequence The sequence of the snapshot.
+     * @param baseline The sequence of the baseline of the delta, SnapshotManager::NO_BASELINE for a full snapshot.
+     * @param processedInput The last input sequence of the client simulated, PredictionManager::NO_INPUT if none.
+     * @param delta The encoded delta of the snapshot, shared by the clients with the same baseline.
      * @return True if the message is sent successfully, false otherwise.
      */
-    bool sendSyncCorrection(int clientSocket, sockaddr_in address, nlohmann::json &message) const;
+    bool sendSyncCorrection(int clientSocket, sockaddr_in address, uint16_t sequence, int32_t baseline, int32_t processedInput, std::string_view delta) const;
 
     /**
-     * @brief Shuts down the server.
+     * @brief Shuts down the server by waking the receiving thread, which closes the socket when it returns from start().
      */
     void stop();
 
@@ -105,6 +117,40 @@ private:
      * @brief Waits for incoming messages.
      */
     void handleMessage();
+
+    /**
+     * @brief Waits for datagrams (or for the server to stop) and receives all of them, up to a batch.
+     * @param messages The headers of the batch, their datagram is in receiveBuffers.
+     * @param addresses The sender of each datagram.
+     * @return The number of datagrams received.
+     */
+    int receiveBatch(std::span<mmsghdr, BATCH_SIZE> messages, std::span<sockaddr_in, BATCH_SIZE> addresses);
+
+    /**
+     * @brief Finds the client of each sender of a batch.
+     * @param addresses The sender of each datagram.
+     * @param clientIDs The ID of each client, -1 for an unknown sender.
+     */
+    void resolveClients(std::span<const sockaddr_in> addresses, std::span<int> clientIDs);
+
+    /**
+     * @brief Sends a batch of datagrams.
+     * @param messages The headers of the datagrams.
+     * @return True if every datagram is sent, false otherwise.
+     */
+    bool sendBatch(std::span<mmsghdr> messages) const;
+
+    /**
+     * @brief Returns the key of an address in the client table.
+     * @param address The address.
+     * @return The IPv4 address and the port packed in 64 bits.
+     */
+    static uint64_t getAddressKey(const sockaddr_in &address);
+
+    /**
+     * @brief Closes the socket and the eventfd, on the receiving thread once it stopped handling messages.
+     */
+    void clearResources();
 };
 
 #endif //PLAY_TOGETHER_UDPSERVER_H
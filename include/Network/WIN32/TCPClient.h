@@ -4,6 +4,7 @@
 #define PLAY_TOGETHER_TCPCLIENT_H
 
 #include <string>
+#include <string_view>
 #include <iostream>
 #include <cstring>
 #include <thread>
@@ -12,6 +13,7 @@
 #include <ws2tcpip.h>
 
 #include "../TCPError.h"
+#include "../WireProtocol.h"
 #include "../../Utils/Mediator.h"
 
 /**
@@ -66,7 +68,7 @@ public:
      * @param message The message to send.
      * @return True if the message is sent successfully, false otherwise.
      */
-    bool send(const std::string &message) const;
+    bool send(std::string_view message) const;
 
     /**
      * @brief Receives a message from the server.
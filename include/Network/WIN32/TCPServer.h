@@ -7,6 +7,7 @@
 #include <mutex>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <iostream>
 #include <thread>
 #include <ranges>
@@ -16,6 +17,7 @@
 #include <ws2tcpip.h>
 
 #include "../TCPError.h"
+#include "../WireProtocol.h"
 #include "../../Utils/Mediator.h"
 #include "../../../dependencies/json.hpp"
 
@@ -45,7 +47,7 @@ public:
      * @param port The port number to listen on.
      * @return True if initialization is successful, false otherwise.
      */
-    void initialize(short port);
+    void initialize(unsigned short port);
 
     /**
      * @brief Starts the TCP server to accept incoming connections.
@@ -60,14 +62,14 @@ public:
      * @param message The message to send.
      * @return True if the message is sent successfully, false otherwise.
      */
-    bool send(SOCKET clientSocket, const std::string &message) const;
+    bool send(SOCKET clientSocket, std::string_view message) const;
 
     /**
      * @brief Broadcasts a message to all connected clients.
      * @param message The message to broadcast.
      * @return True if the message is sent successfully to all clients, false otherwise.
      */
-    bool broadcast(const std::string &message, SOCKET socketIgnored) const;
+    bool broadcast(std::string_view message, SOCKET socketIgnored) const;
 
     /**
      * @brief Receives a message from the specified client.
@@ -4,6 +4,7 @@
 #define PLAY_TOGETHER_UDPCLIENT_H
 
 #include <string>
+#include <string_view>
 #include <iostream>
 #include <cstring>
 #include <map>
@@ -12,6 +13,7 @@
 #include <ws2tcpip.h>
 
 #include "../UDPError.h"
+#include "../WireProtocol.h"
 #include "../../Utils/Mediator.h"
 
 /**
@@ -57,7 +59,7 @@ public:
      * @param message The message to send.
      * @return True if the message is sent successfully, false otherwise.
      */
-    bool send(const std::string &message) const;
+    bool send(std::string_view message) const;
 
     /**
      * @brief Receives a message from the server.
@@ -7,6 +7,7 @@
 #include <mutex>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <iostream>
 #include <thread>
 #include <ranges>
@@ -16,6 +17,9 @@
 #include <ws2tcpip.h>
 
 #include "../UDPError.h"
+#include "../WireProtocol.h"
+#include "../SnapshotManager.h"
+#include "../PredictionManager.h"
 #include "../../Utils/Mediator.h"
 
 /**
@@ -43,7 +47,7 @@ public:
      * @brief Initializes the UDP server with the given port.
      * @param port The port number to listen on.
      */
-    void initialize(short port);
+    void initialize(unsigned short port);
 
     /**
      * @brief Starts the UDP server to handle incoming messages.
@@ -58,7 +62,7 @@ public:
      * @param message The message to send.
      * @return True if the message is sent successfully, false otherwise.
      */
-    bool send(const sockaddr_in& clientAddress, const std::string &message) const;
+    bool send(const sockaddr_in& clientAddress, std::string_view message) const;
 
     /**
      * @brief Broadcasts a message to all connected clients.
@@ -66,7 +70,7 @@ public:
      * @param socketIgnored The socket to ignore when broadcasting. (0 to broadcast to all clients)
      * @return True if the message is sent successfully to all clients, false otherwise.
      */
-    bool broadcast(const std::string &message, SOCKET socketIgnored) const;
+    bool broadcast(std::string_view message, SOCKET socketIgnored) const;
 
     /**
      * @brief Receives a message from a client.
@@ -78,10 +82,13 @@ public:
     /**
      * @brief Sends a synchronous correction message to the client.
      * @param clientSocket The client socket file descriptor.
-     * @param message The message to send.
+     * @param sequence The sequence of the snapshot.
+     * @param baseline The sequence of the baseline of the delta, SnapshotManager::NO_BASELINE for a full snapshot.
+     * @param processedInput The last input sequence of the client simulated, PredictionManager::NO_INPUT if none.
+     * @param delta The encoded delta of the snapshot, shared by the clients with the same baseline.
      * @return True if the message is sent successfully, false otherwise.
      */
-    bool sendSyncCorrection(int clientSocket, sockaddr_in address, nlohmann::json &message) const;
+    bool sendSyncCorrection(int clientSocket, sockaddr_in address, uint16_t sequence, int32_t baseline, int32_t processedInput, std::string_view delta) const;
 
     /**
      * @brief Shuts down the server.
@@ -0,0 +1,313 @@
+#ifndef PLAY_TOGETHER_WIREPROTOCOL_H
+#define PLAY_TOGETHER_WIREPROTOCOL_H
+
+#include <array>
+#include <span>
+#include <string_view>
+#include <cstdint>
+#include <cstring>
+#include <bit>
+
+/**
+ * @file WireProtocol.h
+ * @brief Defines the binary format of the gameplay messages and the classes encoding and decoding it.
+ *
+ * A binary message starts with a fixed header of 4 bytes: the magic byte, the version of the format, the id of the
+ * message and a reserved byte (zero). Every field of the body is little-endian, the floats are sent as their IEEE 754
+ * bits. The varints are LEB128 (7 bits per byte), the signed ones are zigzag encoded. The magic byte is not '{', so a
+ * binary message is never mistaken for a JSON one (the game properties are still sent in JSON). The encoders and
+ * decoders work in place on a fixed buffer, they never allocate.
+ */
+
+/**
+ * @enum MessageID
+ * @brief The id of each binary message, its position in the message table starts at 1.
+ */
+enum class MessageID : uint8_t {
+    PLAYER_UPDATE = 1, /**< int32 player id, uint16 input sequence (the tick of the sender), uint16 tick rate of the sender, uint16 keyboard state mask. */
+    SYNC_CORRECTION, /**< uint16 sequence, uint16 baseline, uint8 has baseline, int32 client id, uint16 last input processed, uint8 has input, then the delta of the snapshot (see SnapshotManager). */
+    ASTEROID_CREATION, /**< float x, y, speed, h, w, angle. */
+    PLAYER_CONNECT, /**< int32 player id. */
+    PLAYER_DISCONNECT, /**< int32 player id. */
+    SNAPSHOT_ACK /**< uint16 sequence of the last snapshot received. */
+};
+
+/**
+ * @struct MessageLayout
+ * @brief Describes a binary message in the message table.
+ */
+struct MessageLayout {
+    MessageID id; /**< The id of the message. */
+    std::string_view name; /**< The name of the message (same as its JSON messageType). */
+    size_t bodySize; /**< The size of the body, the minimum size when the message has arrays. */
+};
+
+/**
+ * @class WireProtocol
+ * @brief Holds the constants and the message table of the binary format.
+ */
+class WireProtocol {
+public:
+    /* ATTRIBUTES */
+
+    static constexpr uint8_t MAGIC = 0xB7; /**< The first byte of every binary message. */
+    static constexpr uint8_t VERSION = 3; /**< The version of the format, a message of another version is dropped. */
+    static constexpr size_t HEADER_SIZE = 4; /**< The size of the header (magic, version, id, reserved). */
+    static constexpr size_t MAX_MESSAGE_SIZE = 1024; /**< The size of the reception buffers. */
+
+    static constexpr std::array<MessageLayout, 6> MESSAGES = {{
+        {MessageID::PLAYER_UPDATE, "playerUpdate", 10},
+        {MessageID::SYNC_CORRECTION, "syncCorrection", 12},
+        {MessageID::ASTEROID_CREATION, "asteroidCreation", 24},
+        {MessageID::PLAYER_CONNECT, "playerConnect", 4},
+        {MessageID::PLAYER_DISCONNECT, "playerDisconnect", 4},
+        {MessageID::SNAPSHOT_ACK, "snapshotAck", 2}
+    }}; /**< The message table, indexed by id - 1. */
+
+
+    /* ACCESSORS */
+
+    /**
+     * @brief Get the layout of a message.
+     * @param id The id of the message.
+     * @return The layout of the message.
+     */
+    [[nodiscard]] static constexpr const MessageLayout &getLayout(MessageID id) {
+        return MESSAGES[static_cast<size_t>(id) - 1];
+    }
+
+    /**
+     * @brief Get the size of a message without arrays (or its minimum size).
+     * @param id The id of the message.
+     * @return The size of the message, header included.
+     */
+    [[nodiscard]] static constexpr size_t getSize(MessageID id) {
+        return HEADER_SIZE + getLayout(id).bodySize;
+    }
+
+    /**
+     * @brief Check if a received message is a binary one.
+     * @param message The received message.
+     * @return True if the message starts with the magic byte.
+     */
+    [[nodiscard]] static constexpr bool isBinary(std::string_view message) {
+        return message.size() >= HEADER_SIZE && static_cast<uint8_t>(message[0]) == MAGIC;
+    }
+
+    /**
+     * @brief Describe a message for the logs, a binary message is not printable.
+     * @param message The message.
+     * @return The name of a binary message, the message itself otherwise (JSON or control message).
+     */
+    [[nodiscard]] static constexpr std::string_view describe(std::string_view message) {
+        if (!isBinary(message)) return message;
+
+        auto rawID = static_cast<uint8_t>(message[2]);
+        if (rawID == 0 || rawID > MESSAGES.size()) return "unknown binary message";
+        return MESSAGES[rawID - 1].name;
+    }
+
+    /**
+     * @brief Check that every message of the table is at the position of its id.
+     * @return True if the table is ordered.
+     */
+    [[nodiscard]] static constexpr bool isTableOrdered() {
+        for (size_t i = 0; i < MESSAGES.size(); i++) {
+            if (static_cast<size_t>(MESSAGES[i].id) != i + 1) return false;
+        }
+        return true;
+    }
+};
+
+static_assert(WireProtocol::isTableOrdered(), "The message table must be indexed by id - 1");
+static_assert(WireProtocol::MAGIC != '{', "The magic byte must not start a JSON message");
+
+/**
+ * @class WireWriter
+ * @brief Encodes a message in a fixed buffer, the writes past the end of the buffer are dropped and invalidate it.
+ */
+class WireWriter {
+private:
+    /* ATTRIBUTES */
+
+    std::span<char> buffer; /**< The buffer receiving the message. */
+    size_t position = 0; /**< The number of bytes written. */
+    bool overflow = false; /**< True if a write did not fit in the buffer. */
+
+
+public:
+    /* CONSTRUCTORS */
+
+    explicit WireWriter(std::span<char> buffer) : buffer(buffer) {}
+
+
+    /* ACCESSORS */
+
+    /**
+     * @brief Check if every write fitted in the buffer.
+     * @return True if the message is complete.
+     */
+    [[nodiscard]] bool isValid() const { return !overflow; }
+
+    /**
+     * @brief Get the bytes written.
+     * @return A view of the message in the buffer.
+     */
+    [[nodiscard]] std::string_view getMessage() const { return {buffer.data(), position}; }
+
+
+    /* METHODS */
+
+    /**
+     * @brief Write the header of a message.
+     * @param id The id of the message.
+     */
+    void writeHeader(MessageID id) {
+        writeU8(WireProtocol::MAGIC);
+        writeU8(WireProtocol::VERSION);
+        writeU8(static_cast<uint8_t>(id));
+        writeU8(0);
+    }
+
+    void writeU8(uint8_t value) { writeLittleEndian(value); }
+    void writeU16(uint16_t value) { writeLittleEndian(value); }
+    void writeI32(int32_t value) { writeLittleEndian(static_cast<uint32_t>(value)); }
+    void writeF32(float value) { writeLittleEndian(std::bit_cast<uint32_t>(value)); }
+
+    void writeVarU32(uint32_t value) {
+        for (; value >= 0x80; value >>= 7) writeU8(static_cast<uint8_t>(value | 0x80));
+        writeU8(static_cast<uint8_t>(value));
+    }
+
+    void writeVarI32(int32_t value) {
+        writeVarU32((static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31));
+    }
+
+    /**
+     * @brief Append bytes already encoded.
+     * @param bytes The bytes to append.
+     */
+    void writeBytes(std::string_view bytes) {
+        if (overflow || buffer.size() - position < bytes.size()) {
+            overflow = true;
+            return;
+        }
+        std::memcpy(buffer.data() + position, bytes.data(), bytes.size());
+        position += bytes.size();
+    }
+
+
+private:
+    /* SUB METHODS */
+
+    template<typename T>
+    void writeLittleEndian(T value) {
+        if (overflow || buffer.size() - position < sizeof(T)) {
+            overflow = true;
+            return;
+        }
+        for (size_t i = 0; i < sizeof(T); i++) {
+            buffer[position++] = static_cast<char>((value >> (8 * i)) & 0xFF);
+        }
+    }
+};
+
+/**
+ * @class WireReader
+ * @brief Decodes a message in place, the reads past the end of the message return 0 and invalidate it.
+ */
+class WireReader {
+private:
+    /* ATTRIBUTES */
+
+    std::string_view message; /**< The received message. */
+    size_t position = 0; /**< The number of bytes read. */
+    bool overflow = false; /**< True if a read went past the end of the message. */
+
+
+public:
+    /* CONSTRUCTORS */
+
+    explicit WireReader(std::string_view message) : message(message) {}
+
+
+    /* ACCESSORS */
+
+    /**
+     * @brief Check if every read was inside the message.
+     * @return True if the values read are valid.
+     */
+    [[nodiscard]] bool isValid() const { return !overflow; }
+
+    /**
+     * @brief Get the number of bytes left to read.
+     * @return The number of bytes.
+     */
+    [[nodiscard]] size_t getRemaining() const { return message.size() - position; }
+
+
+    /* METHODS */
+
+    /**
+     * @brief Read and check the header of a message.
+     * @param id The id of the message, set if the header is valid.
+     * @return True if the header has the magic byte, the current version, a known id and a body of the minimum size.
+     */
+    bool readHeader(MessageID &id) {
+        uint8_t magic = readU8();
+        uint8_t version = readU8();
+        uint8_t rawID = readU8();
+        readU8();
+
+        if (!isValid() || magic != WireProtocol::MAGIC || version != WireProtocol::VERSION) return false;
+        if (rawID == 0 || rawID > WireProtocol::MESSAGES.size()) return false;
+
+        id = static_cast<MessageID>(rawID);
+        return getRemaining() >= WireProtocol::getLayout(id).bodySize;
+    }
+
+    uint8_t readU8() { return readLittleEndian<uint8_t>(); }
+    uint16_t readU16() { return readLittleEndian<uint16_t>(); }
+    int32_t readI32() { return static_cast<int32_t>(readLittleEndian<uint32_t>()); }
+    float readF32() { return std::bit_cast<float>(readLittleEndian<uint32_t>()); }
+
+    uint32_t readVarU32() {
+        uint32_t value = 0;
+        for (int shift = 0; shift < 35; shift += 7) {
+            uint8_t byte = readU8();
+            value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) return value;
+        }
+        overflow = true;
+        return 0;
+    }
+
+    int32_t readVarI32() {
+        uint32_t value = readVarU32();
+        return static_cast<int32_t>(value >> 1) ^ -static_cast<int32_t>(value & 1);
+    }
+
+    /**
+     * @brief Mark the message as invalid, when a decoded value is inconsistent.
+     */
+    void invalidate() { overflow = true; }
+
+
+private:
+    /* SUB METHODS */
+
+    template<typename T>
+    T readLittleEndian() {
+        if (overflow || message.size() - position < sizeof(T)) {
+            overflow = true;
+            return 0;
+        }
+        T value = 0;
+        for (size_t i = 0; i < sizeof(T); i++) {
+            value |= static_cast<T>(static_cast<T>(static_cast<uint8_t>(message[position++])) << (8 * i));
+        }
+        return value;
+    }
+};
+
+#endif //PLAY_TOGETHER_WIREPROTOCOL_H
@@ -0,0 +1,62 @@
+#ifndef PLAY_TOGETHER_AABBBATCH_H
+#define PLAY_TOGETHER_AABBBATCH_H
+
+#include <vector>
+#include <bit>
+#include <SDL_rect.h>
+
+/**
+ * @file AABBBatch.h
+ * @brief Defines the AABBBatch class storing rectangles as a structure of arrays for batched overlap tests.
+ */
+
+/**
+ * @class AABBBatch
+ * @brief Collection of axis-aligned rectangles stored as a structure of arrays (min/max per axis).
+ *
+ * A query tests one box against every rectangle of the batch with SSE2 (4 rectangles per iteration)
+ * or AVX2 (8 rectangles per iteration, built with the ENABLE_AVX2 option), and a scalar loop otherwise.
+ * The result is the same as calling checkAABBCollision(box, rectangle) on each rectangle.
+ */
+class AABBBatch {
+private:
+    /* ATTRIBUTES */
+
+    std::vector<float> minX; /**< The left side of each rectangle. */
+    std::vector<float> minY; /**< The top side of each rectangle. */
+    std::vector<float> maxX; /**< The right side of each rectangle. */
+    std::vector<float> maxY; /**< The bottom side of each rectangle. */
+
+
+public:
+    /* ACCESSORS */
+
+    /**
+     * @brief Get the number of rectangles in the batch.
+     * @return The number of rectangles.
+     */
+    [[nodiscard]] size_t size() const;
+
+
+    /* METHODS */
+
+    /**
+     * @brief Remove every rectangle from the batch, the memory is kept for the next frame.
+     */
+    void clear();
+
+    /**
+     * @brief Add a rectangle at the end of the batch.
+     * @param rect The rectangle to add.
+     */
+    void push(const SDL_FRect &rect);
+
+    /**
+     * @brief Get the indices of the rectangles overlapping a box.
+     * @param box The box to test.
+     * @param[out] result The indices of the overlapping rectangles, in ascending order.
+     */
+    void query(const SDL_FRect &box, std::vector<size_t> &result) const;
+};
+
+#endif //PLAY_TOGETHER_AABBBATCH_H
@@ -3,7 +3,9 @@
 
 #include <SDL.h>
 #include <numeric>
+#include <span>
 #include "Polygon.h"
+#include "Quad.h"
 #include "../Game/Player.h"
 
 /**
@@ -29,20 +31,32 @@ bool checkAABBCollision(const SDL_FRect &a, const SDL_FRect &b);
 bool checkSATCollision(const std::vector<Point> &playerVertices, const Polygon &obstacle);
 
 /**
- * @brief Checks for Axis-Aligned Bounding Box (AABB) collision between a player and a rectangle, specified to avoid tunnel effect.
- * @param player The player's object that will be checked for collision with the rectangle.
- * @param obstacle SDL_FRect representing the rectangle.
- * @return True if collision detected, false otherwise.
- * @see checkAABBCollision() to only check a collision at one position (may cause tunnel effect).
+ * @brief Checks for Separating Axes Theorem (SAT) collision between a quad collider and a polygon, without any allocation.
+ * @param playerVertices The Quad representing the vertices of the player object.
+ * @param obstacle The polygon obstacle.
+ * @return True if a collision is detected, false otherwise.
+ */
+bool checkSATCollision(const Quad &playerVertices, const Polygon &obstacle);
+
+/**
+ * @brief Computes the exact time of impact between a moving box and a fixed convex polygon (continuous collision).
+ * @param box The box at the start of the move.
+ * @param move The displacement of the box during the move.
+ * @param obstacle The polygon obstacle.
+ * @param[out] timeOfImpact The time of first contact as a fraction of the move in [0, 1], 0 if the box already overlaps the obstacle.
+ * @return True if the box overlaps the obstacle at some point of the move, false otherwise.
+ * @note The SAT axes of the polygon are the same at every instant of the move, so the result is exact.
  */
-bool checkAABBCollisionTunneling(Player *player, const SDL_FRect &obstacle);
+bool sweptSATCollision(const SDL_FRect &box, const Point &move, const Polygon &obstacle, float &timeOfImpact);
 
 /**
  * @brief Checks for Separating Axes Theorem (SAT) collision between a player and a polygons, specified to avoid tunnel effect.
- * @param player The player's object that will be checked for collision with the obstacle.
+ * @param player The player's object that will be checked for collision with the obstacle, once it moved.
  * @param obstacle The polygon obstacle.
- * @return True if collision detected, false otherwise.
+ * @return True if collision detected, false otherwise. On collision, the player's move is shortened to end inside the obstacle,
+ *         so the correction pushes it out on the side it came from.
  * @see checkSATCollision() to only check a collision at one position (may cause tunnel effect).
+ * @see sweptSATCollision() for the time of impact.
  */
 bool checkSATCollisionTunneling(Player *player, const Polygon &obstacle);
 
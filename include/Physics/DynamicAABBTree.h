@@ -0,0 +1,201 @@
+#ifndef PLAY_TOGETHER_DYNAMICAABBTREE_H
+#define PLAY_TOGETHER_DYNAMICAABBTREE_H
+
+#include <vector>
+#include <array>
+#include <cmath>
+#include <algorithm>
+#include <cassert>
+#include <SDL_rect.h>
+
+/**
+ * @file DynamicAABBTree.h
+ * @brief Defines the DynamicAABBTree class used to index moving objects.
+ */
+
+constexpr float DYNAMIC_TREE_MARGIN = 32.0f; /**< Default margin added around the bounds of an object in pixels. */
+
+/**
+ * @class DynamicAABBTree
+ * @brief Bounding volume hierarchy of the moving objects of a collection, balanced like an AVL tree.
+ *
+ * Every leaf stores a fat box (the bounds of the object grown by a margin), so an object moving inside its fat box
+ * only updates its leaf. It is removed and inserted again once it leaves it, which costs O(log n).
+ * The objects are referenced by their index in their collection, so the indices must stay contiguous:
+ * objects are added with push() and removed with swapRemove(), like the collection itself.
+ * The queries only read the tree, so several threads can query it at the same time (but not while it is modified).
+ */
+class DynamicAABBTree {
+private:
+    /* TYPES */
+
+    /**
+     * @struct Node
+     * @brief A node of the tree, either a leaf holding an object or a branch holding two children.
+     */
+    struct Node {
+        SDL_FRect fat = {0, 0, 0, 0}; /**< The box containing the whole subtree (the fat box of the object for a leaf). */
+        SDL_FRect bounds = {0, 0, 0, 0}; /**< The exact bounds of the object (leaf only). */
+        size_t index = 0; /**< The index of the object in its collection (leaf only). */
+        int parent = -1; /**< The parent node, or the next free node when the node is not used. */
+        int left = -1; /**< The first child, -1 for a leaf. */
+        int right = -1; /**< The second child, -1 for a leaf. */
+        int height = 0; /**< The height of the subtree, 0 for a leaf and -1 for a free node. */
+
+        [[nodiscard]] bool isLeaf() const { return left == -1; }
+    };
+
+    /**
+     * @struct TraversalStack
+     * @brief The nodes to visit during a traversal, local to the query so concurrent queries do not share it.
+     *
+     * A traversal holds at most one pending sibling per level plus the two children of the node visited, and the
+     * height of an AVL tree stays below 1.44 log2(n + 2), so 64 entries cover any tree indexed by an int.
+     */
+    struct TraversalStack {
+        std::array<int, 64> entries; /**< The nodes to visit (not initialized, only the first size entries are read). */
+        size_t size = 0; /**< The number of nodes to visit. */
+
+        void push(int node) { assert(size < entries.size()); entries[size++] = node; }
+        int pop() { return entries[--size]; }
+        [[nodiscard]] bool empty() const { return size == 0; }
+    };
+
+
+    /* ATTRIBUTES */
+
+    float margin; /**< The margin added around the bounds of an object in pixels. */
+    std::vector<Node> nodes; /**< The nodes of the tree, the free ones are chained through their parent. */
+    std::vector<int> leaves; /**< The leaf of each object, by index in the collection. */
+    int root = -1; /**< The root node, -1 if the tree is empty. */
+    int freeList = -1; /**< The first free node, -1 if every node is used. */
+
+
+public:
+    /* CONSTRUCTORS */
+
+    explicit DynamicAABBTree(float margin = DYNAMIC_TREE_MARGIN);
+
+
+    /* ACCESSORS */
+
+    /**
+     * @brief Get the number of objects in the tree.
+     * @return The number of objects.
+     */
+    [[nodiscard]] size_t size() const;
+
+    /**
+     * @brief Get the height of the tree.
+     * @return The height of the root, 0 if the tree is empty.
+     */
+    [[nodiscard]] int getHeight() const;
+
+
+    /* METHODS */
+
+    /**
+     * @brief Remove every object from the tree.
+     */
+    void clear();
+
+    /**
+     * @brief Add an object at the end of the collection.
+     * @param bounds The bounds of the object.
+     */
+    void push(const SDL_FRect &bounds);
+
+    /**
+     * @brief Update the bounds of an object, its leaf is moved only if it leaves its fat box.
+     * @param index The index of the object in its collection.
+     * @param bounds The new bounds of the object.
+     * @return True if the leaf has been inserted again, false if only its bounds changed.
+     */
+    bool update(size_t index, const SDL_FRect &bounds);
+
+    /**
+     * @brief Remove an object, the last object of the collection takes its index (swap and pop).
+     * @param index The index of the object in its collection.
+     */
+    void swapRemove(size_t index);
+
+    /**
+     * @brief Get the indices of the objects overlapping an area.
+     * @param area The area to query.
+     * @param[out] result The indices of the objects, in ascending order.
+     * @note The bounds are tested like checkAABBCollision(), so touching boxes do not overlap.
+     */
+    void query(const SDL_FRect &area, std::vector<size_t> &result) const;
+
+private:
+
+    /**
+     * @brief Take a node from the free list, the node storage grows if needed.
+     * @return The index of the node.
+     */
+    int allocateNode();
+
+    /**
+     * @brief Give a node back to the free list.
+     * @param node The index of the node.
+     */
+    void freeNode(int node);
+
+    /**
+     * @brief Insert a leaf next to the sibling that grows the tree the least.
+     * @param leaf The index of the leaf.
+     */
+    void insertLeaf(int leaf);
+
+    /**
+     * @brief Detach a leaf from the tree, its parent is freed and its sibling takes its place.
+     * @param leaf The index of the leaf.
+     */
+    void removeLeaf(int leaf);
+
+    /**
+     * @brief Refit the boxes and the heights from a node to the root, rebalancing every node on the way.
+     * @param node The first node to refit.
+     */
+    void refit(int node);
+
+    /**
+     * @brief Rotate a node if the heights of its children differ by more than one.
+     * @param node The index of the node.
+     * @return The index of the node now at the place of the given one.
+     */
+    int balance(int node);
+
+    /**
+     * @brief Move a child up to the place of its parent, the parent keeps the shortest child of the moved node.
+     * @param node The index of the parent.
+     * @param child The index of the child to move up.
+     * @return The index of the child.
+     */
+    int rotate(int node, int child);
+
+    /**
+     * @brief Get the box containing two boxes.
+     * @param a The first box.
+     * @param b The second box.
+     * @return The union of the boxes.
+     */
+    static SDL_FRect combine(const SDL_FRect &a, const SDL_FRect &b);
+
+    /**
+     * @brief Get the perimeter of a box, used as the cost of a node.
+     * @param box The box.
+     * @return The perimeter of the box.
+     */
+    static float perimeter(const SDL_FRect &box);
+
+    /**
+     * @brief Check if a box is entirely inside another one.
+     * @param outer The containing box.
+     * @param inner The contained box.
+     * @return True if inner is inside outer, false otherwise.
+     */
+    static bool contains(const SDL_FRect &outer, const SDL_FRect &inner);
+};
+
+#endif //PLAY_TOGETHER_DYNAMICAABBTREE_H
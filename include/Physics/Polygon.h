@@ -3,6 +3,9 @@
 
 #include <vector>
 #include <cmath>
+#include <algorithm>
+#include <limits>
+#include <SDL_rect.h>
 #include "../Game/Point.h"
 
 /**
@@ -20,6 +23,15 @@ enum class PolygonType {
     EVENT
 };
 
+/**
+ * @struct Projection
+ * @brief Interval covered by a shape projected onto an axis.
+ */
+struct Projection {
+    float min; /**< The minimum of the projection. */
+    float max; /**< The maximum of the projection. */
+};
+
 /**
  * @class Polygon
  * @brief Represents a polygon in 2D space.
@@ -30,6 +42,10 @@ private:
 
     std::vector<Point> vertices; /**< The vertices of the polygon. */
     PolygonType type; /**< The type of the zone. */
+    SDL_FRect boundingBox = {0, 0, 0, 0}; /**< The axis-aligned bounding box of the polygon. */
+    bool convex = false; /**< Whether the polygon is convex, computed once when the polygon is built. */
+    std::vector<Point> axes; /**< The separating axes of the polygon (x-axis, y-axis then the edge normals). */
+    std::vector<Projection> projections; /**< The projection of the polygon onto each of its axes. */
 
 
 public:
@@ -44,7 +60,7 @@ public:
      * @brief Get the vertices of the polygon.
      * @return The vertices of the polygon.
      */
-    [[nodiscard]] std::vector<Point> getVertices() const;
+    [[nodiscard]] const std::vector<Point> &getVertices() const;
 
     /**
      * @brief Get the type of the zone.
@@ -52,18 +68,48 @@ public:
      */
     [[nodiscard]] PolygonType getType() const;
 
+    /**
+     * @brief Get the axis-aligned bounding box of the polygon.
+     * @return The bounding box of the polygon.
+     */
+    [[nodiscard]] SDL_FRect getBoundingBox() const;
+
+    /**
+     * @brief Get the separating axes used by the SAT: the x-axis, the y-axis then the normal of each edge.
+     * @return The axes of the polygon.
+     */
+    [[nodiscard]] const std::vector<Point> &getAxes() const;
+
+    /**
+     * @brief Get the projection of the polygon onto each of its axes.
+     * @return The projections, in the same order as the axes.
+     * @see getAxes() for the axes.
+     */
+    [[nodiscard]] const std::vector<Projection> &getProjections() const;
+
 
     /* METHODS */
 
     /**
      * @brief Checks if a polygon is convex.
-     * @param polygon The polygon to check.
      * @return True if the polygon is convex, false otherwise.
      */
     [[nodiscard]] bool isConvex() const;
 
 private:
 
+    /**
+     * @brief Precompute the data used by the SAT (convexity, axes and projections).
+     * @note The vertices never change, so this is only done once when the polygon is built.
+     */
+    void bake();
+
+    /**
+     * @brief Checks if the vertices of the polygon form a convex shape.
+     * @return True if the polygon is convex, false otherwise.
+     */
+    [[nodiscard]] bool computeConvexity() const;
+
     /**
      * @brief Calculate the distance between two points.
      * @param a The first point.
@@ -0,0 +1,29 @@
+#ifndef PLAY_TOGETHER_QUAD_H
+#define PLAY_TOGETHER_QUAD_H
+
+#include <array>
+#include "../Game/Point.h"
+
+/**
+ * @file Quad.h
+ * @brief Defines the Quad type used for the colliders of the players and the asteroids.
+ */
+
+/**
+ * @brief The four vertices of a collider, stored inline so building one never allocates.
+ */
+using Quad = std::array<Point, 4>;
+
+/**
+ * @brief Build the quad of an axis-aligned rectangle.
+ * @param x The x-coordinate of the top-left corner.
+ * @param y The y-coordinate of the top-left corner.
+ * @param w The width of the rectangle.
+ * @param h The height of the rectangle.
+ * @return The vertices of the rectangle, clockwise from the top-left corner.
+ */
+constexpr Quad makeQuad(float x, float y, float w, float h) {
+    return {{{x, y}, {x + w, y}, {x + w, y + h}, {x, y + h}}};
+}
+
+#endif //PLAY_TOGETHER_QUAD_H
@@ -0,0 +1,94 @@
+#ifndef PLAY_TOGETHER_SPATIALGRID_H
+#define PLAY_TOGETHER_SPATIALGRID_H
+
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <unordered_map>
+#include <SDL_rect.h>
+
+/**
+ * @file SpatialGrid.h
+ * @brief Defines the SpatialGrid class used to index static level geometry.
+ */
+
+constexpr float SPATIAL_GRID_CELL_SIZE = 512.0f; /**< Default size of a grid cell in pixels. */
+
+/**
+ * @class SpatialGrid
+ * @brief Uniform grid (spatial hash) storing object indices by the cells their bounding box overlaps.
+ *
+ * The grid is built once when the level is loaded, it only stores indices into the level collections,
+ * so a query returns the indices of every object that may overlap the given area in O(cells + results).
+ */
+class SpatialGrid {
+private:
+    /* ATTRIBUTES */
+
+    float cellSize; /**< The size of a cell in pixels. */
+    size_t count = 0; /**< The number of objects inserted in the grid. */
+    std::unordered_map<uint64_t, std::vector<size_t>> cells; /**< Indices of the objects overlapping each cell. */
+
+
+public:
+    /* CONSTRUCTORS */
+
+    explicit SpatialGrid(float cellSize = SPATIAL_GRID_CELL_SIZE);
+
+
+    /* ACCESSORS */
+
+    /**
+     * @brief Get the size of a cell.
+     * @return The size of a cell in pixels.
+     */
+    [[nodiscard]] float getCellSize() const;
+
+    /**
+     * @brief Get the number of objects inserted in the grid.
+     * @return The number of objects.
+     */
+    [[nodiscard]] size_t getCount() const;
+
+
+    /* METHODS */
+
+    /**
+     * @brief Remove every object from the grid.
+     */
+    void clear();
+
+    /**
+     * @brief Insert an object in every cell overlapped by its bounding box.
+     * @param index The index of the object in its collection.
+     * @param bounds The bounding box of the object.
+     */
+    void insert(size_t index, const SDL_FRect &bounds);
+
+    /**
+     * @brief Get the indices of the objects stored in the cells overlapped by an area.
+     * @param area The area to query.
+     * @param[out] result The indices found, sorted in ascending order and without duplicates.
+     */
+    void query(const SDL_FRect &area, std::vector<size_t> &result) const;
+
+private:
+
+    /**
+     * @brief Get the cell coordinate containing a world coordinate.
+     * @param value The world coordinate.
+     * @return The cell coordinate.
+     */
+    [[nodiscard]] int toCell(float value) const;
+
+    /**
+     * @brief Get the hash key of a cell.
+     * @param cellX The x-coordinate of the cell.
+     * @param cellY The y-coordinate of the cell.
+     * @return The key of the cell.
+     */
+    static uint64_t key(int cellX, int cellY);
+};
+
+#endif //PLAY_TOGETHER_SPATIALGRID_H
@@ -0,0 +1,120 @@
+#ifndef PLAY_TOGETHER_TRIGGERSET_H
+#define PLAY_TOGETHER_TRIGGERSET_H
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <tuple>
+#include "AABB.h"
+#include "../Utils/Handle.h"
+
+/**
+ * @file TriggerSet.h
+ * @brief Defines the TriggerSet class tracking the trigger zones overlapped by a player.
+ */
+
+/**
+ * @enum TriggerPhase
+ * @brief The transition of an overlap between two ticks.
+ */
+enum class TriggerPhase {
+    ENTER, /**< The zone is overlapped since this tick. */
+    STAY, /**< The zone was already overlapped at the previous tick. */
+    EXIT /**< The zone is no longer overlapped since this tick. */
+};
+
+/**
+ * @struct TriggerEvent
+ * @brief A zone overlapped at this tick or at the previous one.
+ */
+struct TriggerEvent {
+    AABBType type; /**< The type of the zone. */
+    Handle<AABB> zone; /**< The handle of the zone in the collection of its type. */
+    TriggerPhase phase; /**< The transition of the overlap. */
+};
+
+/**
+ * @class TriggerSet
+ * @brief The overlap set of an object with the trigger zones, updated once per tick to emit enter, stay and exit events.
+ *
+ * The zones overlapped during a tick are collected with overlap(), then update() compares them with the set of the
+ * previous tick (both sorted, a single merge) and calls back once per zone. Every zone keeps its own overlap, so two
+ * overlapping zones never reset each other.
+ */
+class TriggerSet {
+private:
+    /* TYPES */
+
+    /**
+     * @struct Overlap
+     * @brief A zone overlapped by the object.
+     */
+    struct Overlap {
+        AABBType type; /**< The type of the zone. */
+        Handle<AABB> zone; /**< The handle of the zone. */
+
+        auto operator<=>(const Overlap &other) const {
+            return std::tie(type, zone.index, zone.generation) <=> std::tie(other.type, other.zone.index, other.zone.generation);
+        }
+        bool operator==(const Overlap &) const = default;
+    };
+
+
+    /* ATTRIBUTES */
+
+    std::vector<Overlap> overlaps; /**< The zones overlapped at the last update, sorted. */
+    std::vector<Overlap> touching; /**< The zones collected since the last update (the capacity is kept between the ticks). */
+
+
+public:
+    /* ACCESSORS */
+
+    /**
+     * @brief Count the zones of a type overlapped at the last update.
+     * @param type The type of the zones.
+     * @return The number of zones.
+     */
+    [[nodiscard]] size_t count(AABBType type) const;
+
+
+    /* METHODS */
+
+    /**
+     * @brief Collect a zone overlapped during this tick.
+     * @param type The type of the zone.
+     * @param zone The handle of the zone.
+     */
+    void overlap(AABBType type, Handle<AABB> zone);
+
+    /**
+     * @brief Replace the overlap set by the zones collected during this tick and emit the transitions.
+     * @param callback Called with every TriggerEvent, once the new set is in place (count() already sees it).
+     */
+    template<typename Callback>
+    void update(Callback &&callback) {
+        std::ranges::sort(touching);
+        touching.erase(std::ranges::unique(touching).begin(), touching.end());
+        std::swap(overlaps, touching); // The previous set is now in touching
+
+        // Merge the two sorted sets
+        auto previous = touching.begin();
+        auto current = overlaps.begin();
+        while (previous != touching.end() || current != overlaps.end()) {
+            if (current == overlaps.end() || (previous != touching.end() && *previous < *current)) {
+                callback(TriggerEvent{previous->type, previous->zone, TriggerPhase::EXIT});
+                ++previous;
+            } else if (previous == touching.end() || *current < *previous) {
+                callback(TriggerEvent{current->type, current->zone, TriggerPhase::ENTER});
+                ++current;
+            } else {
+                callback(TriggerEvent{current->type, current->zone, TriggerPhase::STAY});
+                ++previous;
+                ++current;
+            }
+        }
+
+        touching.clear();
+    }
+};
+
+#endif //PLAY_TOGETHER_TRIGGERSET_H
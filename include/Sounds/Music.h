@@ -21,7 +21,7 @@ class Music {
 private:
     /* ATTRIBUTES */
 
-    Mix_Music* music; /**< The music file to be played. */
+    Mix_Music* music = nullptr; /**< The music file to be played, nullptr if it is not loaded. */
 
 public:
 
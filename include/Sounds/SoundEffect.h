@@ -22,7 +22,7 @@ class SoundEffect {
 private:
     /* ATTRIBUTES */
 
-    Mix_Chunk* sound; /**< The sound file to be played. */
+    Mix_Chunk* sound = nullptr; /**< The sound file to be played, nullptr if it is not loaded. */
     int volume = 20; /**< The sound volume. */
 
 public:
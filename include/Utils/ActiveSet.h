@@ -0,0 +1,75 @@
+#ifndef PLAY_TOGETHER_ACTIVESET_H
+#define PLAY_TOGETHER_ACTIVESET_H
+
+#include <vector>
+#include <cstddef>
+
+/**
+ * @file ActiveSet.h
+ * @brief Defines the ActiveSet class used to schedule the awake objects of a collection.
+ */
+
+/**
+ * @class ActiveSet
+ * @brief Sparse set of the indices of the awake objects of a collection.
+ *
+ * Waking up or putting to sleep an object costs O(1) and the iteration only visits the awake objects.
+ * The order of the iteration is not the order of the collection.
+ */
+class ActiveSet {
+private:
+    /* ATTRIBUTES */
+
+    std::vector<size_t> dense; /**< The indices of the awake objects. */
+    std::vector<size_t> sparse; /**< The position of each object in the dense array, npos if it is sleeping. */
+
+
+public:
+    /* CONSTANTS */
+
+    static constexpr size_t npos = static_cast<size_t>(-1); /**< Position of a sleeping object. */
+
+
+    /* ACCESSORS */
+
+    /**
+     * @brief Get the number of awake objects.
+     * @return The number of awake objects.
+     */
+    [[nodiscard]] size_t size() const;
+
+    /**
+     * @brief Check if an object is awake.
+     * @param index The index of the object in its collection.
+     * @return True if the object is awake, false otherwise.
+     */
+    [[nodiscard]] bool contains(size_t index) const;
+
+    [[nodiscard]] std::vector<size_t>::const_iterator begin() const;
+    [[nodiscard]] std::vector<size_t>::const_iterator end() const;
+
+
+    /* METHODS */
+
+    /**
+     * @brief Put every object to sleep and set the size of the collection.
+     * @param size The number of objects in the collection.
+     */
+    void reset(size_t size);
+
+    /**
+     * @brief Wake up an object, nothing happens if it is already awake.
+     * @param index The index of the object in its collection, lower than the size given to reset().
+     * @return True if the object was sleeping, false otherwise.
+     */
+    bool insert(size_t index);
+
+    /**
+     * @brief Put an object to sleep, the last awake object takes its position (swap and pop).
+     * @param index The index of the object in its collection.
+     * @return True if the object was awake, false otherwise.
+     */
+    bool erase(size_t index);
+};
+
+#endif //PLAY_TOGETHER_ACTIVESET_H
@@ -0,0 +1,25 @@
+#ifndef PLAY_TOGETHER_ALLOCATIONCOUNTER_H
+#define PLAY_TOGETHER_ALLOCATIONCOUNTER_H
+
+#include <cstddef>
+
+/**
+ * @file AllocationCounter.h
+ * @brief Declares the heap allocation counter available in development mode.
+ *
+ * In development mode the global operator new is replaced to count the allocations of each thread.
+ * It is only a diagnostic: the collision narrow phase logs a warning on std::cerr when it allocates,
+ * nothing fails and release builds do not count anything. The aligned forms of operator new are not counted.
+ */
+
+#ifdef DEVELOPMENT_MODE
+
+/**
+ * @brief Get the number of heap allocations made by the calling thread since it started.
+ * @return The number of allocations.
+ */
+[[nodiscard]] size_t getAllocationCount();
+
+#endif
+
+#endif //PLAY_TOGETHER_ALLOCATIONCOUNTER_H
@@ -67,6 +67,7 @@ private:
     void disableMechanics(const std::string& command) const;
     void toggleRendering() const;
     void toggleFPSRendering() const;
+    void configureBroadPhase(const std::string& command) const;
     void changeMaxFrameRate(const std::string& command) const;
 };
 
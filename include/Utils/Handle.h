@@ -0,0 +1,53 @@
+#ifndef PLAY_TOGETHER_HANDLE_H
+#define PLAY_TOGETHER_HANDLE_H
+
+#include <vector>
+#include <cstdint>
+
+/**
+ * @file Handle.h
+ * @brief Defines the Handle structure used to reference an object stored in a level collection.
+ */
+
+/**
+ * @struct Handle
+ * @brief Typed reference to an object of a collection (index + generation).
+ *
+ * The generation is the one of the collection when the handle was created. It changes every time the collection
+ * is reloaded or an object is removed from it, so a handle can never resolve to an object that moved.
+ */
+template<typename T>
+struct Handle {
+    uint32_t index = 0; /**< The index of the object in its collection. */
+    uint32_t generation = 0; /**< The generation of the collection when the handle was created. */
+
+    bool operator==(const Handle &) const = default;
+};
+
+/**
+ * @brief Resolve a handle in a collection.
+ * @param collection The collection containing the object.
+ * @param generation The current generation of the collection.
+ * @param handle The handle to resolve.
+ * @return A pointer to the object, nullptr if the handle is no longer valid.
+ */
+template<typename T>
+[[nodiscard]] T *resolveHandle(std::vector<T> &collection, uint32_t generation, Handle<T> handle) {
+    if (handle.generation != generation || handle.index >= collection.size()) return nullptr;
+    return &collection[handle.index];
+}
+
+/**
+ * @brief Resolve a handle in a constant collection.
+ * @param collection The collection containing the object.
+ * @param generation The current generation of the collection.
+ * @param handle The handle to resolve.
+ * @return A pointer to the object, nullptr if the handle is no longer valid.
+ */
+template<typename T>
+[[nodiscard]] const T *resolveHandle(const std::vector<T> &collection, uint32_t generation, Handle<T> handle) {
+    if (handle.generation != generation || handle.index >= collection.size()) return nullptr;
+    return &collection[handle.index];
+}
+
+#endif //PLAY_TOGETHER_HANDLE_H
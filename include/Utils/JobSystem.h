@@ -0,0 +1,149 @@
+#ifndef PLAY_TOGETHER_JOBSYSTEM_H
+#define PLAY_TOGETHER_JOBSYSTEM_H
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include "TaskGraph.h"
+
+/**
+ * @file JobSystem.h
+ * @brief Defines the JobSystem class used to spread the work of a frame over the cores.
+ */
+
+/**
+ * @class JobSystem
+ * @brief Work-stealing scheduler running the stages of a TaskGraph and the chunks of parallel loops.
+ *
+ * Every worker owns a queue: it takes its own jobs from the back and, once it is empty, steals the oldest jobs of
+ * the other workers from the front. The thread submitting the work (the simulation thread of the game) is the worker
+ * 0, it takes part in the work while it waits, so a system without worker threads runs everything sequentially.
+ * A single thread outside of the workers may submit work at a time.
+ * A job may start a parallel loop (a stage looping over the players for example), the worker keeps running jobs
+ * until the loop is done.
+ */
+class JobSystem {
+private:
+    /* TYPES */
+
+    /**
+     * @struct Job
+     * @brief A range of work, either a chunk of a parallel loop or a stage of a graph.
+     */
+    struct Job {
+        const std::function<void(size_t, size_t)> *body = nullptr; /**< The body of the loop, nullptr for a stage. */
+        TaskGraph *graph = nullptr; /**< The graph of the stage, nullptr for a chunk. */
+        size_t begin = 0; /**< The first iteration of the chunk, or the index of the stage. */
+        size_t end = 0; /**< The iteration following the chunk. */
+        std::atomic<size_t> *pending = nullptr; /**< Decreased once the job is done. */
+    };
+
+    /**
+     * @struct WorkQueue
+     * @brief The queue of a worker.
+     */
+    struct WorkQueue {
+        std::mutex mutex; /**< Mutex protecting the jobs, the owner and the thieves use opposite ends. */
+        std::deque<Job> jobs; /**< The jobs waiting to run. */
+    };
+
+
+    /* ATTRIBUTES */
+
+    std::vector<std::unique_ptr<WorkQueue>> queues; /**< The queue of each worker, the worker 0 is the thread submitting the work. */
+    std::atomic<size_t> queuedJobs = 0; /**< The number of jobs in every queue, the idle workers sleep while it is 0. */
+    std::mutex sleepMutex; /**< Mutex used by the idle workers to sleep. */
+    std::condition_variable_any wakeUp; /**< Wakes up the idle workers when jobs are queued (or when the system stops). */
+    std::vector<std::jthread> workers; /**< The worker threads (declared last, so they stop before the rest is destroyed). */
+
+    inline static thread_local size_t currentWorker = 0; /**< The index of the worker running on this thread. */
+
+
+public:
+    /* CONSTRUCTORS */
+
+    /**
+     * @brief Start the worker threads.
+     * @param threadCount The number of worker threads, the calling thread is not included.
+     */
+    explicit JobSystem(size_t threadCount = std::max(std::thread::hardware_concurrency(), 1u) - 1);
+
+    JobSystem(const JobSystem &) = delete;
+    JobSystem &operator=(const JobSystem &) = delete;
+
+
+    /* ACCESSORS */
+
+    /**
+     * @brief Get the number of workers running jobs.
+     * @return The number of worker threads plus the thread submitting the work.
+     */
+    [[nodiscard]] size_t getWorkerCount() const;
+
+
+    /* METHODS */
+
+    /**
+     * @brief Run the iterations of a loop on every worker and wait until they are all done.
+     * @param iterations The number of iterations.
+     * @param body The body of the loop, called with the index of the iteration and the index of the worker running it.
+     * @param grain The minimum number of iterations of a job, a small loop runs on the calling worker only.
+     * @note It may be called from a job, but only by the thread submitting the work or by a worker.
+     */
+    void parallelFor(size_t iterations, const std::function<void(size_t, size_t)> &body, size_t grain = 1);
+
+    /**
+     * @brief Run every stage of a graph, each one once its dependencies are done, and wait until they are all done.
+     * @param graph The graph to run, its timings are updated.
+     * @note Only the thread submitting the work may run a graph, never from a job.
+     */
+    void run(TaskGraph &graph);
+
+private:
+
+    /**
+     * @brief Queue a job on a worker and wake up an idle worker to steal it.
+     * @param worker The index of the worker.
+     * @param job The job.
+     */
+    void push(size_t worker, const Job &job);
+
+    /**
+     * @brief Take the newest job of a worker, or steal the oldest job of another worker.
+     * @param worker The index of the worker.
+     * @param[out] job The job taken.
+     * @return True if a job has been taken, false if every queue is empty.
+     */
+    bool take(size_t worker, Job &job);
+
+    /**
+     * @brief Run the jobs of every worker until a counter drops to zero.
+     * @param pending The number of jobs to wait for.
+     * @param worker The index of the waiting worker.
+     */
+    void waitFor(const std::atomic<size_t> &pending, size_t worker);
+
+    /**
+     * @brief Main loop of a worker thread, it runs jobs and sleeps while there is none.
+     * @param stopToken Token requested when the system is destroyed.
+     * @param worker The index of the worker.
+     */
+    void work(const std::stop_token &stopToken, size_t worker);
+
+    /**
+     * @brief Run a job: the iterations of a chunk, or a stage followed by the successors whose dependencies are all done.
+     * @param job The job.
+     * @param worker The index of the worker.
+     */
+    void execute(const Job &job, size_t worker);
+};
+
+#endif //PLAY_TOGETHER_JOBSYSTEM_H
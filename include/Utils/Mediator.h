@@ -2,12 +2,16 @@
 #define PLAY_TOGETHER_MEDIATOR_H
 
 #include <string>
+#include <string_view>
 #include <SDL.h>
 #include <array>
+#include <mutex>
+#include <vector>
+#include <functional>
 #include <unordered_map>
 
 #include "MessageQueue.h"
-#include "../Game/Player.h"
+#include "../Game/PlayerSlotMap.h"
 #include "../Game/Events/Asteroid.h"
 #include "../../dependencies/json.hpp"
 
@@ -41,6 +45,9 @@ private:
     static NetworkManager *networkManagerPtr; /**< Pointer to the associated NetworkManager object. */
     static const std::array<SDL_Scancode, 7> keyMapping;
     static std::unordered_map<int, std::unordered_map<SDL_Scancode, bool>> playersKeyStates; // Map of player ID to key states
+    static std::mutex networkEventsMutex; /**< Mutex protecting the network events queued for the simulation thread. */
+    static std::vector<std::function<void()>> networkEvents; /**< The changes of the game received since the last tick. */
+    static std::vector<std::function<void()>> tickNetworkEvents; /**< The network events applied by the current tick (swapped with the queue). */
 
 public:
     /** CONSTRUCTORS **/
@@ -84,8 +91,24 @@ public:
     static void startClients(const std::string& serverIP, short serverPort);
     static void stopServers();
     static void stopClients();
-    static void sendPlayerUpdate(uint16_t keyboardStateMask);
-    static void sendSyncCorrection(nlohmann::json &message);
+    static void sendPlayerUpdate(uint16_t inputSequence, uint16_t keyboardStateMask);
+    static void sendSyncCorrection();
+
+    /**
+     * @brief Reconciles the local player with the last authoritative state received, on the simulation thread.
+     */
+    static void reconcilePrediction();
+
+    /**
+     * @brief Records the position predicted for the local player at the end of the tick, reconciled with the sync corrections.
+     */
+    static void savePredictedPosition();
+
+    /**
+     * @brief Applies the changes of the game received from the network since the last tick (players, asteroids, corrections).
+     * @note Called by the simulation thread at the start of a tick, the network threads only queue them.
+     */
+    static void applyNetworkEvents();
     static void sendAsteroidCreation(Asteroid const &asteroid);
 
     // Menu methods
@@ -101,20 +124,20 @@ public:
     static void stop();
     static void save();
     static void getGameProperties(nlohmann::json &properties);
-    static std::vector<Player> const &getAlivePlayers();
+    static PlayerSlotMap::View getAlivePlayers();
 
     // Other methods
     /**
-     * @brief Handles a client connection.
+     * @brief Handles a client connection, the player is added at the next tick.
      * @param playerID The ID of the player who connected.
      */
-    static int handleClientConnect(int playerID);
+    static void handleClientConnect(int playerID);
 
     /**
-     * @brief Handles a client disconnection.
+     * @brief Handles a client disconnection, the player is removed at the next tick.
      * @param playerID The ID of the player who disconnected.
      */
-    static int handleClientDisconnect(int playerID);
+    static void handleClientDisconnect(int playerID);
 
     /**
      * @brief Handles messages received from the network.
@@ -122,7 +145,7 @@ public:
      * @param message The message received.
      * @param playerID The ID of the player who sent the message. (0 for server)
      */
-    static void handleMessages(int protocol, const std::string &message, int playerID);
+    static void handleMessages(int protocol, std::string_view message, int playerID);
 
     /**
      * @brief Creates a mask of the keyboard state. Each bit represents a key.
@@ -141,6 +164,25 @@ private:
     /** PRIVATE METHODS **/
 
     static void handleKeyboardState(Player *player, std::array<int, SDL_NUM_SCANCODES> &keyStates);
+
+    /**
+     * @brief Queues a change of the game received from the network, the simulation thread applies it at the next tick.
+     * @param event The change to apply.
+     */
+    static void queueNetworkEvent(std::function<void()> event);
+
+    /**
+     * @brief Forgets the network events not applied yet, when the network stops.
+     */
+    static void clearNetworkEvents();
+
+    /**
+     * @brief Handles a binary message received from the network (see WireProtocol.h).
+     * @param protocol The protocol used to send the message (0 for TCP, 1 for UDP).
+     * @param message The message received.
+     * @param playerID The ID of the player who sent the message. (0 for server)
+     */
+    static void handleBinaryMessage(int protocol, std::string_view message, int playerID);
 };
 
 #endif //PLAY_TOGETHER_MEDIATOR_H
@@ -0,0 +1,81 @@
+#ifndef PLAY_TOGETHER_SIMULATIONCLOCK_H
+#define PLAY_TOGETHER_SIMULATIONCLOCK_H
+
+#include <SDL.h>
+#include <cstdint>
+#include <atomic>
+
+/**
+ * @file SimulationClock.h
+ * @brief Defines the SimulationClock class used to time the gameplay.
+ */
+
+constexpr uint64_t SIMULATION_TICK_RATE = 120; /**< The default number of simulation ticks in one second of game time. */
+
+/**
+ * @class SimulationClock
+ * @brief The clock of the simulation, advanced by the game loop one tick at a time.
+ *
+ * The gameplay code reads this clock instead of the wall clock (SDL_GetTicks, time), so the simulation only depends on
+ * the number of ticks: it can run faster than real time and every peer simulating the same ticks gets the same result.
+ */
+class SimulationClock {
+private:
+    /* ATTRIBUTES */
+
+    static std::atomic<uint64_t> tick; /**< The number of ticks simulated since the start of the game (read by the network threads). */
+    static uint64_t tickRate; /**< The number of ticks in one second of game time. */
+
+
+public:
+    /* ACCESSORS */
+
+    /**
+     * @brief Return the tick attribute.
+     * @return The number of ticks simulated since the start of the game.
+     */
+    [[nodiscard]] static uint64_t getTick();
+
+    /**
+     * @brief Return the game time, the counterpart of SDL_GetTicks() for the gameplay.
+     * @return The number of milliseconds of game time simulated since the start of the game.
+     */
+    [[nodiscard]] static Uint32 getTicks();
+
+    /**
+     * @brief Return the tickRate attribute.
+     * @return The number of ticks in one second of game time.
+     */
+    [[nodiscard]] static uint64_t getTickRate();
+
+    /**
+     * @brief Return the duration of a tick.
+     * @return The duration of a tick in seconds.
+     */
+    [[nodiscard]] static double getStepSeconds();
+
+
+    /* MODIFIERS */
+
+    /**
+     * @brief Set the tick attribute, used to replay or resynchronize a simulation.
+     * @param value The new tick.
+     */
+    static void setTick(uint64_t value);
+
+    /**
+     * @brief Set the tickRate attribute, every peer of a game has to use the same rate.
+     * @param rate The new number of ticks in one second, 0 is ignored.
+     */
+    static void setTickRate(uint64_t rate);
+
+
+    /* METHODS */
+
+    /**
+     * @brief Advance the clock by one tick, called by the game loop before every simulation tick.
+     */
+    static void advance();
+};
+
+#endif //PLAY_TOGETHER_SIMULATIONCLOCK_H
@@ -0,0 +1,107 @@
+#ifndef PLAY_TOGETHER_TASKGRAPH_H
+#define PLAY_TOGETHER_TASKGRAPH_H
+
+#include <deque>
+#include <vector>
+#include <string>
+#include <functional>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @file TaskGraph.h
+ * @brief Defines the TaskGraph class describing the stages of a frame and their dependencies.
+ */
+
+/**
+ * @class TaskGraph
+ * @brief Stages of work linked by dependencies, run by JobSystem::run().
+ *
+ * A stage starts once every stage it depends on is done, so the stages without a path between them run concurrently.
+ * The graph is built once and run as many times as needed, the duration of every stage is measured on each run.
+ */
+class TaskGraph {
+private:
+    /* TYPES */
+
+    /**
+     * @struct Stage
+     * @brief A stage of the graph.
+     */
+    struct Stage {
+        std::string name; /**< The name of the stage, used by the timings. */
+        std::function<void()> function; /**< The work of the stage. */
+        std::vector<size_t> successors; /**< The stages depending on this one. */
+        size_t dependencies = 0; /**< The number of stages this one depends on. */
+        std::atomic<size_t> remaining = 0; /**< The number of dependencies not done yet during a run. */
+        double milliseconds = 0; /**< The duration of the last run in milliseconds. */
+        double totalMilliseconds = 0; /**< The duration of every run since the last reset in milliseconds. */
+    };
+
+
+    /* ATTRIBUTES */
+
+    std::deque<Stage> stages; /**< The stages, in the order they were added (a deque, the atomics cannot move). */
+    double milliseconds = 0; /**< The wall-clock duration of the last run in milliseconds. */
+    double totalMilliseconds = 0; /**< The wall-clock duration of every run since the last reset in milliseconds. */
+    uint64_t runs = 0; /**< The number of runs since the last reset. */
+
+    friend class JobSystem;
+
+
+public:
+    /* ACCESSORS */
+
+    /**
+     * @brief Get the number of stages.
+     * @return The number of stages.
+     */
+    [[nodiscard]] size_t getStageCount() const;
+
+    /**
+     * @brief Get the name of a stage.
+     * @param stage The index of the stage.
+     * @return The name given to addStage().
+     */
+    [[nodiscard]] const std::string &getStageName(size_t stage) const;
+
+    /**
+     * @brief Get the average duration of a stage since the last reset.
+     * @param stage The index of the stage.
+     * @return The duration in milliseconds, 0 if the graph has not run.
+     */
+    [[nodiscard]] double getStageMilliseconds(size_t stage) const;
+
+    /**
+     * @brief Get the average wall-clock duration of a run since the last reset.
+     * @return The duration in milliseconds, 0 if the graph has not run.
+     * @note Compared to the sum of the stages, it shows the time saved by the concurrent stages.
+     */
+    [[nodiscard]] double getMilliseconds() const;
+
+    /**
+     * @brief Get the number of runs since the last reset.
+     * @return The number of runs.
+     */
+    [[nodiscard]] uint64_t getRunCount() const;
+
+
+    /* METHODS */
+
+    /**
+     * @brief Add a stage to the graph.
+     * @param name The name of the stage.
+     * @param function The work of the stage.
+     * @param dependencies The stages which must be done before this one starts (already added).
+     * @return The index of the stage, used as a dependency of the next stages.
+     */
+    size_t addStage(std::string name, std::function<void()> function, std::initializer_list<size_t> dependencies = {});
+
+    /**
+     * @brief Reset the timings of the graph and of its stages.
+     */
+    void resetTimings();
+};
+
+#endif //PLAY_TOGETHER_TASKGRAPH_H
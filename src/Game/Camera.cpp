@@ -24,6 +24,10 @@ float Camera::getY() const {
     return y;
 }
 
+Point Camera::getPreviousPosition() const {
+    return previousPosition;
+}
+
 float Camera::getW() const {
     return w;
 }
@@ -32,8 +36,10 @@ float Camera::getH() const {
     return h;
 }
 
-Point Camera::getRenderingPoint() const {
-    return {x + shakeX, y + shakeY};
+Point Camera::getRenderingPoint(float alpha) const {
+    float rendering_x = previousPosition.x + alpha * (x - previousPosition.x);
+    float rendering_y = previousPosition.y + alpha * (y - previousPosition.y);
+    return {rendering_x + shakeX, rendering_y + shakeY};
 }
 
 SDL_FRect Camera::getBoundingBox() const {
@@ -68,7 +74,7 @@ void Camera::setShake(int time, float amplitude) {
     // Change shakeTime only if the new time is greater
     if (time > shakeTime || time < 0) {
         shakeTime = time;
-        lastShakeUpdate = SDL_GetTicks();
+        lastShakeUpdate = SimulationClock::getTicks();
         shakeAmplitude = amplitude;
     }
 }
@@ -76,6 +82,10 @@ void Camera::setShake(int time, float amplitude) {
 
 /* METHODS */
 
+void Camera::savePreviousPosition() {
+    previousPosition = {x, y};
+}
+
 void Camera::initializePosition(Point camera_point) {
     // Initialize the camera so that players are bottom left
     x = camera_point.x;
@@ -97,6 +107,8 @@ void Camera::initializePosition(Point camera_point) {
     else if (camera_point.y < y + area.y) {
         y -= (y + area.y) - camera_point.y;
     }
+
+    previousPosition = {x, y}; // No interpolation from the previous position
 }
 
 void Camera::makeCameraShake() {
@@ -116,8 +128,8 @@ void Camera::checkShake() {
     // Shake for a given time
     if (shakeTime > 0) {
         makeCameraShake();
-        shakeTime -= static_cast<int>(SDL_GetTicks() - lastShakeUpdate);
-        lastShakeUpdate = SDL_GetTicks();
+        shakeTime -= static_cast<int>(SimulationClock::getTicks() - lastShakeUpdate);
+        lastShakeUpdate = SimulationClock::getTicks();
         if (shakeTime < 0) shakeTime = 0;
     }
     // Shake indefinitely
@@ -156,11 +168,10 @@ void Camera::applyMovement(Point camera_point, double delta_time) {
     checkShake();
 }
 
-void Camera::renderCameraPoint(SDL_Renderer *renderer, Point camera_point) const {
-    SDL_SetRenderDrawColor(renderer, 255, 0, 255, 255);
-    SDL_FRect camera_point_rect = {camera_point.x - x, camera_point.y - y, 20, 20};
-    SDL_RenderFillRectF(renderer, &camera_point_rect);
-    SDL_RenderDrawRectF(renderer, &camera_point_rect);
+void Camera::renderCameraPoint(RenderSnapshot &snapshot, Point camera_point) const {
+    snapshot.setDrawColor(255, 0, 255, 255);
+    SDL_FRect camera_point_rect = {camera_point.x, camera_point.y, 20, 20};
+    snapshot.fillRect(camera_point_rect);
 }
 
 void Camera::renderCameraArea(SDL_Renderer *renderer) const {
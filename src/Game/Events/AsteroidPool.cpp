@@ -0,0 +1,113 @@
+#include "../../../include/Game/Events/AsteroidPool.h"
+
+/**
+ * @file AsteroidPool.cpp
+ * @brief Implements the AsteroidPool class storing the simulated asteroids.
+ */
+
+
+// Static member initialization
+SDL_Texture *AsteroidPool::spriteTexturePtr = nullptr;
+
+
+/* ACCESSORS */
+
+size_t AsteroidPool::size() const {
+    return x.size();
+}
+
+float AsteroidPool::getY(size_t index) const {
+    return y[index];
+}
+
+float AsteroidPool::getH(size_t index) const {
+    return h[index];
+}
+
+SDL_FRect AsteroidPool::getBoundingBox(size_t index) const {
+    return {x[index], y[index], w[index], h[index]};
+}
+
+Quad AsteroidPool::getVertices(size_t index) const {
+    return makeQuad(x[index], y[index], w[index], h[index]);
+}
+
+
+/* MODIFIERS */
+
+void AsteroidPool::push(const Asteroid &asteroid) {
+    x.push_back(asteroid.getX());
+    y.push_back(asteroid.getY());
+    previousX.push_back(asteroid.getX());
+    previousY.push_back(asteroid.getY());
+    w.push_back(asteroid.getW());
+    h.push_back(asteroid.getH());
+    angle.push_back(asteroid.getAngle());
+
+    // The angle never changes, the velocity is computed once
+    auto angle_radians = static_cast<float>(asteroid.getAngle() * (M_PI / 180));
+    velocityX.push_back(-asteroid.getSpeed() * std::cos(angle_radians));
+    velocityY.push_back(-asteroid.getSpeed() * std::sin(angle_radians));
+}
+
+void AsteroidPool::swapRemove(size_t index) {
+    // Move the last asteroid in the removed slot of every column
+    for (std::vector<float> *column: {&x, &y, &previousX, &previousY, &w, &h, &velocityX, &velocityY, &angle}) {
+        (*column)[index] = column->back();
+        column->pop_back();
+    }
+}
+
+
+/* METHODS */
+
+bool AsteroidPool::loadTextures(SDL_Renderer &renderer) {
+    // Load asteroid sprite texture
+    spriteTexturePtr = IMG_LoadTexture(&renderer, "assets/sprites/asteroid/asteroid.png");
+
+    // Check for errors
+    if (spriteTexturePtr == nullptr) {
+        return false; // Return failure
+    }
+
+    return true; // Return success
+}
+
+void AsteroidPool::applyMovement(double delta_time) {
+    const auto step = static_cast<float>(delta_time);
+
+    // One loop per axis over contiguous floats, the compiler vectorizes them
+    for (size_t i = 0; i < x.size(); i++) {
+        previousX[i] = x[i];
+        x[i] += velocityX[i] * step;
+    }
+    for (size_t i = 0; i < y.size(); i++) {
+        previousY[i] = y[i];
+        y[i] += velocityY[i] * step;
+    }
+}
+
+void AsteroidPool::explode([[maybe_unused]] size_t index) {
+    explosionSound.play(0, -1);
+    // Placeholder for an explosion effect at the position of the asteroid
+}
+
+void AsteroidPool::render(RenderSnapshot &snapshot) {
+    sprite.updateAnimation(); // Update sprite animation
+    SDL_Rect srcRect = sprite.getSrcRect();
+
+    for (size_t i = 0; i < x.size(); i++) {
+        snapshot.setMotion({x[i] - previousX[i], y[i] - previousY[i]});
+        SDL_FRect asteroidRect = {x[i], y[i], w[i], h[i]};
+        snapshot.copy(sprite.getTexture(), srcRect, asteroidRect, angle[i], sprite.getFlip());
+    }
+    snapshot.setMotion({0, 0});
+}
+
+void AsteroidPool::renderDebug(RenderSnapshot &snapshot) const {
+    snapshot.setDrawColor(173, 79, 9, 255);
+    for (size_t i = 0; i < x.size(); i++) {
+        SDL_FRect asteroid_rect = {x[i], y[i], w[i], h[i]};
+        snapshot.fillRect(asteroid_rect);
+    }
+}
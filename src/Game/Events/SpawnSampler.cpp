@@ -0,0 +1,74 @@
+#include "../../../include/Game/Events/SpawnSampler.h"
+
+/**
+ * @file SpawnSampler.cpp
+ * @brief Implements the SpawnSampler class drawing spawn values without repeating the recent ones.
+ */
+
+
+/* ACCESSORS */
+
+size_t SpawnSampler::size() const {
+    return values.size();
+}
+
+
+/* METHODS */
+
+void SpawnSampler::generate(int count, float min, float max, size_t cooldown, size_t seed) {
+    generator.seed(static_cast<std::mt19937::result_type>(seed));
+
+    values.clear();
+    available.clear();
+    values.reserve(count);
+    available.reserve(count);
+
+    // Generate the values, they are all available
+    constexpr auto range = static_cast<double>(std::mt19937::max());
+    for (int i = 0; i < count; i++) {
+        auto unit = static_cast<float>(static_cast<double>(generator()) / range);
+        values.push_back(min + (max - min) * unit);
+        available.push_back(static_cast<uint32_t>(i));
+    }
+
+    // At least one value stays available
+    cooling.assign(count > 0 ? std::min(cooldown, static_cast<size_t>(count - 1)) : 0, 0);
+    coolingStart = 0;
+    coolingCount = 0;
+}
+
+float SpawnSampler::sample() {
+    if (values.empty()) return 0;
+
+    // Draw an available value, the last one takes its place in the free list
+    uint32_t slot = next(static_cast<uint32_t>(available.size()));
+    uint32_t index = available[slot];
+    available[slot] = available.back();
+    available.pop_back();
+
+    // No cooldown, the value is available again at once
+    if (cooling.empty()) {
+        available.push_back(index);
+        return values[index];
+    }
+
+    // The oldest cooling value is released once the ring buffer is full, the drawn one takes its place
+    if (coolingCount == cooling.size()) {
+        available.push_back(cooling[coolingStart]);
+        coolingStart = (coolingStart + 1) % cooling.size();
+        coolingCount--;
+    }
+    cooling[(coolingStart + coolingCount) % cooling.size()] = index;
+    coolingCount++;
+
+    return values[index];
+}
+
+
+/* SUB METHODS */
+
+uint32_t SpawnSampler::next(uint32_t bound) {
+    // Scale the 32 bits number to the bound (no modulo, no standard distribution)
+    uint64_t number = generator();
+    return static_cast<uint32_t>((number * bound) >> 32);
+}
@@ -13,7 +13,7 @@ Game::Game(SDL_Window *window, SDL_Renderer *renderer, int frameRate, bool *quit
 
     // Initialize managers
     inputManager = std::make_unique<InputManager>(this);
-    renderManager = std::make_unique<RenderManager>(renderer, this);
+    if (renderer != nullptr) renderManager = std::make_unique<RenderManager>(renderer, this);
     textureManager = std::make_unique<TextureManager>();
     saveManager = std::make_unique<SaveManager>(this);
     broadPhaseManager = std::make_unique<BroadPhaseManager>(this);
@@ -21,6 +21,8 @@ Game::Game(SDL_Window *window, SDL_Renderer *renderer, int frameRate, bool *quit
     playerCollisionManager = std::make_unique<PlayerCollisionManager>(this);
     eventCollisionManager = std::make_unique<EventCollisionManager>(this);
 
+    buildUpdateGraph();
+
     // Create the game seed
     std::random_device rd;
     seed = rd();
@@ -33,6 +35,14 @@ GameState Game::getGameState() const {
     return gameState;
 }
 
+bool Game::isHeadless() const {
+    return renderer == nullptr;
+}
+
+SDL_Renderer *Game::getRenderer() const {
+    return renderer;
+}
+
 InputManager &Game::getInputManager() {
     return *inputManager;
 }
@@ -57,6 +67,10 @@ BroadPhaseManager &Game::getBroadPhaseManager() {
     return *broadPhaseManager;
 }
 
+JobSystem &Game::getJobSystem() {
+    return jobSystem;
+}
+
 Camera *Game::getCamera() {
     return &camera;
 }
@@ -65,6 +79,10 @@ Level *Game::getLevel() {
     return &level;
 }
 
+size_t Game::getSeed() const {
+    return seed;
+}
+
 int Game::getEffectiveFrameRate() const {
     return effectiveFrameFps;
 }
@@ -106,10 +124,7 @@ void Game::initializeHostedGame(int slot) {
 
     playerManager->setCurrentRescueZone(level.getZones(AABBType::RESCUE)[0]);
 
-    // Add the initial player to the game
     Point spawnPoint = level.getSpawnPoints(level.getLastCheckpoint())[0];
-
-    Player initialPlayer(-1, spawnPoint, 2);
     camera.initializePosition(spawnPoint);
     music = level.getMusicById(0);
     music.play(-1);
@@ -117,13 +132,19 @@ void Game::initializeHostedGame(int slot) {
     Asteroid::generateRandomAnglesArray(200, seed);
     Asteroid::generateRandomPositionsArray(200, 0, camera.getW(), seed);
 
+    // A dedicated server has no local player, every player is a client
+    if (isHeadless()) return;
+
+    // Add the initial player to the game
+    Player initialPlayer(-1, spawnPoint, 2);
     initialPlayer.setSpriteTextureByID(2);
     playerManager->addPlayer(initialPlayer);
 }
 
 using json = nlohmann::json;
 void Game::loadLevel(const std::string &map_name, short last_checkpoint, const json::array_t &playersData, const json::object_t &cameraData,
-                     const json::array_t &movingPlatforms1DData, const json::array_t &movingPlatforms2DData,const json::array_t &crushersData) {
+                     const json::array_t &movingPlatforms1DData, const json::array_t &movingPlatforms2DData,const json::array_t &crushersData,
+                     size_t session_seed) {
     setLevel(map_name);
     level.setLastCheckpoint(last_checkpoint);
 
@@ -131,6 +152,11 @@ void Game::loadLevel(const std::string &map_name, short last_checkpoint, const j
     camera.setX(cameraData.at("x"));
     camera.setY(cameraData.at("y"));
 
+    // Share the spawn tables and streams of the server
+    seed = session_seed;
+    Asteroid::generateRandomAnglesArray(200, seed);
+    Asteroid::generateRandomPositionsArray(200, 0, camera.getW(), seed);
+
     // Add all players to the game (including the local player)
     size_t spawnIndex = 0;
     for (const auto &player: playersData) {
@@ -188,83 +214,223 @@ void Game::loadLevel(const std::string &map_name, short last_checkpoint, const j
     music.play(-1);
 }
 
+void Game::buildUpdateGraph() {
+    // The players, the traps, the platforms and the asteroids do not share any data, they move concurrently
+    size_t players = updateGraph.addStage("players", [this] {
+        savePreviousPositions();
+        calculatePlayersMovement(updateStepSeconds);
+        applyPlayersMovement(updateStepSeconds);
+    });
+    size_t traps = updateGraph.addStage("traps", [this] { trapsShake = level.applyTrapsMovement(updateStepSeconds); });
+    size_t platforms = updateGraph.addStage("platforms", [this] { level.applyPlatformsMovement(updateStepSeconds); });
+    size_t asteroids = updateGraph.addStage("asteroids", [this] { level.applyAsteroidsMovement(updateStepSeconds); });
+
+    // The camera follows the players once they moved
+    size_t camera_stage = updateGraph.addStage("camera", [this] {
+        if (trapsShake) camera.setShake(150);
+        camera.applyMovement(playerManager->getAveragePlayerPosition(), updateStepSeconds);
+    }, {players, traps});
+
+    // Handle collisions once everything moved
+    size_t broad_phase = updateGraph.addStage("broad phase", [this] { broadPhaseManager->broadPhase(); }, {camera_stage, platforms, asteroids});
+    size_t narrow_phase = updateGraph.addStage("narrow phase", [this] { narrowPhase(updateStepSeconds); }, {broad_phase});
+
+    updateGraph.addStage("animation", [this] {
+        playerManager->setTheBestPlayer();
+        updatePlayersSpriteAnimation();
+    }, {narrow_phase});
+}
+
+#ifdef DEVELOPMENT_MODE
+void Game::printUpdateTimings() {
+    if (updateGraph.getRunCount() == 0) return;
+
+    // The sum of the stages against the wall-clock time of a tick shows the time saved by the concurrent stages
+    double total = 0;
+    std::cout << "GAME : Tick stages (" << jobSystem.getWorkerCount() << " workers):";
+    for (size_t i = 0; i < updateGraph.getStageCount(); i++) {
+        std::cout << " " << updateGraph.getStageName(i) << " " << updateGraph.getStageMilliseconds(i) << " ms,";
+        total += updateGraph.getStageMilliseconds(i);
+    }
+    std::cout << " sum " << total << " ms, wall " << updateGraph.getMilliseconds() << " ms" << std::endl;
+
+    updateGraph.resetTimings();
+}
+#endif
+
 void Game::update(double delta_time) {
-    inputManager->handleKeyboardEvents();
-    calculatePlayersMovement(delta_time);
-    if (level.applyTrapsMovement(delta_time)) camera.setShake(150);
+    SimulationClock::advance(); // Every gameplay timer reads this clock
+    Mediator::applyNetworkEvents(); // The network threads queue the players, asteroids and corrections received, they are applied here
+    if (Mediator::isClientRunning()) Mediator::reconcilePrediction(); // The corrections are received on the UDP thread, the player is moved here
+    inputManager->applyKeyEvents(); // The SDL events are polled by the thread owning the window, the keys are applied here
+
+    updateStepSeconds = delta_time;
+    jobSystem.run(updateGraph);
+
+    // A client predicts its player, the position of each tick is reconciled with the sync corrections
+    if (Mediator::isClientRunning()) Mediator::savePredictedPosition();
+
+    if (!Mediator::isClientRunning()) level.generateAsteroid(0, {camera.getX(), camera.getY()});
+
+    // Record the tick for the render thread, unless it has not taken the last one yet
+    if (!isHeadless()) renderManager->capture();
+}
+
+void Game::simulate(const std::stop_token &stopToken) {
+    // Variables for controlling the ticks and the network updates
+    Uint64 lastTickTime = SDL_GetPerformanceCounter(); // Time at the start of the loop
+    Uint64 frequency = SDL_GetPerformanceFrequency();
+    const double simulationStepSeconds = SimulationClock::getStepSeconds(); // The fixed duration of a tick, independent of the refresh rate
+    double simulationTime = 0.0; // Time not simulated yet, consumed by fixed ticks
+    double networkTime = 0.0; // Accumulated time since last network update
+
+    double elapsedTimeSinceLastReset = 0.0; // Time elapsed since last reset
+
+    // Simulation loop
+    while (!stopToken.stop_requested() && gameState != GameState::STOPPED) {
+
+        // A headless game has no render thread, the events are polled and the messages processed here (between two ticks)
+        if (isHeadless()) {
+            inputManager->handleKeyboardEvents();
+            if (!messageQueue->empty()) processMessages();
+        }
+
+        // Calculate the real time elapsed since the last loop
+        Uint64 currentTickTime = SDL_GetPerformanceCounter();
+        double delta_time = static_cast<double>(currentTickTime - lastTickTime) / static_cast<double>(frequency); // Delta time in seconds
+        lastTickTime = currentTickTime;
+
+        // Accumulate time for game logic and network updates
+        simulationTime += delta_time;
+        networkTime += delta_time;
+        elapsedTimeSinceLastReset += delta_time;
+
+        // Drop the late time if the simulation cannot keep up, instead of simulating more and more ticks every loop
+        simulationTime = std::min(simulationTime, maxSimulationStepsPerFrame * simulationStepSeconds);
+
+        // Simulate fixed ticks, the result does not depend on the refresh rate
+        while (simulationTime >= simulationStepSeconds) {
+            update(simulationStepSeconds);
+            simulationTime -= simulationStepSeconds;
+        }
+
+        // Save between two ticks, the save reads the whole game
+        if (saveRequested.exchange(false)) saveManager->saveGameState();
+
+        // Send the network updates at the refresh rate (the keyboard state is sent by applyKeyEvents at each tick)
+        if (networkTime >= 1.0 / frameRate) {
+            // Every 20 seconds or more, send the sync correction to the network
+            if (Mediator::isServerRunning() && elapsedTimeSinceLastReset > networkSyncCorrectionIntervalSeconds) {
+                inputManager->sendSyncCorrectionToNetwork();
+            }
+
+            networkTime = std::min(networkTime - 1.0 / frameRate, 1.0 / frameRate);
+        }
 
-    level.applyPlatformsMovement(delta_time);
-    level.applyAsteroidsMovement(delta_time);
-    applyPlayersMovement(delta_time);
-    camera.applyMovement(playerManager->getAveragePlayerPosition(), delta_time);
+        // Check if one second has passed since the last reset
+        if (elapsedTimeSinceLastReset >= effectiveFrameRateUpdateIntervalSeconds) {
+#ifdef DEVELOPMENT_MODE
+            printUpdateTimings();
+#endif
+            elapsedTimeSinceLastReset -= 1.0;
+        }
 
-    // Handle collisions
-    broadPhaseManager->broadPhase();
-    narrowPhase(delta_time);
+        // Wait until the next tick or the next network update, whichever comes first
+        double time_to_tick = simulationStepSeconds - simulationTime;
+        double time_to_network = 1.0 / frameRate - networkTime;
+        double time_to_wait = std::min(time_to_tick, time_to_network);
+        if (time_to_wait > 0) SDL_Delay(static_cast<Uint32>(time_to_wait * 1000));
+    }
+}
 
-    playerManager->setTheBestPlayer();
-    updatePlayersSpriteAnimation();
+void Game::startSimulation() {
+    renderManager->clearFrames(); // The frames may point to the textures of a replaced level
+    simulationThread = std::jthread([this](const std::stop_token &stopToken) { simulate(stopToken); });
+}
 
-    if (!Mediator::isClientRunning()) level.generateAsteroid(0, {camera.getX(), camera.getY()}, seed);
-    renderManager->render();
+void Game::stopSimulation() {
+    if (!simulationThread.joinable()) return;
+    simulationThread.request_stop();
+    simulationThread.join();
+}
+
+void Game::processMessages() {
+    while (!messageQueue->empty()) {
+        auto [mainMessage, parameters] = messageQueue->pop();
+
+        if (mainMessage == "InitializeClientGame") {
+            nlohmann::json message = nlohmann::json::parse(parameters[0]);
+            SimulationClock::setTickRate(message["tickRate"]); // Every peer simulates at the rate of the server
+            loadLevel(
+                    message["mapName"],
+                    message["lastCheckpoint"],
+                    message["players"],
+                    message["camera"],
+                    message["platforms1D"],
+                    message["platforms2D"],
+                    message["crushers"],
+                    message["seed"]
+            );
+        }
+
+        else if (mainMessage == "SetLevel") {
+            setLevel(parameters[0]);
+        }
+    }
 }
 
 void Game::run() {
     gameState = GameState::RUNNING;
+    running = true;
+
+    // A headless game has no rendering, it simulates on this thread
+    if (isHeadless()) {
+        simulate(std::stop_token());
+        reset();
+        running = false;
+        return;
+    }
 
-    // Variables for controlling FPS and calculating delta time
+    // Variables for controlling FPS
     Uint64 lastFrameTime = SDL_GetPerformanceCounter(); // Time at the start of the game frame
     Uint64 frequency = SDL_GetPerformanceFrequency();
-    double accumulatedTime = 0.0; // Accumulated time since last effective game FPS update
+    double accumulatedTime = 0.0; // Accumulated time since last rendering
     int frameCounter = 0;
 
     double elapsedTimeSinceLastReset = 0.0; // Time elapsed since last reset
 
-    // Game loop
+    // The simulation runs on its own thread, this one owns the renderer and the window
+    startSimulation();
+
+    // Render loop
     while (gameState != GameState::STOPPED) {
 
-        // Process messages from other threads in the queue
+        // Process messages from other threads in the queue, the level is replaced while the simulation is stopped
         if (!messageQueue->empty()) {
-            auto [mainMessage, parameters] = messageQueue->pop();
-
-            if (mainMessage == "InitializeClientGame") {
-                nlohmann::json message = nlohmann::json::parse(parameters[0]);
-                loadLevel(
-                        message["mapName"],
-                        message["lastCheckpoint"],
-                        message["players"],
-                        message["camera"],
-                        message["platforms1D"],
-                        message["platforms2D"],
-                        message["crushers"]
-                );
-            }
+            stopSimulation();
+            processMessages();
+            startSimulation();
         }
 
-        // Calculate delta time for game logic
+        // Poll the events, the key events are queued for the simulation thread
+        inputManager->handleKeyboardEvents();
+
+        // Calculate the real time elapsed since the last loop
         Uint64 currentFrameTime = SDL_GetPerformanceCounter();
         Uint64 frameTicks = currentFrameTime - lastFrameTime;
-        float delta_time = static_cast<float>(frameTicks) / static_cast<float>(frequency); // Delta time in seconds for game logic
+        double delta_time = static_cast<double>(frameTicks) / static_cast<double>(frequency); // Delta time in seconds
         lastFrameTime = currentFrameTime;
 
-        // Accumulate time for game logic and rendering
+        // Accumulate time for rendering
         accumulatedTime += delta_time;
         elapsedTimeSinceLastReset += delta_time;
 
         // Calculate game rendering at the specified rate (frameRate)
         if (accumulatedTime >= 1.0 / frameRate) {
             frameCounter++;
-            update(delta_time);
 
-            // Every 1/60 seconds or more, send the keyboard state to the network
-            if (elapsedTimeSinceLastReset > networkInputSendIntervalSeconds) {
-                inputManager->sendKeyboardStateToNetwork();
-            }
-
-            // Every 20 seconds or more, send the sync correction to the network
-            if (Mediator::isServerRunning() && elapsedTimeSinceLastReset > networkSyncCorrectionIntervalSeconds) {
-                inputManager->sendSyncCorrectionToNetwork();
-            }
+            // Draw the last tick recorded by the simulation thread, while it simulates the next ones
+            renderManager->render();
 
             // Check if one second has passed since the last reset, and if so, reset frame counters and elapsed time
             if (elapsedTimeSinceLastReset >= effectiveFrameRateUpdateIntervalSeconds) {
@@ -273,23 +439,35 @@ void Game::run() {
                 elapsedTimeSinceLastReset -= 1.0;
             }
 
-            // Reset accumulated time for rendering
-            accumulatedTime -= 1.0 / frameRate;
+            // Reset accumulated time for rendering (a late frame does not make the next ones faster)
+            accumulatedTime = std::min(accumulatedTime - 1.0 / frameRate, 1.0 / frameRate);
         }
 
-        // Waiting to maintain the desired game FPS
-        Uint64 desiredTicksPerFrame = frequency / frameRate;
-        Uint64 elapsedGameTicks = SDL_GetPerformanceCounter() - currentFrameTime;
-        Uint64 ticksToWait = desiredTicksPerFrame > elapsedGameTicks ? desiredTicksPerFrame - elapsedGameTicks : 0;
-        SDL_Delay(static_cast<Uint32>(ticksToWait * 1000 / frequency));
+        // Wait until the next frame
+        double time_to_wait = 1.0 / frameRate - accumulatedTime;
+        if (time_to_wait > 0) SDL_Delay(static_cast<Uint32>(time_to_wait * 1000));
     }
+
+    // Nothing reads the players anymore once the simulation thread is joined
+    stopSimulation();
+    reset();
+    running = false;
+}
+
+void Game::requestLevel(const std::string &map_name) {
+    messageQueue->push("SetLevel", {map_name});
+}
+
+void Game::save() {
+    if (running) saveRequested = true;
+    else saveManager->saveGameState();
 }
 
 void Game::calculatePlayersMovement(double delta_time) {
-    // Apply movement to all players
-    for (Player &player: playerManager->getAlivePlayers()) {
-        player.calculateMovement(delta_time);
-    }
+    // Apply movement to all players (each player only reads and writes its own state)
+    jobSystem.parallelFor(playerManager->getAlivePlayers().size(), [this, delta_time](size_t i, size_t) {
+        playerManager->getAlivePlayers()[i].calculateMovement(delta_time);
+    }, parallelPlayersGrain);
 
     // Apply movement to all dead players
     for (Player &player: playerManager->getDeadPlayers()) {
@@ -299,13 +477,15 @@ void Game::calculatePlayersMovement(double delta_time) {
 
 void Game::updatePlayersSpriteAnimation() {
 
-    // Update sprite animation for all living players
-    for (Player &player: playerManager->getAlivePlayers()) {
-        player.updateSpriteAnimation();
-    }
+    // Update sprite animation for all living players (each player owns its sprite)
+    jobSystem.parallelFor(playerManager->getAlivePlayers().size(), [this](size_t i, size_t) {
+        playerManager->getAlivePlayers()[i].updateSpriteAnimation();
+    }, parallelPlayersGrain);
 
-    // Update sprite animation for all dying players
-    for (Player &player: playerManager->getNeutralPlayers()) {
+    // Update sprite animation for all dying players, from the last one so a player leaving the view does not skip another
+    PlayerSlotMap::View neutral_players = playerManager->getNeutralPlayers();
+    for (size_t i = neutral_players.size(); i-- > 0;) {
+        Player &player = neutral_players[i];
         if (player.updateSpriteAnimation()) {
             // The player is respawning
             if (player.getIsAlive()) {
@@ -319,16 +499,23 @@ void Game::updatePlayersSpriteAnimation() {
     }
 
     // Update sprite animation for all dead players
-    for (Player &player: playerManager->getDeadPlayers()) {
-        player.updateSpriteAnimation();
-    }
+    jobSystem.parallelFor(playerManager->getDeadPlayers().size(), [this](size_t i, size_t) {
+        playerManager->getDeadPlayers()[i].updateSpriteAnimation();
+    }, parallelPlayersGrain);
+}
+
+void Game::savePreviousPositions() {
+    for (Player &player: playerManager->getAlivePlayers()) player.savePreviousPosition();
+    for (Player &player: playerManager->getNeutralPlayers()) player.savePreviousPosition();
+    for (Player &player: playerManager->getDeadPlayers()) player.savePreviousPosition();
+    camera.savePreviousPosition();
 }
 
 void Game::applyPlayersMovement(double delta_time) {
     // Apply movement for all living players
-    for (Player &player: playerManager->getAlivePlayers()) {
-        player.applyMovement(delta_time);
-    }
+    jobSystem.parallelFor(playerManager->getAlivePlayers().size(), [this, delta_time](size_t i, size_t) {
+        playerManager->getAlivePlayers()[i].applyMovement(delta_time);
+    }, parallelPlayersGrain);
 
     // Apply movement for all dead players
     for (Player &player: playerManager->getDeadPlayers()) {
@@ -362,9 +549,10 @@ void Game::togglePause() {
         const Uint8 *keyboardState = SDL_GetKeyboardState(nullptr);
         for (int i = 0; i < SDL_NUM_SCANCODES; i++) {
             if (keyboardState[i]) {
-                SDL_KeyboardEvent keyEvent;
+                SDL_KeyboardEvent keyEvent = {};
+                keyEvent.type = SDL_KEYUP;
                 keyEvent.keysym.scancode = static_cast<SDL_Scancode>(i);
-                inputManager->handleKeyUpEvent(playerManager->findPlayerById(-1), keyEvent);
+                inputManager->queueKeyEvent(keyEvent);
             }
         }
 
@@ -377,6 +565,12 @@ void Game::togglePause() {
 
 void Game::stop() {
     gameState = GameState::STOPPED;
+
+    // A running game is reset by run(), once the simulation thread is joined
+    if (!running) reset();
+}
+
+void Game::reset() {
     playerManager->clearPlayers();
     saveManager->setSlot(-1);
 
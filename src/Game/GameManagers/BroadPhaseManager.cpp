@@ -13,325 +13,383 @@ BroadPhaseManager::BroadPhaseManager(Game *game) : gamePtr(game) {}
 
 /* ACCESSORS */
 
-std::vector<AABB> &BroadPhaseManager::getSaveZones() {
+std::span<const Handle<AABB>> BroadPhaseManager::getSaveZones() const {
     return saveZones;
 }
 
-std::vector<AABB> &BroadPhaseManager::getRescueZones() {
+std::span<const Handle<AABB>> BroadPhaseManager::getRescueZones() const {
     return rescueZones;
 }
 
-std::vector<AABB> &BroadPhaseManager::getToggleGravityZones() {
+std::span<const Handle<AABB>> BroadPhaseManager::getToggleGravityZones() const {
     return toggleGravityZones;
 }
 
-std::vector<AABB> &BroadPhaseManager::getIncreaseFallSpeedZones() {
+std::span<const Handle<AABB>> BroadPhaseManager::getIncreaseFallSpeedZones() const {
     return increaseFallSpeedZones;
 }
 
-std::vector<Polygon> &BroadPhaseManager::getDeathZones() {
+std::span<const Handle<Polygon>> BroadPhaseManager::getDeathZones() const {
     return deathZones;
 }
 
-std::vector<Polygon> &BroadPhaseManager::getObstacles() {
+std::span<const Handle<Polygon>> BroadPhaseManager::getObstacles() const {
     return obstacles;
 }
 
-std::vector<TreadmillLever> &BroadPhaseManager::getTreadmillLevers() {
+std::span<const Handle<TreadmillLever>> BroadPhaseManager::getTreadmillLevers() const {
     return treadmillLevers;
 }
 
-std::vector<PlatformLever> &BroadPhaseManager::getPlatformLevers() {
+std::span<const Handle<PlatformLever>> BroadPhaseManager::getPlatformLevers() const {
     return platformLevers;
 }
 
-std::vector<CrusherLever> &BroadPhaseManager::getCrusherLevers() {
+std::span<const Handle<CrusherLever>> BroadPhaseManager::getCrusherLevers() const {
     return crusherLevers;
 }
 
-std::vector<MovingPlatform1D> &BroadPhaseManager::getMovingPlatforms1D() {
+std::span<const Handle<MovingPlatform1D>> BroadPhaseManager::getMovingPlatforms1D() const {
     return movingPlatforms1D;
 }
 
-std::vector<MovingPlatform2D> &BroadPhaseManager::getMovingPlatforms2D() {
+std::span<const Handle<MovingPlatform2D>> BroadPhaseManager::getMovingPlatforms2D() const {
     return movingPlatforms2D;
 }
 
-std::vector<SwitchingPlatform> &BroadPhaseManager::getSwitchingPlatforms() {
+std::span<const Handle<SwitchingPlatform>> BroadPhaseManager::getSwitchingPlatforms() const {
     return switchingPlatforms;
 }
 
-std::vector<WeightPlatform> &BroadPhaseManager::getWeightPlatforms() {
+std::span<const Handle<WeightPlatform>> BroadPhaseManager::getWeightPlatforms() const {
     return weightPlatforms;
 }
 
-std::vector<Treadmill> &BroadPhaseManager::getTreadmills() {
+std::span<const Handle<Treadmill>> BroadPhaseManager::getTreadmills() const {
     return treadmills;
 }
 
-std::vector<Crusher> &BroadPhaseManager::getCrushers() {
+std::span<const Handle<Crusher>> BroadPhaseManager::getCrushers() const {
     return crushers;
 }
 
-std::vector<SizePowerUp> &BroadPhaseManager::getSizePowerUps() {
+std::span<const Handle<SizePowerUp>> BroadPhaseManager::getSizePowerUps() const {
     return sizePowerUp;
 }
 
-std::vector<SpeedPowerUp> &BroadPhaseManager::getSpeedPowerUps() {
+std::span<const Handle<SpeedPowerUp>> BroadPhaseManager::getSpeedPowerUps() const {
     return speedPowerUp;
 }
 
-std::vector<Coin> &BroadPhaseManager::getCoins() {
+std::span<const Handle<Coin>> BroadPhaseManager::getCoins() const {
     return coins;
 }
 
-std::vector<Item*> &BroadPhaseManager::getItems() {
+std::span<const Handle<Item>> BroadPhaseManager::getItems() const {
     return items;
 }
 
+bool BroadPhaseManager::getIncremental() const {
+    return incremental;
+}
+
+size_t BroadPhaseManager::getFullRebuildCount() const {
+    return fullRebuildCount;
+}
+
+size_t BroadPhaseManager::getReusedFrameCount() const {
+    return reusedFrameCount;
+}
+
+
+/* MUTATORS */
+
+void BroadPhaseManager::setIncremental(bool state) {
+    incremental = state; // The simulation thread sees the change of mode and rebuilds the static sets on the next frame
+}
+
 
 /* METHODS */
 
-void BroadPhaseManager::checkSavesZones(const SDL_FRect& broad_phase_area) {
+void BroadPhaseManager::checkSavesZones(const SDL_FRect &broad_phase_area) {
     saveZones.clear(); // Empty old save zones
-
-    // Check collisions with each save zone
-    for (const AABB &aabb: gamePtr->getLevel()->getZones(AABBType::SAVE)) {
-        if (checkAABBCollision(broad_phase_area, aabb.getRect())) {
-            saveZones.push_back(aabb);
+    Level const *level = gamePtr->getLevel();
+
+    // Query only the save zones overlapping the broad phase area
+    const std::vector<AABB> &zones = level->getZones(AABBType::SAVE);
+    level->queryZones(AABBType::SAVE, broad_phase_area, candidates);
+    for (size_t index: candidates) {
+        if (checkAABBCollision(broad_phase_area, zones[index].getRect())) {
+            saveZones.push_back(level->getHandle<AABB>(index));
         }
     }
 }
 
 void BroadPhaseManager::checkRescueZones(const SDL_FRect &broad_phase_area) {
     rescueZones.clear(); // Empty old rescue zones
-
-    // Check collisions with each rescue zone
-    for (const AABB &aabb: gamePtr->getLevel()->getZones(AABBType::RESCUE)) {
-        if (checkAABBCollision(broad_phase_area, aabb.getRect())) {
-            rescueZones.push_back(aabb);
+    Level const *level = gamePtr->getLevel();
+
+    // Query only the rescue zones overlapping the broad phase area
+    const std::vector<AABB> &zones = level->getZones(AABBType::RESCUE);
+    level->queryZones(AABBType::RESCUE, broad_phase_area, candidates);
+    for (size_t index: candidates) {
+        if (checkAABBCollision(broad_phase_area, zones[index].getRect())) {
+            rescueZones.push_back(level->getHandle<AABB>(index));
         }
     }
 }
 
 void BroadPhaseManager::checkToggleGravityZones(const SDL_FRect &broad_phase_area) {
     toggleGravityZones.clear(); // Empty old toggle gravity zones
-
-    // Check collisions with each toggle gravity zone
-    for (const AABB &aabb: gamePtr->getLevel()->getZones(AABBType::TOGGLE_GRAVITY)) {
-        if (checkAABBCollision(broad_phase_area, aabb.getRect())) {
-            toggleGravityZones.push_back(aabb);
+    Level const *level = gamePtr->getLevel();
+
+    // Query only the toggle gravity zones overlapping the broad phase area
+    const std::vector<AABB> &zones = level->getZones(AABBType::TOGGLE_GRAVITY);
+    level->queryZones(AABBType::TOGGLE_GRAVITY, broad_phase_area, candidates);
+    for (size_t index: candidates) {
+        if (checkAABBCollision(broad_phase_area, zones[index].getRect())) {
+            toggleGravityZones.push_back(level->getHandle<AABB>(index));
         }
     }
 }
 
 void BroadPhaseManager::checkIncreaseFallSpeedZones(const SDL_FRect &broad_phase_area) {
     increaseFallSpeedZones.clear(); // Empty old increase fall speed zones
-
-    // Check collisions with each increase fall speed zone
-    for (const AABB &aabb: gamePtr->getLevel()->getZones(AABBType::INCREASE_FALL_SPEED)) {
-        if (checkAABBCollision(broad_phase_area, aabb.getRect())) {
-            increaseFallSpeedZones.push_back(aabb);
+    Level const *level = gamePtr->getLevel();
+
+    // Query only the increase fall speed zones overlapping the broad phase area
+    const std::vector<AABB> &zones = level->getZones(AABBType::INCREASE_FALL_SPEED);
+    level->queryZones(AABBType::INCREASE_FALL_SPEED, broad_phase_area, candidates);
+    for (size_t index: candidates) {
+        if (checkAABBCollision(broad_phase_area, zones[index].getRect())) {
+            increaseFallSpeedZones.push_back(level->getHandle<AABB>(index));
         }
     }
 }
 
-void BroadPhaseManager::checkDeathZones(const std::vector<Point>& broad_phase_area) {
+void BroadPhaseManager::checkDeathZones(const SDL_FRect& broad_phase_area_box, const Quad& broad_phase_area) {
     deathZones.clear(); // Empty old death zones
-
-    // Check collisions with each save zone
-    for (const Polygon &zone: gamePtr->getLevel()->getZones(PolygonType::DEATH)) {
-        if (checkSATCollision(broad_phase_area, zone)) {
-            deathZones.push_back(zone);
+    Level const *level = gamePtr->getLevel();
+
+    // Check collisions only with the death zones sharing a cell with the broad phase area
+    const std::vector<Polygon> &zones = level->getZones(PolygonType::DEATH);
+    level->queryZones(PolygonType::DEATH, broad_phase_area_box, candidates);
+    for (size_t index: candidates) {
+        const Polygon &zone = zones[index];
+        if (checkAABBCollision(broad_phase_area_box, zone.getBoundingBox()) && checkSATCollision(broad_phase_area, zone)) {
+            deathZones.push_back(level->getHandle<Polygon>(index));
         }
     }
 }
 
-void BroadPhaseManager::checkObstacles(const std::vector<Point> &broad_phase_area) {
-    obstacles.clear(); // Empty old death zones
+void BroadPhaseManager::checkObstacles(const SDL_FRect& broad_phase_area_box, const Quad& broad_phase_area) {
+    obstacles.clear(); // Empty old obstacles
+    Level const *level = gamePtr->getLevel();
 
-    // Check collisions with each obstacle
-    for (const Polygon &obstacle: gamePtr->getLevel()->getZones(PolygonType::COLLISION)) {
-        if (checkSATCollision(broad_phase_area, obstacle)) {
-            obstacles.push_back(obstacle);
+    // Check collisions only with the obstacles sharing a cell with the broad phase area
+    const std::vector<Polygon> &zones = level->getZones(PolygonType::COLLISION);
+    level->queryZones(PolygonType::COLLISION, broad_phase_area_box, candidates);
+    for (size_t index: candidates) {
+        const Polygon &obstacle = zones[index];
+        if (checkAABBCollision(broad_phase_area_box, obstacle.getBoundingBox()) && checkSATCollision(broad_phase_area, obstacle)) {
+            obstacles.push_back(level->getHandle<Polygon>(index));
         }
     }
 }
 
 void BroadPhaseManager::checkTreadmillLevers(const SDL_FRect &broad_phase_area) {
     treadmillLevers.clear(); // Empty old treadmill levers
-
-    // Check for collisions with each treadmill lever
-    for (const TreadmillLever &lever: gamePtr->getLevel()->getTreadmillLevers()) {
-        if (checkAABBCollision(broad_phase_area, lever.getBoundingBox())) {
-            treadmillLevers.push_back(lever);
+    Level *level = gamePtr->getLevel();
+
+    // Check for collisions with the treadmill levers near the broad phase area
+    const std::vector<TreadmillLever> &levers = level->getTreadmillLevers();
+    level->queryTreadmillLevers(broad_phase_area, candidates);
+    for (size_t index: candidates) {
+        if (checkAABBCollision(broad_phase_area, levers[index].getBoundingBox())) {
+            treadmillLevers.push_back(level->getHandle<TreadmillLever>(index));
         }
     }
 }
 
 void BroadPhaseManager::checkPlatformLevers(const SDL_FRect &broad_phase_area) {
+    Level *level = gamePtr->getLevel();
+
+    // Hide the levers that were on screen during the last check
+    for (Handle<PlatformLever> handle: platformLevers) {
+        if (PlatformLever *lever = level->get(handle)) lever->setIsOnScreen(false);
+    }
     platformLevers.clear(); // Empty old platform levers
 
-    // Check for collisions with each platform lever
-    for (PlatformLever &lever: gamePtr->getLevel()->getPlatformLevers()) {
-        if (checkAABBCollision(broad_phase_area, lever.getBoundingBox())) {
-            lever.setIsOnScreen(true);
-            platformLevers.push_back(lever);
-        } else {
-            lever.setIsOnScreen(false);
+    // Check for collisions with the platform levers near the broad phase area
+    std::vector<PlatformLever> &levers = level->getPlatformLevers();
+    level->queryPlatformLevers(broad_phase_area, candidates);
+    for (size_t index: candidates) {
+        if (checkAABBCollision(broad_phase_area, levers[index].getBoundingBox())) {
+            levers[index].setIsOnScreen(true);
+            platformLevers.push_back(level->getHandle<PlatformLever>(index));
         }
     }
 }
 
 void BroadPhaseManager::checkCrusherLevers(const SDL_FRect &broad_phase_area) {
+    Level *level = gamePtr->getLevel();
+
+    // Hide the levers that were on screen during the last check
+    for (Handle<CrusherLever> handle: crusherLevers) {
+        if (CrusherLever *lever = level->get(handle)) lever->setIsOnScreen(false);
+    }
     crusherLevers.clear(); // Empty old crusher levers
 
-    // Check for collisions with each crusher lever
-    for (CrusherLever &lever: gamePtr->getLevel()->getCrusherLevers()) {
-        if (checkAABBCollision(broad_phase_area, lever.getBoundingBox())) {
-            lever.setIsOnScreen(true);
-            crusherLevers.push_back(lever);
-        } else {
-            lever.setIsOnScreen(false);
+    // Check for collisions with the crusher levers near the broad phase area
+    std::vector<CrusherLever> &levers = level->getCrusherLevers();
+    level->queryCrusherLevers(broad_phase_area, candidates);
+    for (size_t index: candidates) {
+        if (checkAABBCollision(broad_phase_area, levers[index].getBoundingBox())) {
+            levers[index].setIsOnScreen(true);
+            crusherLevers.push_back(level->getHandle<CrusherLever>(index));
         }
     }
 }
 
 void BroadPhaseManager::check1DMovingPlatforms(const SDL_FRect &broad_phase_area) {
-    movingPlatforms1D.clear(); // Empty old 1D moving platforms
-
-    // Check for collisions with each 1D moving platform
-    for (MovingPlatform1D &platform: gamePtr->getLevel()->getMovingPlatforms1D()) {
-        if (checkAABBCollision(broad_phase_area, platform.getBoundingBox())) {
-            platform.setIsOnScreen(true);
-            movingPlatforms1D.push_back(platform);
-        } else {
-            platform.setIsOnScreen(false);
-        }
-    }
+    collect(broad_phase_area, movingPlatforms1D);
 }
 
 void BroadPhaseManager::check2DMovingPlatforms(const SDL_FRect &broad_phase_area) {
-    movingPlatforms2D.clear(); // Empty old 2D moving platforms
-
-    // Check for collisions with each 2D moving platform
-    for (MovingPlatform2D &platform: gamePtr->getLevel()->getMovingPlatforms2D()) {
-        if (checkAABBCollision(broad_phase_area, platform.getBoundingBox())) {
-            platform.setIsOnScreen(true);
-            movingPlatforms2D.push_back(platform);
-        } else {
-            platform.setIsOnScreen(false);
-        }
-    }
+    collect(broad_phase_area, movingPlatforms2D);
 }
 
 void BroadPhaseManager::checkSwitchingPlatforms(const SDL_FRect &broad_phase_area) {
-    switchingPlatforms.clear(); // Empty old switching platforms
-
-    // Check for collisions with each switching platform
-    for (SwitchingPlatform &platform: gamePtr->getLevel()->getSwitchingPlatforms()) {
-        if (checkAABBCollision(broad_phase_area, platform.getBoundingBox())) {
-            platform.setIsOnScreen(true);
-            switchingPlatforms.push_back(platform);
-        } else {
-            platform.setIsOnScreen(false);
-        }
-    }
+    collect(broad_phase_area, switchingPlatforms);
 }
 
 void BroadPhaseManager::checkWeightPlatforms(const SDL_FRect &broad_phase_area) {
-    weightPlatforms.clear(); // Empty old weight platforms
-
-    // Check for collisions with each weight platform
-    for (WeightPlatform &platform: gamePtr->getLevel()->getWeightPlatforms()) {
-        if (checkAABBCollision(broad_phase_area, platform.getBoundingBox())) {
-            platform.setIsOnScreen(true);
-            weightPlatforms.push_back(platform);
-        } else {
-            platform.setIsOnScreen(false);
-        }
-    }
+    collect(broad_phase_area, weightPlatforms);
 }
 
 void BroadPhaseManager::checkTreadmills(const SDL_FRect &broad_phase_area) {
-    treadmills.clear(); // Empty old treadmills
-
-    // Check for collisions with each treadmill
-    for (Treadmill &treadmill: gamePtr->getLevel()->getTreadmills()) {
-        if (checkAABBCollision(broad_phase_area, treadmill.getBoundingBox())) {
-            treadmill.setIsOnScreen(true);
-            treadmills.push_back(treadmill);
-        } else {
-            treadmill.setIsOnScreen(false);
-        }
-    }
+    collect(broad_phase_area, treadmills);
 }
 
 void BroadPhaseManager::checkCrushers(const SDL_FRect &broad_phase_area) {
-    crushers.clear(); // Empty old crushers
-
-    // Check for collisions with each crusher
-    for (Crusher &crusher: gamePtr->getLevel()->getCrushers()) {
-        if (checkAABBCollision(broad_phase_area, crusher.getBoundingBox())) {
-            crusher.setIsOnScreen(true);
-            crushers.push_back(crusher);
-        } else {
-            crusher.setIsOnScreen(false);
-        }
-    }
+    collect(broad_phase_area, crushers);
 }
 
 void BroadPhaseManager::checkPowerUps(const SDL_FRect &broad_phase_area) {
-    sizePowerUp.clear(); // Empty old size power-up
-    speedPowerUp.clear(); // Empty old speed power-up
-
-    // Check for collisions with size power-up
-    for (SizePowerUp &item: gamePtr->getLevel()->getSizePowerUp()) {
-        if (checkAABBCollision(broad_phase_area, item.getBoundingBox())) {
-            item.setIsOnScreen(true);
-            sizePowerUp.push_back(item);
-        } else {
-            item.setIsOnScreen(false);
+    sweep(gamePtr->getLevel()->getSizePowerUp(), sizePowerUpBounds, broad_phase_area, sizePowerUp);
+    sweep(gamePtr->getLevel()->getSpeedPowerUp(), speedPowerUpBounds, broad_phase_area, speedPowerUp);
+}
+
+void BroadPhaseManager::checkCoins(const SDL_FRect &broad_phase_area) {
+    sweep(gamePtr->getLevel()->getCoins(), coinsBounds, broad_phase_area, coins);
+}
+
+void BroadPhaseManager::checkItems(const SDL_FRect &broad_phase_area) {
+    sweep(gamePtr->getLevel()->getItems(), itemsBounds, broad_phase_area, items);
+}
+
+template<typename T, typename Element>
+void BroadPhaseManager::sweep(std::vector<Element> &collection, StaticBounds &bounds, const SDL_FRect &broad_phase_area, std::vector<Handle<T>> &result) {
+    Level const *level = gamePtr->getLevel();
+
+    // Items are stored by pointer, every other collection by value
+    auto object = [&collection](size_t i) -> T & {
+        if constexpr (std::is_pointer_v<Element>) return *collection[i];
+        else return collection[i];
+    };
+
+    // A new level or a picked object moved the collection, gather its bounds again and hide every object until it is found
+    uint32_t generation = level->getHandle<T>(0).generation;
+    if (bounds.generation != generation) {
+        bounds.batch.clear();
+        for (size_t i = 0; i < collection.size(); i++) {
+            bounds.batch.push(object(i).getBoundingBox());
+            object(i).setIsOnScreen(false);
         }
+        bounds.generation = generation;
+        result.clear(); // The old handles are stale
     }
 
-    // Check for collisions with speed power-up
-    for (SpeedPowerUp &item: gamePtr->getLevel()->getSpeedPowerUp()) {
-        if (checkAABBCollision(broad_phase_area, item.getBoundingBox())) {
-            item.setIsOnScreen(true);
-            speedPowerUp.push_back(item);
+    // Test the whole collection against the broad phase area at once
+    bounds.batch.query(broad_phase_area, candidates);
+
+    // Both lists are sorted by index, only the objects entering or leaving the area change their state
+    size_t i = 0;
+    size_t j = 0;
+    while (i < result.size() || j < candidates.size()) {
+        if (j == candidates.size() || (i < result.size() && result[i].index < candidates[j])) {
+            object(result[i++].index).setIsOnScreen(false);
+        } else if (i == result.size() || candidates[j] < result[i].index) {
+            object(candidates[j++]).setIsOnScreen(true);
         } else {
-            item.setIsOnScreen(false);
+            i++;
+            j++;
         }
     }
+
+    result.clear(); // Empty old handles
+    for (size_t index: candidates) {
+        result.push_back(level->getHandle<T>(index));
+    }
 }
 
-void BroadPhaseManager::checkCoins(const SDL_FRect &broad_phase_area) {
-    coins.clear(); // Empty old coins
+template<typename T>
+void BroadPhaseManager::collect(const SDL_FRect &broad_phase_area, std::vector<Handle<T>> &result) {
+    Level *level = gamePtr->getLevel();
+
+    // The handles of a previous level are stale, the new level has already hidden all its objects
+    if (!result.empty() && result.front().generation != level->getHandle<T>(0).generation) result.clear();
+
+    // Descend only the branches of the tree overlapping the broad phase area
+    level->getTree<T>().query(broad_phase_area, candidates);
 
-    // Check for collisions with coins
-    for (Coin &coin: gamePtr->getLevel()->getCoins()) {
-        if (checkAABBCollision(broad_phase_area, coin.getBoundingBox())) {
-            coin.setIsOnScreen(true);
-            coins.push_back(coin);
+    // Both lists are sorted by index, only the objects entering or leaving the area change their state
+    size_t i = 0;
+    size_t j = 0;
+    while (i < result.size() || j < candidates.size()) {
+        if (j == candidates.size() || (i < result.size() && result[i].index < candidates[j])) {
+            level->setIsOnScreen<T>(result[i++].index, false);
+        } else if (i == result.size() || candidates[j] < result[i].index) {
+            level->setIsOnScreen<T>(candidates[j++], true);
         } else {
-            coin.setIsOnScreen(false);
+            i++;
+            j++;
         }
     }
+
+    result.clear(); // Empty old handles
+    for (size_t index: candidates) {
+        result.push_back(level->getHandle<T>(index));
+    }
 }
 
-void BroadPhaseManager::checkItems(const SDL_FRect &broad_phase_area) {
-    items.clear(); // Empty old items
+bool BroadPhaseManager::updateStaticSets(const SDL_FRect &broad_phase_area) {
+    // A new level has been loaded since the last rebuild, every static handle is stale
+    uint32_t generation = gamePtr->getLevel()->getHandle<Polygon>(0).generation;
 
-    // Check for collisions with items
-    for (Item *item: gamePtr->getLevel()->getItems()) {
-        if (checkAABBCollision(broad_phase_area, item->getBoundingBox())) {
-            item->setIsOnScreen(true);
-            items.push_back(item);
-        } else {
-            item->setIsOnScreen(false);
-        }
-    }
+    bool inside = broad_phase_area.x >= staticArea.x && broad_phase_area.y >= staticArea.y &&
+                  broad_phase_area.x + broad_phase_area.w <= staticArea.x + staticArea.w &&
+                  broad_phase_area.y + broad_phase_area.h <= staticArea.y + staticArea.h;
+
+    // The mode is read once, the console thread may change it during the frame
+    bool is_incremental = incremental;
+    if (is_incremental && staticIncremental && inside && generation == staticGeneration) return false;
+
+    // Rebuild the static sets over an area larger than the broad phase area, so they stay valid while the camera moves inside it
+    float margin = is_incremental ? BROAD_PHASE_HYSTERESIS : 0;
+    staticArea = {broad_phase_area.x - margin, broad_phase_area.y - margin, broad_phase_area.w + 2 * margin, broad_phase_area.h + 2 * margin};
+    staticGeneration = generation;
+    staticIncremental = is_incremental;
+
+    Quad static_area_vertices = makeQuad(staticArea.x, staticArea.y, staticArea.w, staticArea.h);
+
+    checkSavesZones(staticArea);
+    checkRescueZones(staticArea);
+    checkToggleGravityZones(staticArea);
+    checkIncreaseFallSpeedZones(staticArea);
+    checkDeathZones(staticArea, static_area_vertices);
+    checkObstacles(staticArea, static_area_vertices);
+    return true;
 }
 
 void BroadPhaseManager::broadPhase() {
@@ -339,18 +397,25 @@ void BroadPhaseManager::broadPhase() {
     std::vector<Point> broad_phase_area_vertices = gamePtr->getCamera()->getBroadPhaseAreaVertices();
     SDL_FRect broad_phase_area_bounding_box = gamePtr->getCamera()->getBroadPhaseArea();
 
-    checkSavesZones(broad_phase_area_bounding_box);
-    checkRescueZones(broad_phase_area_bounding_box);
-    checkToggleGravityZones(broad_phase_area_bounding_box);
-    checkIncreaseFallSpeedZones(broad_phase_area_bounding_box);
-    checkDeathZones(broad_phase_area_vertices);
-    checkObstacles(broad_phase_area_vertices);
+    // Bounding box of the vertices used for the static sets (the vertices area is wider than the bounding box area)
+    SDL_FRect broad_phase_area_vertices_box = {
+            broad_phase_area_vertices[0].x,
+            broad_phase_area_vertices[0].y,
+            broad_phase_area_vertices[2].x - broad_phase_area_vertices[0].x,
+            broad_phase_area_vertices[2].y - broad_phase_area_vertices[0].y
+    };
+
+    // The static sets only change when the camera leaves the static area, the moving objects are checked every frame
+    if (updateStaticSets(broad_phase_area_vertices_box)) fullRebuildCount++;
+    else reusedFrameCount++;
+
     check1DMovingPlatforms(broad_phase_area_bounding_box);
     check2DMovingPlatforms(broad_phase_area_bounding_box);
     checkSwitchingPlatforms(broad_phase_area_bounding_box);
     checkWeightPlatforms(broad_phase_area_bounding_box);
     checkTreadmills(broad_phase_area_bounding_box);
     checkCrushers(broad_phase_area_bounding_box);
+    checkPowerUps(broad_phase_area_bounding_box);
     checkCoins(broad_phase_area_bounding_box);
     checkItems(broad_phase_area_bounding_box);
 
@@ -366,4 +431,102 @@ void BroadPhaseManager::broadPhase() {
         checkPlatformLevers(broad_phase_area_bounding_box);
         checkCrusherLevers(broad_phase_area_bounding_box);
     }
-}
\ No newline at end of file
+}
+
+SDL_FRect BroadPhaseManager::getSweptArea(const Player &player) {
+    const SDL_FRect boxes[4] = {player.getBoundingBoxPreviousMove(), player.getBoundingBox(), player.getBoundingBoxNextFrame(), player.getHitZoneBoundingBox()};
+
+    // Union of the boxes occupied by the player during the frame
+    float min_x = boxes[0].x, min_y = boxes[0].y;
+    float max_x = boxes[0].x + boxes[0].w, max_y = boxes[0].y + boxes[0].h;
+    for (const SDL_FRect &box: boxes) {
+        min_x = std::min(min_x, box.x);
+        min_y = std::min(min_y, box.y);
+        max_x = std::max(max_x, box.x + box.w);
+        max_y = std::max(max_y, box.y + box.h);
+    }
+
+    return {min_x - PLAYER_NEIGHBOURHOOD_MARGIN, min_y - PLAYER_NEIGHBOURHOOD_MARGIN,
+            max_x - min_x + 2 * PLAYER_NEIGHBOURHOOD_MARGIN, max_y - min_y + 2 * PLAYER_NEIGHBOURHOOD_MARGIN};
+}
+
+void BroadPhaseManager::gatherZones(AABBType type, std::span<const Handle<AABB>> handles, const SDL_FRect &swept_area, std::vector<Handle<AABB>> &result) const {
+    result.clear(); // Empty old handles
+    Level const *level = gamePtr->getLevel();
+
+    // The static sets hold the zones of the static area, which covers the broad phase area
+    for (Handle<AABB> handle: handles) {
+        const AABB *zone = level->getZone(type, handle);
+        if (zone != nullptr && checkAABBCollision(swept_area, zone->getRect())) {
+            result.push_back(handle);
+        }
+    }
+}
+
+void BroadPhaseManager::gatherZones(PolygonType type, std::span<const Handle<Polygon>> handles, const SDL_FRect &swept_area, std::vector<Handle<Polygon>> &result) const {
+    result.clear(); // Empty old handles
+    Level const *level = gamePtr->getLevel();
+
+    // The static sets hold the zones of the static area, which covers the broad phase area
+    for (Handle<Polygon> handle: handles) {
+        const Polygon *zone = level->getZone(type, handle);
+        if (zone != nullptr && checkAABBCollision(swept_area, zone->getBoundingBox())) {
+            result.push_back(handle);
+        }
+    }
+}
+
+template<typename T>
+void BroadPhaseManager::gatherMoving(const SDL_FRect &swept_area, std::vector<Handle<T>> &result) {
+    result.clear(); // Empty old handles
+    Level const *level = gamePtr->getLevel();
+
+    // Descend only the branches of the tree overlapping the swept area
+    level->getTree<T>().query(swept_area, candidates);
+    for (size_t index: candidates) {
+        result.push_back(level->getHandle<T>(index));
+    }
+}
+
+template<typename T>
+void BroadPhaseManager::gatherVisible(std::span<const Handle<T>> handles, const SDL_FRect &swept_area, std::vector<Handle<T>> &result) {
+    result.clear(); // Empty old handles
+    Level *level = gamePtr->getLevel();
+
+    // These sets only hold the objects of the broad phase area, a bounds test is enough
+    for (Handle<T> handle: handles) {
+        const T *object = level->get(handle);
+        if (object != nullptr && checkAABBCollision(swept_area, object->getBoundingBox())) {
+            result.push_back(handle);
+        }
+    }
+}
+
+void BroadPhaseManager::gatherNeighbourhood(const Player &player, Neighbourhood &result) {
+    SDL_FRect swept_area = getSweptArea(player);
+
+    // Static zones, filtered from the static sets which are only rebuilt when the camera leaves the static area
+    gatherZones(AABBType::SAVE, getSaveZones(), swept_area, result.saveZones);
+    gatherZones(AABBType::RESCUE, getRescueZones(), swept_area, result.rescueZones);
+    gatherZones(AABBType::TOGGLE_GRAVITY, getToggleGravityZones(), swept_area, result.toggleGravityZones);
+    gatherZones(AABBType::INCREASE_FALL_SPEED, getIncreaseFallSpeedZones(), swept_area, result.increaseFallSpeedZones);
+    gatherZones(PolygonType::DEATH, getDeathZones(), swept_area, result.deathZones);
+    gatherZones(PolygonType::COLLISION, getObstacles(), swept_area, result.obstacles);
+
+    // Moving objects, only the branches of their trees overlapping the swept area are visited
+    gatherMoving(swept_area, result.movingPlatforms1D);
+    gatherMoving(swept_area, result.movingPlatforms2D);
+    gatherMoving(swept_area, result.switchingPlatforms);
+    gatherMoving(swept_area, result.weightPlatforms);
+    gatherMoving(swept_area, result.crushers);
+
+    // Objects refreshed by the broad phase
+    gatherVisible(getTreadmills(), swept_area, result.treadmills);
+    gatherVisible(getTreadmillLevers(), swept_area, result.treadmillLevers);
+    gatherVisible(getPlatformLevers(), swept_area, result.platformLevers);
+    gatherVisible(getCrusherLevers(), swept_area, result.crusherLevers);
+    gatherVisible(getSizePowerUps(), swept_area, result.sizePowerUp);
+    gatherVisible(getSpeedPowerUps(), swept_area, result.speedPowerUp);
+    gatherVisible(getCoins(), swept_area, result.coins);
+    gatherVisible(getItems(), swept_area, result.items);
+}
@@ -14,50 +14,49 @@ EventCollisionManager::EventCollisionManager(Game *game) : gamePtr(game) {}
 /* METHODS */
 
 void EventCollisionManager::handleAsteroidsCollisions() {
-    std::vector<Asteroid> asteroids = gamePtr->getLevel()->getAsteroids();
-    const std::vector<Polygon>& collisionObstacles = gamePtr->getLevel()->getZones(PolygonType::COLLISION);
-
-    for (auto asteroidIt = asteroids.begin(); asteroidIt != asteroids.end();) {
-        Asteroid& asteroid = *asteroidIt;
-        bool alreadyExplode = false;
-        std::vector<Player>& characters = gamePtr->getPlayerManager().getAlivePlayers();
-
-        // Check collisions with characters
-        auto characterIt = characters.begin();
-        while (!alreadyExplode && characterIt != characters.end()) {
-            Player& character = *characterIt;
-            if (checkAABBCollision(character.getBoundingBox(), asteroid.getBoundingBox())) {
-                alreadyExplode = true;
-                gamePtr->getPlayerManager().killPlayer(character);
+    Level *level = gamePtr->getLevel();
+    AsteroidPool &asteroids = level->getAsteroids();
+    const std::vector<Polygon> &collisionObstacles = level->getZones(PolygonType::COLLISION);
+
+    exploding.assign(asteroids.size(), false);
+
+    // Check collisions with characters, each character only visits the asteroids near it in the tree
+    for (Player &character: gamePtr->getPlayerManager().getAlivePlayers()) {
+        bool hit = false;
+        level->getTree<Asteroid>().query(character.getBoundingBox(), candidates);
+        for (size_t index: candidates) {
+            if (!exploding[index]) {
+                exploding[index] = true;
+                hit = true;
             }
-            ++characterIt;
         }
+        if (hit) gamePtr->getPlayerManager().killPlayer(character);
+    }
+
+    for (size_t i = 0; i < asteroids.size(); i++) {
+        if (exploding[i]) continue;
 
-        // Check collisions with obstacles
-        auto obstacleIt = collisionObstacles.begin();
-        while (!alreadyExplode && obstacleIt != collisionObstacles.end()) {
-            const Polygon& obstacle = *obstacleIt;
-            if (checkSATCollision(asteroid.getVertices(), obstacle)) {
-                alreadyExplode = true;
+        // Check collisions with the obstacles sharing a cell with the asteroid
+        level->queryZones(PolygonType::COLLISION, asteroids.getBoundingBox(i), candidates);
+        for (size_t index: candidates) {
+            if (checkSATCollision(asteroids.getVertices(i), collisionObstacles[index])) {
+                exploding[i] = true;
                 gamePtr->getCamera()->setShake(250);
                 break; // No need to check further obstacles if the asteroid already exploded
             }
-            ++obstacleIt;
         }
 
         // Check if asteroid goes out of bounds
-        if (!alreadyExplode && asteroid.getY() > gamePtr->getCamera()->getY() + gamePtr->getCamera()->getH() - asteroid.getH()) {
-            alreadyExplode = true;
+        if (!exploding[i] && asteroids.getY(i) > gamePtr->getCamera()->getY() + gamePtr->getCamera()->getH() - asteroids.getH(i)) {
+            exploding[i] = true;
         }
+    }
 
-        // Handle explosion or move to the next asteroid
-        if (alreadyExplode) {
-            asteroid.explode();
-            asteroidIt = asteroids.erase(asteroidIt); // Remove the asteroid and update the iterator
-        } else {
-            ++asteroidIt; // Move to the next asteroid
+    // Remove the exploded asteroids from the last one, so the asteroid swapped in has already been checked
+    for (size_t i = asteroids.size(); i-- > 0;) {
+        if (exploding[i]) {
+            asteroids.explode(i);
+            level->removeAsteroid(i);
         }
     }
-
-    gamePtr->getLevel()->setAsteroids(asteroids);
-}
\ No newline at end of file
+}
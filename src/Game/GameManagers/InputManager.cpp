@@ -15,7 +15,6 @@ InputManager::InputManager(Game *game) : gamePtr(game) {}
 
 void InputManager::handleKeyboardEvents() {
     SDL_Event e;
-    Player *playerPtr = gamePtr->getPlayerManager().findPlayerById(-1);
 
     // Main loop handling every event one by one
     while (SDL_PollEvent(&e) != 0) {
@@ -37,12 +36,9 @@ void InputManager::handleKeyboardEvents() {
             continue;
         }
 
-        // Handle key events
-        if (e.type == SDL_KEYUP) {
-            handleKeyUpEvent(playerPtr, e.key);
-        }
-        if (e.type == SDL_KEYDOWN) {
-            handleKeyDownEvent(playerPtr, e.key);
+        // Handle key events (the players belong to the simulation thread)
+        if (e.type == SDL_KEYUP || e.type == SDL_KEYDOWN) {
+            queueKeyEvent(e.key);
         }
 
             // Handle SDL_MOUSEBUTTONDOWN events
@@ -53,8 +49,36 @@ void InputManager::handleKeyboardEvents() {
         }
     }
 
-    // If the player is alive, send the keyboard state to the network after handling all events
-    if (playerPtr != nullptr) sendKeyboardStateToNetwork();
+    // The keyboard state after all events, the next tick sends it with the events it applies
+    const Uint8 *keyboardState = SDL_GetKeyboardState(nullptr);
+    uint16_t keyboardStateMask = Mediator::encodeKeyboardStateMask(keyboardState);
+
+    std::scoped_lock lock(keyEventsMutex);
+    polledKeyboardStateMask = keyboardStateMask;
+}
+
+void InputManager::queueKeyEvent(const SDL_KeyboardEvent &keyEvent) {
+    std::scoped_lock lock(keyEventsMutex);
+    keyEvents.push_back(keyEvent);
+}
+
+void InputManager::applyKeyEvents() {
+    uint16_t keyboardStateMask;
+    {
+        std::scoped_lock lock(keyEventsMutex);
+        std::swap(keyEvents, tickKeyEvents);
+        keyboardStateMask = polledKeyboardStateMask;
+    }
+
+    Player *playerPtr = gamePtr->getPlayerManager().findPlayerById(-1);
+    for (const SDL_KeyboardEvent &keyEvent: tickKeyEvents) {
+        if (keyEvent.type == SDL_KEYUP) handleKeyUpEvent(playerPtr, keyEvent);
+        else handleKeyDownEvent(playerPtr, keyEvent);
+    }
+    tickKeyEvents.clear();
+
+    // If there is a local player, send the keyboard state applied by this tick to the network
+    if (!gamePtr->isHeadless()) sendKeyboardStateToNetwork(keyboardStateMask);
 }
 
 void InputManager::handleKeyUpEvent(Player *player, const SDL_KeyboardEvent &keyEvent) const {
@@ -153,8 +177,9 @@ void InputManager::handleKeyDownEvent(Player *player, const SDL_KeyboardEvent &k
             gamePtr->switchMavity(); // Switch mavity for all players
             break;
         case SDL_SCANCODE_M:
-            if (gamePtr->getLevel()->getMapID() == 1) gamePtr->setLevel("assurance");
-            else gamePtr->setLevel("diversity");
+            // The level is replaced by the render thread, it loads the textures
+            if (gamePtr->getLevel()->getMapID() == 1) gamePtr->requestLevel("assurance");
+            else gamePtr->requestLevel("diversity");
             break;
         case SDL_SCANCODE_LSHIFT:
             if (player == nullptr) break;
@@ -170,7 +195,7 @@ void InputManager::handleKeyDownEvent(Player *player, const SDL_KeyboardEvent &k
 }
 
 
-void InputManager::sendKeyboardStateToNetwork() {
+void InputManager::sendKeyboardStateToNetwork(uint16_t keyboardStateMask) {
 
     // Check if the game is in development mode
 #ifdef DEVELOPMENT_MODE
@@ -179,24 +204,16 @@ void InputManager::sendKeyboardStateToNetwork() {
     bool isDevelopmentMode = false;
 #endif
 
-    // Get the current keyboard state mask
-    const Uint8 *keyboardState = SDL_GetKeyboardState(nullptr);
-    uint16_t currentKeyboardStateMask = Mediator::encodeKeyboardStateMask(keyboardState);
-
     // If the keyboard state has changed since the last message was sent
-    if (!isDevelopmentMode || currentKeyboardStateMask != lastKeyboardStateMask) {
-        // Send the new keyboard state mask to the server
-        Mediator::sendPlayerUpdate(currentKeyboardStateMask);
+    if (!isDevelopmentMode || keyboardStateMask != lastKeyboardStateMask) {
+        // Send the new keyboard state mask to the server, the tick is the input sequence acknowledged by the server
+        Mediator::sendPlayerUpdate(static_cast<uint16_t>(SimulationClock::getTick()), keyboardStateMask);
 
         // Update the last keyboard state mask and the last send-time
-        lastKeyboardStateMask = currentKeyboardStateMask;
+        lastKeyboardStateMask = keyboardStateMask;
     }
 }
 
 void InputManager::sendSyncCorrectionToNetwork() const {
-    using json = nlohmann::json;
-    json message;
-
-    message["messageType"] = "syncCorrection";
-    Mediator::sendSyncCorrection(message);
+    Mediator::sendSyncCorrection();
 }
\ No newline at end of file
@@ -9,47 +9,79 @@
 
 /* CONSTRUCTORS */
 
-PlayerCollisionManager::PlayerCollisionManager(Game *game) : gamePtr(game) {}
+PlayerCollisionManager::PlayerCollisionManager(Game *game) : gamePtr(game) {
+    // One command buffer per worker, reserved up front so the narrow phase does not allocate
+    commandBuffers.resize(gamePtr->getJobSystem().getWorkerCount());
+    for (CommandBuffer &buffer: commandBuffers) buffer.commands.reserve(COMMAND_BUFFER_CAPACITY);
+}
 
 
 /* METHODS */
 
-void PlayerCollisionManager::handleCollisionsWithObstacles(Player *player) {
+void PlayerCollisionManager::handleCollisionsWithObstacles(Player *player, const Neighbourhood &neighbourhood) {
+    Level const *level = gamePtr->getLevel();
+
+    // A move longer than half of the player can cross a thin obstacle, stop it inside the first obstacle hit
+    float half_extent = std::min(player->getW(), player->getH()) / 2;
+    if (std::abs(player->getMoveX()) > half_extent || std::abs(player->getMoveY()) > half_extent) {
+        const SDL_FRect start = player->getBoundingBoxPreviousMove();
+        const Point move = {player->getMoveX(), player->getMoveY()};
+        const Polygon *first_obstacle = nullptr;
+        float first_time = 1;
+
+        // The obstacles already overlapped at the start of the move are corrected below
+        for (Handle<Polygon> handle: neighbourhood.obstacles) {
+            const Polygon *obstacle = level->getZone(PolygonType::COLLISION, handle);
+            float time;
+            if (obstacle != nullptr && sweptSATCollision(start, move, *obstacle, time) && time > 0 && time < first_time) {
+                first_obstacle = obstacle;
+                first_time = time;
+            }
+        }
+        if (first_obstacle != nullptr) checkSATCollisionTunneling(player, *first_obstacle);
+    }
+
     // Check collisions with each obstacle
-    for (const Polygon &obstacle: gamePtr->getBroadPhaseManager().getObstacles()) {
+    for (Handle<Polygon> handle: neighbourhood.obstacles) {
+        const Polygon *obstacle = level->getZone(PolygonType::COLLISION, handle);
+        if (obstacle == nullptr) continue;
+
         // Check if a collision is detected
-        if (checkSATCollision(player->getVertices(), obstacle)) {
+        if (checkSATCollision(player->getVertices(), *obstacle)) {
 
-            correctSATCollision(player, obstacle); // Correct the collision
+            correctSATCollision(player, *obstacle); // Correct the collision
 
             // If the collision is with the roof, the player can't jump anymore
-            if (checkSATCollision(player->getRoofColliderVertices(), obstacle)) {
+            if (checkSATCollision(player->getRoofColliderVertices(), *obstacle)) {
                 player->setRoofCollider(true);
                 player->setIsJumping(false);
                 player->setMoveY(0);
             }
             // If the collision is with the ground, the player is on the ground
-            if (!player->getIsGrounded() && checkSATCollision(player->getGroundColliderVertices(), obstacle)) {
+            if (!player->getIsGrounded() && checkSATCollision(player->getGroundColliderVertices(), *obstacle)) {
                 player->setGroundCollider(true);
                 player->setIsGrounded(true);
             }
         }
         // If the collision is with the wall, the player can't move
-        if (player->getCanMove() && checkSATCollision(player->getHorizontalColliderVertices(), obstacle)) {
+        if (player->getCanMove() && checkSATCollision(player->getHorizontalColliderVertices(), *obstacle)) {
             player->getDirectionX() > 0 ? player->setRightCollider(true) : player->setLeftCollider(true);
             player->setCanMove(false);
         }
     }
 }
 
-bool PlayerCollisionManager::handleCollisionsWithTreadmillLevers(const Player *player) {
+bool PlayerCollisionManager::handleCollisionsWithTreadmillLevers(const Player *player, const Neighbourhood &neighbourhood, CommandBuffer &buffer) {
     // Check for collisions with each lever
-    for (const TreadmillLever &lever: gamePtr->getBroadPhaseManager().getTreadmillLevers()) {
+    for (Handle<TreadmillLever> handle: neighbourhood.treadmillLevers) {
+        const TreadmillLever *lever = gamePtr->getLevel()->get(handle);
+        if (lever == nullptr) continue;
+
         // Check if a collision is detected
-        if (checkAABBCollision(player->getHitZoneBoundingBox(), lever.getBoundingBox())) {
+        if (checkAABBCollision(player->getHitZoneBoundingBox(), lever->getBoundingBox())) {
             // If the player is on the lever, activate it
-            if (checkAABBCollision(player->getGroundColliderBoundingBox(), lever.getBoundingBox())) {
-                gamePtr->getLevel()->activateTreadmillLever(lever);
+            if (checkAABBCollision(player->getGroundColliderBoundingBox(), lever->getBoundingBox())) {
+                buffer.record(WorldCommandType::TOGGLE_TREADMILL_LEVER, handle); // Toggled once every player is resolved
                 return true;
             }
         }
@@ -57,14 +89,17 @@ bool PlayerCollisionManager::handleCollisionsWithTreadmillLevers(const Player *p
     return false;
 }
 
-bool PlayerCollisionManager::handleCollisionsWithPlatformLevers(const Player *player) {
+bool PlayerCollisionManager::handleCollisionsWithPlatformLevers(const Player *player, const Neighbourhood &neighbourhood, CommandBuffer &buffer) {
     // Check for collisions with each lever
-    for (const PlatformLever &lever: gamePtr->getBroadPhaseManager().getPlatformLevers()) {
+    for (Handle<PlatformLever> handle: neighbourhood.platformLevers) {
+        const PlatformLever *lever = gamePtr->getLevel()->get(handle);
+        if (lever == nullptr) continue;
+
         // Check if a collision is detected
-        if (checkAABBCollision(player->getHitZoneBoundingBox(), lever.getBoundingBox())) {
+        if (checkAABBCollision(player->getHitZoneBoundingBox(), lever->getBoundingBox())) {
             // If the player is on the lever, activate it
-            if (checkAABBCollision(player->getGroundColliderBoundingBox(), lever.getBoundingBox())) {
-                gamePtr->getLevel()->activatePlatformLever(lever);
+            if (checkAABBCollision(player->getGroundColliderBoundingBox(), lever->getBoundingBox())) {
+                buffer.record(WorldCommandType::TOGGLE_PLATFORM_LEVER, handle); // Toggled once every player is resolved
                 return true;
             }
         }
@@ -72,14 +107,17 @@ bool PlayerCollisionManager::handleCollisionsWithPlatformLevers(const Player *pl
     return false;
 }
 
-bool PlayerCollisionManager::handleCollisionsWithCrusherLevers(const Player *player) {
+bool PlayerCollisionManager::handleCollisionsWithCrusherLevers(const Player *player, const Neighbourhood &neighbourhood, CommandBuffer &buffer) {
     // Check for collisions with each lever
-    for (const CrusherLever &lever: gamePtr->getBroadPhaseManager().getCrusherLevers()) {
+    for (Handle<CrusherLever> handle: neighbourhood.crusherLevers) {
+        const CrusherLever *lever = gamePtr->getLevel()->get(handle);
+        if (lever == nullptr) continue;
+
         // Check if a collision is detected
-        if (checkAABBCollision(player->getHitZoneBoundingBox(), lever.getBoundingBox())) {
+        if (checkAABBCollision(player->getHitZoneBoundingBox(), lever->getBoundingBox())) {
             // If the player is on the lever, activate it
-            if (checkAABBCollision(player->getGroundColliderBoundingBox(), lever.getBoundingBox())) {
-                gamePtr->getLevel()->activateCrusherLever(lever);
+            if (checkAABBCollision(player->getGroundColliderBoundingBox(), lever->getBoundingBox())) {
+                buffer.record(WorldCommandType::TOGGLE_CRUSHER_LEVER, handle); // Toggled once every player is resolved
                 return true;
             }
         }
@@ -87,31 +125,34 @@ bool PlayerCollisionManager::handleCollisionsWithCrusherLevers(const Player *pla
     return false;
 }
 
-void PlayerCollisionManager::handleCollisionsWithMovingPlatform1D(Player *player) {
+void PlayerCollisionManager::handleCollisionsWithMovingPlatform1D(Player *player, const Neighbourhood &neighbourhood) {
     // Check for collisions with each 1D moving platform
-    for (const MovingPlatform1D &platform: gamePtr->getBroadPhaseManager().getMovingPlatforms1D()) {
+    for (Handle<MovingPlatform1D> handle: neighbourhood.movingPlatforms1D) {
+        const MovingPlatform1D *platform = gamePtr->getLevel()->get(handle);
+        if (platform == nullptr) continue;
+
         // Check if a collision is detected
-        if (checkAABBCollision(player->getBoundingBox(), platform.getBoundingBox())) {
+        if (checkAABBCollision(player->getBoundingBox(), platform->getBoundingBox())) {
 
-            correctAABBCollision(player, platform.getBoundingBox()); // Correct the collision
+            correctAABBCollision(player, platform->getBoundingBox()); // Correct the collision
 
             // If the collision is with the roof, the player can't jump anymore
-            if (checkAABBCollision(player->getRoofColliderBoundingBox(), platform.getBoundingBox())) {
+            if (checkAABBCollision(player->getRoofColliderBoundingBox(), platform->getBoundingBox())) {
                 player->setRoofCollider(true);
                 player->setIsJumping(false);
                 player->setMoveY(0);
             }
             // If the collision is with the ground, the player is on a platform
-            if (checkAABBCollision(player->getGroundColliderBoundingBox(), platform.getBoundingBox())) {
+            if (checkAABBCollision(player->getGroundColliderBoundingBox(), platform->getBoundingBox())) {
                 player->setGroundCollider(true);
                 player->setIsGrounded(true);
                 player->setIsOnPlatform(true);
                 // Add platform velocity to the player
-                if (!platform.getAxis()) player->setX(player->getX() + platform.getMove());
-                else player->setY(player->getY() + platform.getMove());
+                if (!platform->getAxis()) player->setX(player->getX() + platform->getMove());
+                else player->setY(player->getY() + platform->getMove());
             }
             // If the collision is with the wall, the player can't move
-            if (checkAABBCollision(player->getHorizontalColliderBoundingBox(), platform.getBoundingBox())) {
+            if (checkAABBCollision(player->getHorizontalColliderBoundingBox(), platform->getBoundingBox())) {
                 player->getDirectionX() > 0 ? player->setRightCollider(true) : player->setLeftCollider(true);
                 player->setCanMove(false);
             }
@@ -119,32 +160,35 @@ void PlayerCollisionManager::handleCollisionsWithMovingPlatform1D(Player *player
     }
 }
 
-void PlayerCollisionManager::handleCollisionsWithMovingPlatform2D(Player *player) {
+void PlayerCollisionManager::handleCollisionsWithMovingPlatform2D(Player *player, const Neighbourhood &neighbourhood) {
 
     // Check for collisions with each 2D moving platform
-    for (const MovingPlatform2D &platform: gamePtr->getBroadPhaseManager().getMovingPlatforms2D()) {
+    for (Handle<MovingPlatform2D> handle: neighbourhood.movingPlatforms2D) {
+        const MovingPlatform2D *platform = gamePtr->getLevel()->get(handle);
+        if (platform == nullptr) continue;
+
         // Check if a collision is detected
-        if (checkAABBCollision(player->getBoundingBox(), platform.getBoundingBox())) {
+        if (checkAABBCollision(player->getBoundingBox(), platform->getBoundingBox())) {
 
-            correctAABBCollision(player, platform.getBoundingBox()); // Correct the collision
+            correctAABBCollision(player, platform->getBoundingBox()); // Correct the collision
 
             // If the collision is with the roof, the player can't jump anymore
-            if (checkAABBCollision(player->getRoofColliderBoundingBox(), platform.getBoundingBox())) {
+            if (checkAABBCollision(player->getRoofColliderBoundingBox(), platform->getBoundingBox())) {
                 player->setRoofCollider(true);
                 player->setIsJumping(false);
                 player->setMoveY(0);
             }
             // If the collision is with the ground, the player is on a platform
-            if (checkAABBCollision(player->getGroundColliderBoundingBox(), platform.getBoundingBox())) {
+            if (checkAABBCollision(player->getGroundColliderBoundingBox(), platform->getBoundingBox())) {
                 player->setGroundCollider(true);
                 player->setIsGrounded(true);
                 player->setIsOnPlatform(true);
                 // Add platform velocity to the player
-                player->setX(player->getX() + platform.getMoveX());
-                player->setY(player->getY() + platform.getMoveY());
+                player->setX(player->getX() + platform->getMoveX());
+                player->setY(player->getY() + platform->getMoveY());
             }
             // If the collision is with the wall, the player can't move
-            if (checkAABBCollision(player->getHorizontalColliderBoundingBox(), platform.getBoundingBox())) {
+            if (checkAABBCollision(player->getHorizontalColliderBoundingBox(), platform->getBoundingBox())) {
                 player->getDirectionX() > 0 ? player->setRightCollider(true) : player->setLeftCollider(true);
                 player->setCanMove(false);
             }
@@ -152,29 +196,32 @@ void PlayerCollisionManager::handleCollisionsWithMovingPlatform2D(Player *player
     }
 }
 
-void PlayerCollisionManager::handleCollisionsWithSwitchingPlatform(Player *player) {
+void PlayerCollisionManager::handleCollisionsWithSwitchingPlatform(Player *player, const Neighbourhood &neighbourhood) {
 
     // Check for collisions with each switching platform
-    for (const SwitchingPlatform &platform: gamePtr->getBroadPhaseManager().getSwitchingPlatforms()) {
+    for (Handle<SwitchingPlatform> handle: neighbourhood.switchingPlatforms) {
+        const SwitchingPlatform *platform = gamePtr->getLevel()->get(handle);
+        if (platform == nullptr) continue;
+
         // Check if a collision is detected
-        if (checkAABBCollision(player->getBoundingBox(), platform.getBoundingBox())) {
+        if (checkAABBCollision(player->getBoundingBox(), platform->getBoundingBox())) {
 
-            correctAABBCollision(player, platform.getBoundingBox()); // Correct the collision
+            correctAABBCollision(player, platform->getBoundingBox()); // Correct the collision
 
             // If the collision is with the roof, the player can't jump anymore
-            if (checkAABBCollision(player->getRoofColliderBoundingBox(), platform.getBoundingBox())) {
+            if (checkAABBCollision(player->getRoofColliderBoundingBox(), platform->getBoundingBox())) {
                 player->setRoofCollider(true);
                 player->setIsJumping(false);
                 player->setMoveY(0);
             }
             // If the collision is with the ground, the player is on a platform
-            if (checkAABBCollision(player->getGroundColliderBoundingBox(), platform.getBoundingBox())) {
+            if (checkAABBCollision(player->getGroundColliderBoundingBox(), platform->getBoundingBox())) {
                 player->setGroundCollider(true);
                 player->setIsGrounded(true);
                 player->setIsOnPlatform(true);
             }
             // If the collision is with the wall, the player can't move
-            if (checkAABBCollision(player->getHorizontalColliderBoundingBox(), platform.getBoundingBox())) {
+            if (checkAABBCollision(player->getHorizontalColliderBoundingBox(), platform->getBoundingBox())) {
                 player->getDirectionX() > 0 ? player->setRightCollider(true) : player->setLeftCollider(true);
                 player->setCanMove(false);
             }
@@ -182,30 +229,32 @@ void PlayerCollisionManager::handleCollisionsWithSwitchingPlatform(Player *playe
     }
 }
 
-void PlayerCollisionManager::handleCollisionsWithWeightPlatform(Player *player) {
+void PlayerCollisionManager::handleCollisionsWithWeightPlatform(Player *player, const Neighbourhood &neighbourhood, CommandBuffer &buffer) {
     // Check for collisions with each switching platform
-    for (const WeightPlatform &platform: gamePtr->getBroadPhaseManager().getWeightPlatforms()) {
+    for (Handle<WeightPlatform> handle: neighbourhood.weightPlatforms) {
+        const WeightPlatform *platform = gamePtr->getLevel()->get(handle);
+        if (platform == nullptr) continue;
+
         // Check if a collision is detected
-        if (checkAABBCollision(player->getBoundingBox(), platform.getBoundingBox())) {
+        if (checkAABBCollision(player->getBoundingBox(), platform->getBoundingBox())) {
 
-            correctAABBCollision(player, platform.getBoundingBox()); // Correct the collision
+            correctAABBCollision(player, platform->getBoundingBox()); // Correct the collision
 
             // If the collision is with the roof, the player can't jump anymore
-            if (checkAABBCollision(player->getRoofColliderBoundingBox(), platform.getBoundingBox())) {
+            if (checkAABBCollision(player->getRoofColliderBoundingBox(), platform->getBoundingBox())) {
                 player->setRoofCollider(true);
                 player->setIsJumping(false);
                 player->setMoveY(0);
             }
             // If the collision is with the ground, the player is on a platform
-            if (checkAABBCollision(player->getGroundColliderBoundingBox(), platform.getBoundingBox())) {
+            if (checkAABBCollision(player->getGroundColliderBoundingBox(), platform->getBoundingBox())) {
                 player->setGroundCollider(true);
                 player->setIsGrounded(true);
                 player->setIsOnPlatform(true);
-                if (player->getMavity() > 0) gamePtr->getLevel()->increaseWeightForPlatform(platform);
-                else gamePtr->getLevel()->decreaseWeightForPlatform(platform);
+                buffer.record(player->getMavity() > 0 ? WorldCommandType::INCREASE_WEIGHT : WorldCommandType::DECREASE_WEIGHT, handle);
             }
             // If the collision is with the wall, the player can't move
-            if (checkAABBCollision(player->getHorizontalColliderBoundingBox(), platform.getBoundingBox())) {
+            if (checkAABBCollision(player->getHorizontalColliderBoundingBox(), platform->getBoundingBox())) {
                 player->getDirectionX() > 0 ? player->setRightCollider(true) : player->setLeftCollider(true);
                 player->setCanMove(false);
             }
@@ -213,35 +262,38 @@ void PlayerCollisionManager::handleCollisionsWithWeightPlatform(Player *player)
     }
 }
 
-void PlayerCollisionManager::handleCollisionsWithTreadmills(Player *player) {
+void PlayerCollisionManager::handleCollisionsWithTreadmills(Player *player, const Neighbourhood &neighbourhood) {
     // Check for collisions with each treadmill
-    for (const Treadmill &treadmill: gamePtr->getBroadPhaseManager().getTreadmills()) {
+    for (Handle<Treadmill> handle: neighbourhood.treadmills) {
+        const Treadmill *treadmill = gamePtr->getLevel()->get(handle);
+        if (treadmill == nullptr) continue;
+
         // Check if a collision is detected
-        if (checkAABBCollision(player->getBoundingBox(), treadmill.getBoundingBox())) {
+        if (checkAABBCollision(player->getBoundingBox(), treadmill->getBoundingBox())) {
 
-            correctAABBCollision(player, treadmill.getBoundingBox()); // Correct the collision
+            correctAABBCollision(player, treadmill->getBoundingBox()); // Correct the collision
 
             // If the collision is with the roof, the player can't jump anymore
-            if (checkAABBCollision(player->getRoofColliderBoundingBox(), treadmill.getBoundingBox())) {
+            if (checkAABBCollision(player->getRoofColliderBoundingBox(), treadmill->getBoundingBox())) {
                 player->setRoofCollider(true);
                 player->setIsJumping(false);
                 player->setMoveY(0);
             }
             // If the collision is with the ground, the player is on a platform
-            if (checkAABBCollision(player->getGroundColliderBoundingBox(), treadmill.getBoundingBox())) {
+            if (checkAABBCollision(player->getGroundColliderBoundingBox(), treadmill->getBoundingBox())) {
                 player->setGroundCollider(true);
                 player->setIsGrounded(true);
                 player->setIsOnPlatform(true);
 
                 // Add treadmill velocity to the player
-                if (treadmill.getIsMoving()) {
-                    float move = treadmill.getMove();
+                if (treadmill->getIsMoving()) {
+                    float move = treadmill->getMove();
                     if (player->getMavity() < 0) move *= -1; // Apply mavity
                     player->setX(player->getX() + move);
                 }
             }
             // If the collision is with the wall, the player can't move
-            if (checkAABBCollision(player->getHorizontalColliderBoundingBox(), treadmill.getBoundingBox())) {
+            if (checkAABBCollision(player->getHorizontalColliderBoundingBox(), treadmill->getBoundingBox())) {
                 player->getDirectionX() > 0 ? player->setRightCollider(true) : player->setLeftCollider(true);
                 player->setCanMove(false);
             }
@@ -250,35 +302,38 @@ void PlayerCollisionManager::handleCollisionsWithTreadmills(Player *player) {
 
 }
 
-bool PlayerCollisionManager::handleCollisionsWithCrushers(Player *player) {
+bool PlayerCollisionManager::handleCollisionsWithCrushers(Player *player, const Neighbourhood &neighbourhood) {
     // Check for collisions with each crusher
-    for (Crusher const &crusher : gamePtr->getBroadPhaseManager().getCrushers()) {
+    for (Handle<Crusher> handle: neighbourhood.crushers) {
+        const Crusher *crusher = gamePtr->getLevel()->get(handle);
+        if (crusher == nullptr) continue;
+
         // Check if a collision is detected
-            if (checkAABBCollision(player->getBoundingBox(), crusher.getBoundingBox())) {
+            if (checkAABBCollision(player->getBoundingBox(), crusher->getBoundingBox())) {
                 // If the player is being crushed, return true to kill him
-                if (crusher.getIsCrushing() && checkAABBCollision(player->getBoundingBox(), crusher.getCrushingZoneBoundingBox())) {
+                if (crusher->getIsCrushing() && checkAABBCollision(player->getBoundingBox(), crusher->getCrushingZoneBoundingBox())) {
                     return true;
                 }
                 // If the player is not being crushed, correct the collision
                 else {
 
-                    correctAABBCollision(player, crusher.getBoundingBox());
+                    correctAABBCollision(player, crusher->getBoundingBox());
 
                     // If the collision is with the roof, the player can't jump anymore
-                    if (checkAABBCollision(player->getRoofColliderBoundingBox(), crusher.getBoundingBox())) {
+                    if (checkAABBCollision(player->getRoofColliderBoundingBox(), crusher->getBoundingBox())) {
                         player->setRoofCollider(true);
                         player->setIsJumping(false);
                         player->setMoveY(0);
                     }
                     // If the collision is with the ground, the player is on a platform
-                    if (checkAABBCollision(player->getGroundColliderBoundingBox(), crusher.getBoundingBox())) {
+                    if (checkAABBCollision(player->getGroundColliderBoundingBox(), crusher->getBoundingBox())) {
                         player->setGroundCollider(true);
                         player->setIsGrounded(true);
                         player->setIsOnPlatform(true);
                         player->setMoveY(0);
                     }
                     // If the collision is with the wall, the player can't move
-                    if (checkAABBCollision(player->getHorizontalColliderBoundingBox(), crusher.getBoundingBox())) {
+                    if (checkAABBCollision(player->getHorizontalColliderBoundingBox(), crusher->getBoundingBox())) {
                         player->getDirectionX() > 0 ? player->setRightCollider(true) : player->setLeftCollider(true);
                         player->setCanMove(false);
                     }
@@ -298,125 +353,140 @@ bool PlayerCollisionManager::handleCollisionsWithCameraBorders(const SDL_FRect p
            || player.y + player.h > camera.y + camera.h + DISTANCE_OUT_MAP_BEFORE_DEATH; // Bottom border
 }
 
-bool PlayerCollisionManager::handleCollisionsWithDeathZones(const Player &player) {
-    size_t i = 0;
-    const std::vector<Polygon> &deathZones = gamePtr->getBroadPhaseManager().getDeathZones();
+bool PlayerCollisionManager::handleCollisionsWithDeathZones(const Player &player, const Neighbourhood &neighbourhood) {
+    Level const *level = gamePtr->getLevel();
 
     // Check collisions with each death zone until the player is dead
-    while (i < deathZones.size() && !checkSATCollision(player.getVertices(), deathZones[i])) {
-        i++;
-    }
-
-    return i != deathZones.size(); // True if the player collided with a death zone
-}
-
-void PlayerCollisionManager::handleCollisionsWithSaveZones(Player &player) {
-    // Check collisions with each save zone
-    for (const AABB &save_zone : gamePtr->getBroadPhaseManager().getSaveZones()) {
-        // Check a collision is detected and the zone has not yet been reached
-        if (static_cast<int>(player.getCurrentZoneID()) == (save_zone.getID() + 1)) return;
-        if (checkAABBCollision(player.getBoundingBox(), save_zone.getRect()) && gamePtr->getLevel()->getLastCheckpoint() < save_zone.getID()) {
-            gamePtr->getLevel()->setLastCheckpoint(static_cast<short>(save_zone.getID()));
-            player.setCurrentZoneID(save_zone.getID() + 1);
-            std::cout << "Checkpoint reached: " << save_zone.getID() << std::endl;
+    for (Handle<Polygon> handle: neighbourhood.deathZones) {
+        const Polygon *zone = level->getZone(PolygonType::DEATH, handle);
+        if (zone != nullptr && checkSATCollision(player.getVertices(), *zone)) {
+            return true; // The player collided with a death zone
         }
     }
-}
 
-void PlayerCollisionManager::handleCollisionsWithRescueZones(const Player &player) {
-    // Check collisions with each rescue zone
-    for (const AABB &zone : gamePtr->getBroadPhaseManager().getRescueZones()) {
-        // Check a collision is detected
-        if (checkAABBCollision(player.getBoundingBox(), zone.getRect())) {
-            gamePtr->getPlayerManager().setCurrentRescueZone(zone);
-        }
-    }
+    return false;
 }
 
-void PlayerCollisionManager::handleCollisionsWithToggleGravityZones(Player &player, double delta_time) {
-    const std::vector<AABB> &toggleGravityZones = gamePtr->getBroadPhaseManager().getToggleGravityZones();
-
-    // Check collisions with each toggle gravity zone
-    for (size_t i = 0; i < toggleGravityZones.size(); ++i) {
-        const AABB &toggleGravityZone = toggleGravityZones[i];
-        const SDL_FRect &playerBoundingBox = player.getBoundingBox();
-        const SDL_FRect &toggleGravityRect = toggleGravityZone.getRect();
-
-        if (checkAABBCollision(playerBoundingBox, toggleGravityRect)) {
-            const size_t zoneID = i + 100;
-
-            // If the player was already in the zone, skip the zone
-            if (player.getCurrentZoneID() == zoneID) {
-                continue;
-            }
+void PlayerCollisionManager::handleTriggerZones(Player &player, const Neighbourhood &neighbourhood, CommandBuffer &buffer, double delta_time) {
+    Level const *level = gamePtr->getLevel();
+    TriggerSet &triggers = player.getTriggers();
+    const SDL_FRect &player_box = player.getBoundingBox();
 
-            player.toggleMavity();
-            player.getSprite()->toggleFlipVertical();
+    // Collect the zones overlapped at this tick
+    auto overlap = [&](AABBType type, const std::vector<Handle<AABB>> &handles) {
+        for (Handle<AABB> handle: handles) {
+            const AABB *zone = level->getZone(type, handle);
+            if (zone != nullptr && checkAABBCollision(player_box, zone->getRect())) triggers.overlap(type, handle);
+        }
+    };
+    overlap(AABBType::SAVE, neighbourhood.saveZones);
+    overlap(AABBType::RESCUE, neighbourhood.rescueZones);
+    overlap(AABBType::TOGGLE_GRAVITY, neighbourhood.toggleGravityZones);
+    overlap(AABBType::INCREASE_FALL_SPEED, neighbourhood.increaseFallSpeedZones);
+
+    // The zones act only when the player enters or exits them
+    triggers.update([&](const TriggerEvent &event) {
+        if (event.phase == TriggerPhase::STAY) return;
+        const AABB *zone = level->getZone(event.type, event.zone);
+
+        switch (event.type) {
+            case AABBType::SAVE:
+                // Saved once every player is resolved, if the zone has not yet been reached
+                if (event.phase == TriggerPhase::ENTER && zone != nullptr && level->getLastCheckpoint() < zone->getID()) {
+                    buffer.record(WorldCommandType::REACH_CHECKPOINT, zone->getID());
+                }
+                break;
 
-            float gravityOffset = toggleGravityZone.getHeight() * static_cast<float>(delta_time) * 30;
-            float currentMoveY = player.getMoveY();
-            float newMoveY = (player.getMavity() < 0) ? std::max(currentMoveY, gravityOffset) : std::min(currentMoveY, -gravityOffset);
-            player.setMoveY(newMoveY);
-            player.setCurrentZoneID(zoneID);
+            case AABBType::RESCUE:
+                if (event.phase == TriggerPhase::ENTER && zone != nullptr) {
+                    buffer.record(WorldCommandType::SET_RESCUE_ZONE, event.zone);
+                }
+                break;
+
+            case AABBType::TOGGLE_GRAVITY:
+                if (event.phase == TriggerPhase::ENTER && zone != nullptr) {
+                    player.toggleMavity();
+                    player.getSprite()->toggleFlipVertical();
+
+                    // Push the player through the zone in the direction of the new gravity
+                    float gravityOffset = zone->getHeight() * static_cast<float>(delta_time) * 30;
+                    float currentMoveY = player.getMoveY();
+                    float newMoveY = (player.getMavity() < 0) ? std::max(currentMoveY, gravityOffset) : std::min(currentMoveY, -gravityOffset);
+                    player.setMoveY(newMoveY);
+                }
+                break;
 
-            // Exit the loop if the player is in the zone (no need to check the other zones)
-            return;
+            case AABBType::INCREASE_FALL_SPEED:
+                // The fall speed stays increased while the player overlaps at least one of these zones
+                if (event.phase == TriggerPhase::ENTER) player.setMaxFallSpeed(1300);
+                else if (triggers.count(AABBType::INCREASE_FALL_SPEED) == 0) player.setMaxFallSpeed(600);
+                break;
         }
+    });
+}
+
+void PlayerCollisionManager::handleCollisionsWithSizePowerUps(const Player *player, const Neighbourhood &neighbourhood, CommandBuffer &buffer) {
+    // Check for collisions with each item
+    for (Handle<SizePowerUp> handle : neighbourhood.sizePowerUp) {
+        const SizePowerUp *item = gamePtr->getLevel()->get(handle);
 
-            // If the player is in the zone, but not colliding with it anymore, reset the player's zone
-        else if (player.getCurrentZoneID() == i + 100) {
-            player.setCurrentZoneID(0);
+        // If a collision is detected, apply item's effect to the player and erase it once every player is resolved
+        if (item != nullptr && checkAABBCollision(player->getBoundingBox(), item->getBoundingBox())) {
+            buffer.record(WorldCommandType::PICK_SIZE_POWER_UP, handle);
         }
     }
 }
 
-void PlayerCollisionManager::handleCollisionsWithIncreaseFallSpeedZones(Player &player) {
-    // Check collisions with each increase fall speed zone
-    for (const auto & increaseFallSpeedZone : gamePtr->getBroadPhaseManager().getIncreaseFallSpeedZones()) {
-        // Check if the player is already in the increase fall speed zone
-        if (checkAABBCollision(player.getBoundingBox(), increaseFallSpeedZone.getRect())) {
-            player.setMaxFallSpeed(1300);
-        } else {
-            player.setCurrentZoneID(0);
-            player.setMaxFallSpeed(600);
+void PlayerCollisionManager::handleCollisionsWithSpeedPowerUps(const Player *player, const Neighbourhood &neighbourhood, CommandBuffer &buffer) {
+    // Check for collisions with each item
+    for (Handle<SpeedPowerUp> handle : neighbourhood.speedPowerUp) {
+        const SpeedPowerUp *item = gamePtr->getLevel()->get(handle);
+
+        // If a collision is detected, apply item's effect to the player and erase it once every player is resolved
+        if (item != nullptr && checkAABBCollision(player->getBoundingBox(), item->getBoundingBox())) {
+            buffer.record(WorldCommandType::PICK_SPEED_POWER_UP, handle);
         }
     }
 }
 
-void PlayerCollisionManager::handleCollisionsWithSizePowerUps(Player *player) {
+void PlayerCollisionManager::handleCollisionsWithCoins(const Player *player, const Neighbourhood &neighbourhood, CommandBuffer &buffer) {
     // Check for collisions with each item
-    for (SizePowerUp &item : gamePtr->getBroadPhaseManager().getSizePowerUps()) {
-        // If a collision is detected, apply item's effect to the player and erase it
-        if (checkAABBCollision(player->getBoundingBox(), item.getBoundingBox())) {
-            item.applyEffect(*player);
-            gamePtr->getLevel()->removeItemFromSizePowerUp(item);
+    for (Handle<Coin> handle : neighbourhood.coins) {
+        const Coin *item = gamePtr->getLevel()->get(handle);
+
+        // If a collision is detected, apply item's effect to the player and erase it once every player is resolved
+        if (item != nullptr && checkAABBCollision(player->getBoundingBox(), item->getBoundingBox())) {
+            buffer.record(WorldCommandType::PICK_COIN, handle);
         }
     }
 }
 
-void PlayerCollisionManager::handleCollisionsWithSpeedPowerUps(Player *player) {
-    // Check for collisions with each item
-    for (SpeedPowerUp &item : gamePtr->getBroadPhaseManager().getSpeedPowerUps()) {
-        // If a collision is detected, apply item's effect to the player and erase it
-        if (checkAABBCollision(player->getBoundingBox(), item.getBoundingBox())) {
-            item.applyEffect(*player);
-            gamePtr->getLevel()->removeItemFromSpeedPowerUp(item);
+void PlayerCollisionManager::handleCollisionsWithItem(const Player *player, const Neighbourhood &neighbourhood, CommandBuffer &buffer) {
+    //section to get the new power
+    for(Handle<Item> handle : neighbourhood.items){
+        const Item *item = gamePtr->getLevel()->get(handle);
+
+        // If a collision is detected, apply item's effect to the player and erase it once every player is resolved
+        if (item != nullptr && checkAABBCollision(player->getBoundingBox(), item->getBoundingBox())) {
+            buffer.record(WorldCommandType::PICK_ITEM, handle);
         }
     }
+
 }
 
-void PlayerCollisionManager::handleCollisionsWithCoins(Player *player) {
-    // Check for collisions with each item
-    for (Coin &item : gamePtr->getBroadPhaseManager().getCoins()) {
-        // If a collision is detected, apply item's effect to the player and erase it
-        if (checkAABBCollision(player->getBoundingBox(), item.getBoundingBox())) {
-            item.applyEffect(*player);
-            gamePtr->getLevel()->removeItemFromCoins(item);
+bool PlayerCollisionManager::handleCollisionsWithDeadPlayers(const Player *player, CommandBuffer &buffer) {
+    // Check for collisions with each dead player
+    for (const Player &dead_player : gamePtr->getPlayerManager().getDeadPlayers()) {
+        // If a collision is detected, respawn the dead player
+        if (checkAABBCollision(player->getHitZoneBoundingBox(), dead_player.getBoundingBox())) {
+            buffer.record(WorldCommandType::RESPAWN_PLAYER, dead_player.getPlayerID()); // Respawned once every player is resolved
+            return true;
         }
     }
+    return false;
 }
 
-void PlayerCollisionManager::handleCollisionsWithItem(Player *player) {
+void PlayerCollisionManager::expireItems() {
     //section check if the time of the power has not passed
 
     //checks if the queue is empty
@@ -428,9 +498,11 @@ void PlayerCollisionManager::handleCollisionsWithItem(Player *player) {
             //we get the first element of the queue
             GameData* current = timeQueue.front();
             //check if the time of the power has passed
-            if (difftime(time(nullptr) ,current->t) >= 4){
+            if (SimulationClock::getTicks() - current->t >= 4000){
+                //revert the effect on the player who picked up the item (if he is still in the game)
+                Player *player = gamePtr->getPlayerManager().findPlayerById(current->playerID);
+                if (player != nullptr) current->item->inverseEffect(*player);
                 //we remove the element form the queue since is not necessary
-                current->item->inverseEffect(*player);
                 timeQueue.pop();
                 //free the allocated memory
                 free(current);
@@ -443,99 +515,245 @@ void PlayerCollisionManager::handleCollisionsWithItem(Player *player) {
             }
         }
     }
+}
 
-    //section to get the new power
-    for(Item* item : gamePtr->getLevel()->getItems()){
-        // If a collision is detected, apply item's effect to the player and erase it
-        if (checkAABBCollision(player->getBoundingBox(), item->getBoundingBox())) {
-            item->applyEffect(*player);
-            auto* data = static_cast<GameData *>(calloc(1, sizeof(GameData)));
-            //initialise the gameData
-            time(&data->t);
-            data->item = item;
-            timeQueue.push(data);
-            gamePtr->getLevel()->removeItem(*item);
+/**
+ * @brief Check if an item was already picked during this frame.
+ * @param picked The indices of the items of a collection picked during this frame.
+ * @param index The index of the item.
+ * @return True if the item is already picked.
+ */
+static bool isPicked(const std::vector<uint32_t> &picked, uint32_t index) {
+    return std::ranges::find(picked, index) != picked.end();
+}
+
+void PlayerCollisionManager::applyCommands() {
+    Level *level = gamePtr->getLevel();
+    PlayerManager &playerManager = gamePtr->getPlayerManager();
+
+    // Merge the buffers and sort them by player, the commands of a player keep the order they were recorded in
+    commands.clear();
+    for (CommandBuffer &buffer: commandBuffers) {
+        commands.insert(commands.end(), buffer.commands.begin(), buffer.commands.end());
+        buffer.commands.clear();
+    }
+    std::ranges::stable_sort(commands, {}, &WorldCommand::player);
+
+    // The commands refer to the players by their index in the living players, which changes when a player dies
+    resolvedPlayers.clear();
+    for (Player &player: playerManager.getAlivePlayers()) resolvedPlayers.push_back(&player);
+
+    for (const WorldCommand &command: commands) {
+        Player &player = *resolvedPlayers[command.player];
+
+        switch (command.type) {
+            case WorldCommandType::KILL_PLAYER:
+                playerManager.killPlayer(player);
+                break;
+
+            case WorldCommandType::TOGGLE_TREADMILL_LEVER:
+                if (TreadmillLever *lever = level->get(Handle<TreadmillLever>{command.index, command.generation})) {
+                    lever->toggleIsActivated();
+                    level->refreshActivity(*lever); // Wake up or put to sleep the linked objects
+                }
+                break;
+
+            case WorldCommandType::TOGGLE_PLATFORM_LEVER:
+                if (PlatformLever *lever = level->get(Handle<PlatformLever>{command.index, command.generation})) {
+                    lever->toggleIsActivated();
+                    level->refreshActivity(*lever); // Wake up or put to sleep the linked objects
+                }
+                break;
+
+            case WorldCommandType::TOGGLE_CRUSHER_LEVER:
+                if (CrusherLever *lever = level->get(Handle<CrusherLever>{command.index, command.generation})) {
+                    lever->toggleIsActivated();
+                    level->refreshActivity(*lever); // Wake up or put to sleep the linked objects
+                }
+                break;
+
+            case WorldCommandType::INCREASE_WEIGHT:
+                if (WeightPlatform *platform = level->get(Handle<WeightPlatform>{command.index, command.generation})) {
+                    platform->increaseWeight();
+                }
+                break;
+
+            case WorldCommandType::DECREASE_WEIGHT:
+                if (WeightPlatform *platform = level->get(Handle<WeightPlatform>{command.index, command.generation})) {
+                    platform->decreaseWeight();
+                }
+                break;
+
+            // The item may have been picked up by a previous player during this frame, it is removed once after the loop
+            case WorldCommandType::PICK_SIZE_POWER_UP: {
+                SizePowerUp *item = level->get(Handle<SizePowerUp>{command.index, command.generation});
+                if (item != nullptr && !isPicked(pickedSizePowerUps, command.index)) {
+                    item->applyEffect(player);
+                    pickedSizePowerUps.push_back(command.index);
+                }
+                break;
+            }
+
+            case WorldCommandType::PICK_SPEED_POWER_UP: {
+                SpeedPowerUp *item = level->get(Handle<SpeedPowerUp>{command.index, command.generation});
+                if (item != nullptr && !isPicked(pickedSpeedPowerUps, command.index)) {
+                    item->applyEffect(player);
+                    pickedSpeedPowerUps.push_back(command.index);
+                }
+                break;
+            }
+
+            case WorldCommandType::PICK_COIN: {
+                Coin *item = level->get(Handle<Coin>{command.index, command.generation});
+                if (item != nullptr && !isPicked(pickedCoins, command.index)) {
+                    item->applyEffect(player);
+                    pickedCoins.push_back(command.index);
+                }
+                break;
+            }
+
+            case WorldCommandType::PICK_ITEM: {
+                Item *item = level->get(Handle<Item>{command.index, command.generation});
+                if (item != nullptr && !isPicked(pickedItems, command.index)) {
+                    item->applyEffect(player);
+                    auto* data = static_cast<GameData *>(calloc(1, sizeof(GameData)));
+                    //initialise the gameData
+                    data->t = SimulationClock::getTicks();
+                    data->item = item;
+                    data->playerID = player.getPlayerID();
+                    timeQueue.push(data);
+                    pickedItems.push_back(command.index);
+                }
+                break;
+            }
+
+            case WorldCommandType::REACH_CHECKPOINT:
+                // Another player may have reached a further checkpoint during the same frame
+                if (level->getLastCheckpoint() < command.value) {
+                    level->setLastCheckpoint(static_cast<short>(command.value));
+                    std::cout << "Checkpoint reached: " << command.value << std::endl;
+                }
+                break;
+
+            case WorldCommandType::SET_RESCUE_ZONE:
+                if (const AABB *zone = level->getZone(AABBType::RESCUE, Handle<AABB>{command.index, command.generation})) {
+                    playerManager.setCurrentRescueZone(*zone);
+                }
+                break;
+
+            case WorldCommandType::RESPAWN_PLAYER: {
+                // The dead player may have been respawned by a previous player
+                Player *dead_player = playerManager.findPlayerById(static_cast<int>(command.value));
+                if (dead_player != nullptr && playerManager.getPlayerState(*dead_player) == PlayerState::DEAD) playerManager.respawnPlayer(*dead_player);
+                break;
+            }
         }
     }
 
+    // Remove the items picked by every player, the handles of each collection are invalidated once
+    level->removeItemsFromSizePowerUp(pickedSizePowerUps);
+    level->removeItemsFromSpeedPowerUp(pickedSpeedPowerUps);
+    level->removeItemsFromCoins(pickedCoins);
+    level->removeItems(pickedItems);
+    pickedSizePowerUps.clear();
+    pickedSpeedPowerUps.clear();
+    pickedCoins.clear();
+    pickedItems.clear();
 }
 
-bool PlayerCollisionManager::handleCollisionsWithDeadPlayers(const Player *player) {
-    // Check for collisions with each dead player
-    for (Player &dead_player : gamePtr->getPlayerManager().getDeadPlayers()) {
-        // If a collision is detected, respawn the dead player
-        if (checkAABBCollision(player->getHitZoneBoundingBox(), dead_player.getBoundingBox())) {
-            gamePtr->getPlayerManager().respawnPlayer(dead_player);
-            return true;
-        }
+void PlayerCollisionManager::handlePlayerCollisions(Player &player, const Neighbourhood &neighbourhood, CommandBuffer &buffer, double delta_time) {
+    // Handle collisions with death zones and camera borders to check if the player dies
+    if (handleCollisionsWithCameraBorders(player.getBoundingBox())
+        || handleCollisionsWithDeathZones(player, neighbourhood)
+        || handleCollisionsWithCrushers(&player, neighbourhood))
+    {
+        buffer.record(WorldCommandType::KILL_PLAYER);
+        return;
     }
-    return false;
+
+    // Check every other collision if the player is alive
+    player.setLeftCollider(false);
+    player.setRightCollider(false);
+    player.setRoofCollider(false);
+    player.setGroundCollider(false);
+    player.setCanMove(true);
+    player.setIsGrounded(false);
+    player.setIsOnPlatform(false);
+
+#ifdef DEVELOPMENT_MODE
+    size_t allocations = getAllocationCount();
+#endif
+
+    if (player.hasMoved()) handleCollisionsWithObstacles(&player, neighbourhood); // Handle collisions with obstacles
+
+    // Handle collisions with platforms
+    handleCollisionsWithMovingPlatform1D(&player, neighbourhood);
+    handleCollisionsWithMovingPlatform2D(&player, neighbourhood);
+    handleCollisionsWithSwitchingPlatform(&player, neighbourhood);
+    handleCollisionsWithWeightPlatform(&player, neighbourhood, buffer);
+    handleCollisionsWithTreadmills(&player, neighbourhood);
+
+#ifdef DEVELOPMENT_MODE
+    // Diagnostic only: report the allocations of the narrow phase against obstacles and platforms, it is expected not to allocate
+    if (getAllocationCount() != allocations) {
+        std::cerr << "PlayerCollisionManager: WARNING : " << getAllocationCount() - allocations << " heap allocations during the narrow phase" << std::endl;
+    }
+#endif
+
+    // Check if the player leaves a platform (this is what we call in French "bidouillage")
+    if (player.getWasOnPlatform() && !player.getIsOnPlatform()) {
+        player.setWasOnPlatform(false);
+        player.setMoveY(0);
+    }
+    player.setWasOnPlatform(player.getIsOnPlatform());
+
+    // Handle collisions with hit zone
+    if (player.getIsHitting() && (handleCollisionsWithTreadmillLevers(&player, neighbourhood, buffer)
+                                || handleCollisionsWithPlatformLevers(&player, neighbourhood, buffer)
+                                || handleCollisionsWithCrusherLevers(&player, neighbourhood, buffer)
+                                || handleCollisionsWithDeadPlayers(&player, buffer))) {
+
+        player.setIsHitting(false);
+    }
+
+    // Handle collisions with items
+    handleCollisionsWithItem(&player, neighbourhood, buffer);
+    handleCollisionsWithCoins(&player, neighbourhood, buffer);
+
+    handleTriggerZones(player, neighbourhood, buffer, delta_time); // Handle the save, rescue, toggle gravity and increase fall speed zones
 }
 
 void PlayerCollisionManager::handleCollisions(double delta_time) {
-    // Handle collisions for each living player
-    for (Player &player: gamePtr->getPlayerManager().getAlivePlayers()) {
-        player.updateCollisionBox();
-
-        // Handle collisions with death zones and camera borders to check if the player dies
-        if (handleCollisionsWithCameraBorders(player.getBoundingBox())
-            || handleCollisionsWithDeathZones(player)
-            || handleCollisionsWithCrushers(&player))
-        {
-            gamePtr->getPlayerManager().killPlayer(player);
-        }
-        // Check every other collision if the player is alive
-        else {
-            player.setLeftCollider(false);
-            player.setRightCollider(false);
-            player.setRoofCollider(false);
-            player.setGroundCollider(false);
-            player.setCanMove(true);
-            player.setIsGrounded(false);
-            player.setIsOnPlatform(false);
-
-            if (player.hasMoved()) handleCollisionsWithObstacles(&player); // Handle collisions with obstacles
-
-            // Handle collisions with platforms
-            handleCollisionsWithMovingPlatform1D(&player);
-            handleCollisionsWithMovingPlatform2D(&player);
-            handleCollisionsWithSwitchingPlatform(&player);
-            handleCollisionsWithWeightPlatform(&player);
-            handleCollisionsWithTreadmills(&player);
-
-            // Check if the player leaves a platform (this is what we call in French "bidouillage")
-            if (player.getWasOnPlatform() && !player.getIsOnPlatform()) {
-                player.setWasOnPlatform(false);
-                player.setMoveY(0);
-            }
-            player.setWasOnPlatform(player.getIsOnPlatform());
+    PlayerSlotMap::View players = gamePtr->getPlayerManager().getAlivePlayers();
 
-            // Handle collisions with hit zone
-            if (player.getIsHitting() && (handleCollisionsWithTreadmillLevers(&player)
-                                        || handleCollisionsWithPlatformLevers(&player)
-                                        || handleCollisionsWithCrusherLevers(&player)
-                                        || handleCollisionsWithDeadPlayers(&player))) {
+    expireItems(); // Revert the effects of the expired items before the players are resolved
 
-                player.setIsHitting(false);
-            }
+    // Gather the neighbourhood of each living player (the broad phase shares its buffers, so it stays sequential)
+    if (neighbourhoods.size() < std::max<size_t>(players.size(), 1)) neighbourhoods.resize(std::max<size_t>(players.size(), 1));
+    for (size_t i = 0; i < players.size(); i++) {
+        players[i].updateCollisionBox();
+        gamePtr->getBroadPhaseManager().gatherNeighbourhood(players[i], neighbourhoods[i]); // Keep only the objects near the player
+    }
 
-            // Handle collisions with items
-            handleCollisionsWithItem(&player);
-            handleCollisionsWithCoins(&player);
+    // Resolve the living players, every change of the shared world is recorded in the buffer of the worker
+    auto resolve = [this, delta_time](size_t index, size_t worker) {
+        CommandBuffer &buffer = commandBuffers[worker];
+        buffer.player = index;
+        handlePlayerCollisions(gamePtr->getPlayerManager().getAlivePlayers()[index], neighbourhoods[index], buffer, delta_time);
+    };
 
-            handleCollisionsWithSaveZones(player); // Handle collisions with save zones
-            handleCollisionsWithRescueZones(player); // Handle collisions with rescue zones
-            handleCollisionsWithToggleGravityZones(player, delta_time); // Handle collisions with toggle gravity zones
-            handleCollisionsWithIncreaseFallSpeedZones(player); // Handle collisions with increase fall speed zones
-        }
-    }
+    // Waking up the workers costs more than resolving a few players
+    gamePtr->getJobSystem().parallelFor(players.size(), resolve, NARROW_PHASE_PLAYERS_PER_JOB);
+
+    applyCommands();
 
-    // Handle collisions for each dead player
+    // Handle collisions for each dead player (the first neighbourhood is free again)
     for (Player &player: gamePtr->getPlayerManager().getDeadPlayers()) {
         player.setRoofCollider(false);
         player.setGroundCollider(false);
         player.setIsGrounded(false);
 
-        handleCollisionsWithObstacles(&player); // Handle collisions with obstacles
+        gamePtr->getBroadPhaseManager().gatherNeighbourhood(player, neighbourhoods.front()); // Keep only the obstacles near the player
+        handleCollisionsWithObstacles(&player, neighbourhoods.front()); // Handle collisions with obstacles
     }
-}
\ No newline at end of file
+}
@@ -13,20 +13,24 @@ PlayerManager::PlayerManager(Game *game) : game(game) {}
 
 /* ACCESSORS */
 
-std::vector<Player> &PlayerManager::getAlivePlayers() {
-    return alivePlayers;
+PlayerSlotMap::View PlayerManager::getAlivePlayers() {
+    return players.view(PlayerState::ALIVE);
 }
 
-std::vector<Player> &PlayerManager::getNeutralPlayers() {
-    return neutralPlayers;
+PlayerSlotMap::View PlayerManager::getNeutralPlayers() {
+    return players.view(PlayerState::NEUTRAL);
 }
 
-std::vector<Player> &PlayerManager::getDeadPlayers() {
-    return deadPlayers;
+PlayerSlotMap::View PlayerManager::getDeadPlayers() {
+    return players.view(PlayerState::DEAD);
 }
 
 size_t PlayerManager::getPlayerCount() const {
-    return alivePlayers.size() + deadPlayers.size();
+    return players.count(PlayerState::ALIVE) + players.count(PlayerState::DEAD);
+}
+
+PlayerState PlayerManager::getPlayerState(const Player &player) const {
+    return players.getState(player);
 }
 
 
@@ -38,7 +42,7 @@ void PlayerManager:: setCurrentRescueZone(AABB zone) {
         currentRescueZone.setZone(zone);
 
         // Teleport all dead players to the new rescue zone
-        for (Player &player: deadPlayers) {
+        for (Player &player: players.view(PlayerState::DEAD)) {
             player.teleport(currentRescueZone.getNextPosition(), game->getCamera()->getY());
         }
     }
@@ -48,49 +52,42 @@ void PlayerManager:: setCurrentRescueZone(AABB zone) {
 /* METHODS */
 
 Player* PlayerManager::findPlayerById(int id) {
-    auto it1 = std::ranges::find_if(alivePlayers, [id](const Player& player) {
-        return player.getPlayerID() == id;
-    });
-
-    auto it2 = std::ranges::find_if(deadPlayers, [id](const Player& player) {
-        return player.getPlayerID() == id;
-    });
+    Player *player = players.find(id);
 
-    return (it1 != alivePlayers.end()) ? std::to_address(it1) : (it1 != deadPlayers.end()) ? std::to_address(it2) : nullptr;
+    // A dying or respawning player cannot be found
+    if (player == nullptr || players.getState(*player) == PlayerState::NEUTRAL) return nullptr;
+    return player;
 }
 
 int PlayerManager::findPlayerIndexById(int id) {
-    auto it = std::ranges::find_if(alivePlayers, [id](const Player& player) {
-        return player.getPlayerID() == id;
-    });
-    return (it != alivePlayers.end()) ? static_cast<int>(std::distance(alivePlayers.begin(), it)) : -1;
+    Player const *player = players.find(id);
+    if (player == nullptr || players.getState(*player) != PlayerState::ALIVE) return -1;
+    return static_cast<int>(players.getPosition(*player));
 }
 
 Point PlayerManager::getAveragePlayerPosition() const {
     Point average_position = {0, 0};
 
     // Calculate the average position of living players ...
-    for (const Player &player: alivePlayers) {
+    for (const Player &player: players.view(PlayerState::ALIVE)) {
         average_position.x += player.getX();
         average_position.y += player.getY();
     }
 
-    if (!alivePlayers.empty()) {
-        average_position.x /= static_cast<float>(alivePlayers.size());
-        average_position.y /= static_cast<float>(alivePlayers.size());
+    if (size_t count = players.count(PlayerState::ALIVE); count > 0) {
+        average_position.x /= static_cast<float>(count);
+        average_position.y /= static_cast<float>(count);
     }
 
     return average_position;
 }
 
 void PlayerManager::addPlayer(const Player &player) {
-    alivePlayers.push_back(player);
+    players.insert(player, PlayerState::ALIVE);
 }
 
 void PlayerManager::removePlayer(const Player &player) {
-    std::erase(alivePlayers, player);
-    std::erase(neutralPlayers, player);
-    std::erase(deadPlayers, player);
+    players.erase(player.getPlayerID());
 }
 
 
@@ -116,8 +113,7 @@ void PlayerManager::killPlayer(Player &player) {
     player.setIsAlive(false);
 
     // Kill player
-    std::erase(alivePlayers, player);
-    neutralPlayers.push_back(player);
+    players.setState(player, PlayerState::NEUTRAL);
      */
 }
 
@@ -128,24 +124,22 @@ void PlayerManager::respawnPlayer(Player &player) {
     player.setIsAlive(true);
 
     // Respawn player
-    std::erase(deadPlayers, player);
-    neutralPlayers.push_back(player);
+    players.setState(player, PlayerState::NEUTRAL);
 }
 
 void PlayerManager::moveNeutralPlayer(Player &player, int state) {
     if (state < 0) {
         // Move player to dead players list
         player.teleport(currentRescueZone.getNextPosition(), game->getCamera()->getY());
-        std::erase(neutralPlayers, player);
-        deadPlayers.push_back(player);
+        players.setState(player, PlayerState::DEAD);
     } else {
         // Move player to alive players list
-        std::erase(neutralPlayers, player);
-        alivePlayers.push_back(player);
+        players.setState(player, PlayerState::ALIVE);
     }
 }
 
 void PlayerManager::setTheBestPlayer(){
+    PlayerSlotMap::View alivePlayers = players.view(PlayerState::ALIVE);
     if(!alivePlayers.empty()){
         int max = 0;
         Player *playerMax = &alivePlayers[0];
@@ -165,7 +159,5 @@ void PlayerManager::setTheBestPlayer(){
 }
 
 void PlayerManager::clearPlayers() {
-    alivePlayers.clear();
-    neutralPlayers.clear();
-    deadPlayers.clear();
+    players.clear();
 }
\ No newline at end of file
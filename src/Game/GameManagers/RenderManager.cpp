@@ -17,7 +17,7 @@ RenderManager::RenderManager(SDL_Renderer *renderer, Game *game) : renderer(rend
         std::cerr << "Error loading player textures" << std::endl;
         exit(1);
     }
-    if (!Asteroid::loadTextures(*renderer)) {
+    if (!AsteroidPool::loadTextures(*renderer)) {
         std::cerr << "Error loading asteroid textures" << std::endl;
         exit(1);
     }
@@ -93,32 +93,122 @@ void RenderManager::toggleRenderFps() {
 
 /* METHODS */
 
-void RenderManager::render() {
+void RenderManager::capture() {
+    size_t back;
+    {
+        std::scoped_lock lock(framesMutex);
+        if (!frameRequested) return; // The render thread has not taken the last frame yet
+        frameRequested = false;
+        back = 1 - frontFrame;
+    }
+
+    // The back frame belongs to this thread until it is published
+    Frame &frame = frames[back];
     Level *level = gamePtr->getLevel();
     PlayerManager &playerManager = gamePtr->getPlayerManager();
 
-    Point camera_point = gamePtr->getCamera()->getRenderingPoint();
+    frame.world.clear();
+    frame.overlay.clear();
+    frame.textures = render_textures;
+
+    // Record a player with its motion during the tick
+    auto record_player = [&frame](Player &player) {
+        Point previous = player.getPreviousPosition();
+        frame.world.setMotion({player.getX() - previous.x, player.getY() - previous.y});
+        player.render(frame.world);
+    };
+
+    // Record textures
+    if (frame.textures) {
+        level->renderItems(frame.world); // Draw the items
+        level->renderLevers(frame.world); // Draw the levers
+
+        // Draw the players
+        for (Player &player : playerManager.getDeadPlayers()) record_player(player);
+        for (Player &player : playerManager.getNeutralPlayers()) record_player(player);
+        for (Player &player : playerManager.getAlivePlayers()) record_player(player);
+        frame.world.setMotion({0, 0});
+
+        level->renderAsteroids(frame.world); // Draw the asteroids
+        level->renderPlatforms(frame.world); // Draw the platforms
+        level->renderTraps(frame.world); // Draw the traps
+    }
+
+    // Record collision boxes
+    else {
+        level->renderAsteroidsDebug(frame.world); // Draw the asteroids
+        level->renderLeversDebug(frame.world); // Draw the levers
+        level->renderPlatformsDebug(frame.world); // Draw the platforms
+        level->renderTrapsDebug(frame.world); // Draw the traps
+        level->renderItemsDebug(frame.world); // Draw the items
+
+        // Draw the players
+        for (const Player &player : playerManager.getDeadPlayers()) player.renderDebug(frame.world);
+        for (const Player &player : playerManager.getNeutralPlayers()) player.renderDebug(frame.world);
+        for (const Player &player : playerManager.getAlivePlayers()) player.renderDebug(frame.world);
+    }
+
+    // Record the camera point
+    if (render_camera_point) {
+        gamePtr->getCamera()->renderCameraPoint(frame.overlay, playerManager.getAveragePlayerPosition());
+    }
+
+    // Record the player colliders
+    if (render_player_colliders) {
+        for (const Player &player : playerManager.getAlivePlayers()) player.renderColliders(frame.overlay);
+        for (const Player &player : playerManager.getNeutralPlayers()) player.renderColliders(frame.overlay);
+        for (const Player &player : playerManager.getDeadPlayers()) player.renderColliders(frame.overlay);
+    }
+
+    frame.cameraStart = gamePtr->getCamera()->getRenderingPoint(0);
+    frame.cameraEnd = gamePtr->getCamera()->getRenderingPoint(1);
+    frame.captureCounter = SDL_GetPerformanceCounter();
+
+    // Publish the frame, the render thread takes it before its next drawing
+    std::scoped_lock lock(framesMutex);
+    frameReady = true;
+}
+
+void RenderManager::clearFrames() {
+    std::scoped_lock lock(framesMutex);
+    for (Frame &frame : frames) {
+        frame.world.clear();
+        frame.overlay.clear();
+    }
+    frameReady = false;
+    frameRequested = true;
+}
+
+void RenderManager::render() {
+    Level const *level = gamePtr->getLevel();
+
+    // Take the last frame recorded, the simulation thread records the next one into the other frame meanwhile
+    {
+        std::scoped_lock lock(framesMutex);
+        if (frameReady) {
+            frontFrame = 1 - frontFrame;
+            frameReady = false;
+            frameRequested = true;
+        }
+    }
+    const Frame &frame = frames[frontFrame];
+
+    // Draw the moving objects between their last two simulated positions
+    double elapsed = static_cast<double>(SDL_GetPerformanceCounter() - frame.captureCounter) / static_cast<double>(SDL_GetPerformanceFrequency());
+    auto alpha = static_cast<float>(std::clamp(elapsed / SimulationClock::getStepSeconds(), 0.0, 1.0));
+    Point camera_point = {frame.cameraStart.x + alpha * (frame.cameraEnd.x - frame.cameraStart.x),
+                          frame.cameraStart.y + alpha * (frame.cameraEnd.y - frame.cameraStart.y)};
 
     SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
     SDL_RenderClear(renderer);
 
-    // Render textures
-    if (render_textures) {
+    // Render textures (the layers and the obstacles only change while the simulation thread is stopped)
+    if (frame.textures) {
         // Draw the environment
         level->renderBackgrounds(renderer, camera_point); // Draw the background
-
         level->renderPolygonsDebug(renderer, camera_point); // Draw the obstacles
-        level->renderItems(renderer, camera_point); // Draw the items
-        level->renderLevers(renderer, camera_point); // Draw the levers
 
-        // Draw the players
-        for (Player &player : playerManager.getDeadPlayers()) player.render(renderer, camera_point);
-        for (Player &player : playerManager.getNeutralPlayers()) player.render(renderer, camera_point);
-        for (Player &player : playerManager.getAlivePlayers()) player.render(renderer, camera_point);
-
-        level->renderAsteroids(renderer, camera_point); // Draw the asteroids
-        level->renderPlatforms(renderer, camera_point); // Draw the platforms
-        level->renderTraps(renderer, camera_point); // Draw the traps
+        frame.world.render(renderer, camera_point, alpha); // Draw the items, the levers, the players, the asteroids, the platforms and the traps
 
         level->renderMiddleground(renderer, camera_point); // Draw the middleground
         level->renderForegrounds(renderer, camera_point); // Draw the foreground
@@ -126,18 +216,8 @@ void RenderManager::render() {
 
     // Render collision boxes
     else {
-        level->renderAsteroidsDebug(renderer, camera_point); // Draw the asteroids
         level->renderPolygonsDebug(renderer, camera_point); // Draw the obstacles
-        level->renderLeversDebug(renderer, camera_point); // Draw the levers
-        level->renderPlatformsDebug(renderer, camera_point); // Draw the platforms
-        level->renderTrapsDebug(renderer, camera_point); // Draw the traps
-        level->renderItemsDebug(renderer, camera_point); // Draw the items
-
-        // Draw the players
-        for (const Player &player : playerManager.getDeadPlayers()) player.renderDebug(renderer, camera_point);
-        for (const Player &player : playerManager.getNeutralPlayers()) player.renderDebug(renderer, camera_point);
-        for (const Player &player : playerManager.getAlivePlayers()) player.renderDebug(renderer, camera_point);
-
+        frame.world.render(renderer, camera_point, alpha); // Draw the collision boxes of the objects and the players
     }
 
     // Render the fps counter
@@ -151,23 +231,13 @@ void RenderManager::render() {
         SDL_DestroyTexture(texture);
     }
 
-    // Render the camera point
-    if (render_camera_point) {
-        Point averagePlayersPosition = playerManager.getAveragePlayerPosition();
-        gamePtr->getCamera()->renderCameraPoint(renderer, averagePlayersPosition);
-    }
-
-    // Render the camera area
+    // Render the camera area (it never moves on the screen)
     if (render_camera_area) {
         gamePtr->getCamera()->renderCameraArea(renderer);
     }
 
-    // Render the player colliders
-    if (render_player_colliders) {
-        for (const Player &player : playerManager.getAlivePlayers()) player.renderColliders(renderer, camera_point);
-        for (const Player &player : playerManager.getNeutralPlayers()) player.renderColliders(renderer, camera_point);
-        for (const Player &player : playerManager.getDeadPlayers()) player.renderColliders(renderer, camera_point);
-    }
+    // Render the camera point and the player colliders
+    frame.overlay.render(renderer, camera_point, alpha);
 
     // If the game is paused, render the menu
     if (gamePtr->getGameState() == GameState::PAUSED) {
@@ -182,4 +252,4 @@ void RenderManager::render() {
     }
 
     SDL_RenderPresent(renderer);
-}
\ No newline at end of file
+}
@@ -49,8 +49,8 @@ void SaveManager::saveGameState() {
     game_state_json["lastCheckpoint"] = level->getLastCheckpoint();
     game_state_json["playtime"] = gamePtr->getPlaytime();
 
-    const std::vector<Player>& alivePlayers = gamePtr->getPlayerManager().getAlivePlayers();
-    const std::vector<Player>& deadPlayers = gamePtr->getPlayerManager().getDeadPlayers();
+    PlayerSlotMap::View alivePlayers = gamePtr->getPlayerManager().getAlivePlayers();
+    PlayerSlotMap::View deadPlayers = gamePtr->getPlayerManager().getDeadPlayers();
     json players_json;
 
     int total_score = 0;
@@ -121,7 +121,7 @@ bool SaveManager::loadGameState() {
 
         // Load the game state
         Level *level = gamePtr->getLevel();
-        *level = Level(game_state_json["level"], gamePtr->getRenderManager().getRenderer(), &gamePtr->getTextureManager());
+        *level = Level(game_state_json["level"], gamePtr->getRenderer(), &gamePtr->getTextureManager());
         level->setLastCheckpoint(game_state_json["lastCheckpoint"]);
         gamePtr->setPlaytime(game_state_json["playtime"]);
 
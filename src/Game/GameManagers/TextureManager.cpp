@@ -12,8 +12,8 @@ int TextureManager::getWorldID() const {
     return worldID;
 }
 
-SDL_Texture& TextureManager::getLever() {
-    return *lever;
+const Texture& TextureManager::getLever() const {
+    return lever;
 }
 
 std::vector<Texture>& TextureManager::getPlatforms() {
@@ -50,7 +50,7 @@ void TextureManager::loadMiddlegroundTexture(SDL_Renderer *renderer, int level_i
     }
 }
 
-void TextureManager::loadPlatformTextures(SDL_Renderer &renderer) {
+void TextureManager::loadPlatformTextures(SDL_Renderer *renderer) {
     platforms.clear();
 
     std::string folder_path = std::format("{}world_{}/platforms/", TEXTURES_DIRECTORY, worldID); // Get the folder path
@@ -83,28 +83,30 @@ void TextureManager::loadPlatformTextures(SDL_Renderer &renderer) {
     // Load all the textures of the platforms
     for (int i = 0; i < file_count; i++) {
         std::string file_path = std::format("{}platform_{}.png", folder_path, i); // Get the file path
-        SDL_Texture *new_texture = IMG_LoadTexture(&renderer, file_path.c_str());
         float x = j["offsets"][i][0];
         float y = j["offsets"][i][1];
         float w = j["offsets"][i][2];
         float h = j["offsets"][i][3];
         SDL_FRect texture_offsets = {x, y, x + w, y + h};
-        platforms.emplace_back(*new_texture, texture_offsets);
+
+        Texture new_texture;
+        loadTexture(renderer, file_path, new_texture, texture_offsets);
+        platforms.push_back(new_texture);
     }
 }
 
-void TextureManager::loadTreadmillTexture(SDL_Renderer &renderer){
+void TextureManager::loadTreadmillTexture(SDL_Renderer *renderer){
     std::string file_path = std::format("{}world_{}/treadmill.png", SPRITES_DIRECTORY, worldID); // Get the file path
-    SDL_Texture *texture = IMG_LoadTexture(&renderer, file_path.c_str());
+    Texture texture;
 
-    if (texture == nullptr) {
+    if (!loadTexture(renderer, file_path, texture)) {
         std::cerr << "Error loading treadmill texture" << std::endl;
         exit(1);
     }
     Treadmill::setTexture(texture);
 }
 
-void TextureManager::loadCrusherTextures(SDL_Renderer &renderer) {
+void TextureManager::loadCrusherTextures(SDL_Renderer *renderer) {
     crushers.clear();
 
     std::string folder_path = std::format("{}world_{}/crushers/", TEXTURES_DIRECTORY, worldID); // Get the folder path
@@ -137,33 +139,31 @@ void TextureManager::loadCrusherTextures(SDL_Renderer &renderer) {
     // Load all the textures of the crushers
     for (int i = 0; i < file_count; i++) {
         std::string file_path = std::format("{}crusher_{}.png", folder_path, i); // Get the file path
-        SDL_Texture *new_texture = IMG_LoadTexture(&renderer, file_path.c_str());
-
-        if (new_texture == nullptr) {
-            std::cerr << "Error loading crusher textures" << std::endl;
-            exit(1);
-        }
-
         float x = j["offsets"][i][0];
         float y = j["offsets"][i][1];
         float w = j["offsets"][i][2];
         float h = j["offsets"][i][3];
         SDL_FRect texture_offsets = {x, y, x + w, y + h};
-        crushers.emplace_back(*new_texture, texture_offsets);
+
+        Texture new_texture;
+        if (!loadTexture(renderer, file_path, new_texture, texture_offsets)) {
+            std::cerr << "Error loading crusher textures" << std::endl;
+            exit(1);
+        }
+
+        crushers.push_back(new_texture);
     }
 }
 
-void TextureManager::loadLeverTexture(SDL_Renderer &renderer) {
+void TextureManager::loadLeverTexture(SDL_Renderer *renderer) {
     std::string file_path = std::format("{}world_{}/lever.png", TEXTURES_DIRECTORY, worldID); // Get the file path
-    lever = IMG_LoadTexture(&renderer, file_path.c_str());
-
-    if (lever == nullptr) {
+    if (!loadTexture(renderer, file_path, lever)) {
         std::cerr << "Error loading lever texture" << std::endl;
         exit(1);
     }
 }
 
-void TextureManager::loadBackgroundTextures(SDL_Renderer &renderer) {
+void TextureManager::loadBackgroundTextures(SDL_Renderer *renderer) {
     backgrounds.clear();
 
     std::string folder_path = std::format("{}world_{}/environment/backgrounds/", TEXTURES_DIRECTORY, worldID); // Get the folder path
@@ -179,7 +179,7 @@ void TextureManager::loadBackgroundTextures(SDL_Renderer &renderer) {
     // Load all the textures of the backgrounds
     for (int i = 0; i < file_count; i++) {
         std::string file_path = std::format("{}background_{}.png", folder_path, i); // Get the file path
-        SDL_Texture *new_texture = IMG_LoadTexture(&renderer, file_path.c_str());
+        SDL_Texture *new_texture = IMG_LoadTexture(renderer, file_path.c_str());
 
         if (new_texture == nullptr) {
             std::cerr << "Error loading background textures" << std::endl;
@@ -190,7 +190,7 @@ void TextureManager::loadBackgroundTextures(SDL_Renderer &renderer) {
     }
 }
 
-void TextureManager::loadForegroundTextures(SDL_Renderer &renderer) {
+void TextureManager::loadForegroundTextures(SDL_Renderer *renderer) {
     foregrounds.clear();
 
     std::string folder_path = std::format("{}world_{}/environment/foregrounds/", TEXTURES_DIRECTORY, worldID); // Get the folder path
@@ -206,7 +206,7 @@ void TextureManager::loadForegroundTextures(SDL_Renderer &renderer) {
     // Load all the textures of the backgrounds
     for (int i = 0; i < file_count; i++) {
         std::string file_path = std::format("{}foreground_{}.png", folder_path, i); // Get the file path
-        SDL_Texture *new_texture = IMG_LoadTexture(&renderer, file_path.c_str());
+        SDL_Texture *new_texture = IMG_LoadTexture(renderer, file_path.c_str());
 
         if (new_texture == nullptr) {
             std::cerr << "Error loading foreground textures" << std::endl;
@@ -220,12 +220,39 @@ void TextureManager::loadForegroundTextures(SDL_Renderer &renderer) {
 void TextureManager::loadWorldTextures(SDL_Renderer *renderer, int world_id) {
     worldID = world_id;
 
-    loadPlatformTextures(*renderer);
-    loadTreadmillTexture(*renderer);
-    loadCrusherTextures(*renderer);
-    loadLeverTexture(*renderer);
-    loadBackgroundTextures(*renderer);
-    loadForegroundTextures(*renderer);
+    loadPlatformTextures(renderer);
+    loadTreadmillTexture(renderer);
+    loadCrusherTextures(renderer);
+    loadLeverTexture(renderer);
+
+    // The environment is only drawn, the headless server does not need it
+    if (renderer != nullptr) {
+        loadBackgroundTextures(renderer);
+        loadForegroundTextures(renderer);
+    }
 
     std::cout << "TextureManager: Loaded world textures." << std::endl;
-}
\ No newline at end of file
+}
+
+bool TextureManager::loadTexture(SDL_Renderer *renderer, const std::string &file_path, Texture &texture, SDL_FRect offsets) {
+    if (renderer != nullptr) {
+        SDL_Texture *new_texture = IMG_LoadTexture(renderer, file_path.c_str());
+        if (new_texture == nullptr) return false;
+
+        texture = Texture(*new_texture, offsets);
+        return true;
+    }
+
+    // Without renderer, only read the size in the header of the PNG file (signature, then the IHDR chunk)
+    std::ifstream file(file_path, std::ios::binary);
+    std::array<unsigned char, 24> header = {};
+    if (!file.read(reinterpret_cast<char *>(header.data()), header.size())) return false;
+    if (header[1] != 'P' || header[2] != 'N' || header[3] != 'G' || header[12] != 'I' || header[15] != 'R') return false;
+
+    auto read_big_endian = [&header](size_t index) {
+        return static_cast<int>(header[index] << 24 | header[index + 1] << 16 | header[index + 2] << 8 | header[index + 3]);
+    };
+
+    texture = Texture(SDL_Rect{0, 0, read_big_endian(16), read_big_endian(20)}, offsets);
+    return true;
+}
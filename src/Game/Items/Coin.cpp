@@ -41,7 +41,7 @@ bool Coin::loadTexture(SDL_Renderer &renderer) {
     if (spriteTexturePtr == nullptr) {
         return false; // Return failure
     }
-    sprite = Sprite(*spriteTexturePtr, Coin::gold, 16, 16);
+    sprite = Sprite(spriteTexturePtr, Coin::gold, 16, 16);
     return true; // Return success
 }
 
@@ -54,9 +54,9 @@ void Coin::inverseEffect([[maybe_unused]] Player &player) {
     // Do nothing
 }
 
-void Coin::render(SDL_Renderer *renderer, Point camera) {
+void Coin::render(RenderSnapshot &snapshot) {
     sprite.updateAnimation();
     SDL_Rect srcRect = (*spritePtr).getSrcRect();
-    SDL_FRect itemRect = {getX() - camera.x, getY() - camera.y, getWidth(), getHeight()};
-    SDL_RenderCopyExF(renderer, (*spritePtr).getTexture(), &srcRect, &itemRect, 0.0, nullptr, (*spritePtr).getFlip());
+    SDL_FRect itemRect = {getX(), getY(), getWidth(), getHeight()};
+    snapshot.copy((*spritePtr).getTexture(), srcRect, itemRect, 0.0, (*spritePtr).getFlip());
 }
\ No newline at end of file
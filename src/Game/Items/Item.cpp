@@ -56,9 +56,9 @@ void Item::applyEffect(Player &player) {
     collectSound.play(0, -1);
 }
 
-void Item::renderDebug(SDL_Renderer *renderer, Point camera) const {
+void Item::renderDebug(RenderSnapshot &snapshot) const {
     if (isOnScreen) {
-        SDL_FRect itemRect = {x - camera.x, y - camera.y, width, height};
-        SDL_RenderFillRectF(renderer, &itemRect);
+        SDL_FRect itemRect = {x, y, width, height};
+        snapshot.fillRect(itemRect);
     }
 }
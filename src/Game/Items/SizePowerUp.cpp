@@ -33,8 +33,8 @@ void SizePowerUp::applyEffect(Player &player) {
     }
 }
 
-void SizePowerUp::render(SDL_Renderer *renderer, Point camera) {
+void SizePowerUp::render(RenderSnapshot &snapshot) {
     // Temporary render until sprite is implemented
-    SDL_SetRenderDrawColor(renderer, 0, 255, 180, 255);
-    Item::renderDebug(renderer, camera);
+    snapshot.setDrawColor(0, 255, 180, 255);
+    Item::renderDebug(snapshot);
 }
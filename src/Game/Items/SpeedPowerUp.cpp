@@ -32,8 +32,8 @@ void  SpeedPowerUp::inverseEffect(Player &player) {
     applyEffect(player);
 }
 
-void SpeedPowerUp::render(SDL_Renderer *renderer, Point camera) {
+void SpeedPowerUp::render(RenderSnapshot &snapshot) {
     // Temporary render until sprite is implemented
-    SDL_SetRenderDrawColor(renderer, 0, 255, 100, 255);
-    Item::renderDebug(renderer, camera);
+    snapshot.setDrawColor(0, 255, 100, 255);
+    Item::renderDebug(snapshot);
 }
\ No newline at end of file
@@ -13,17 +13,23 @@ Level::Level(const std::string &map_name, SDL_Renderer *renderer, TextureManager
 
     loadMapProperties(map_name);
 
-    // Load textures if needed
+    // Load textures if needed (without renderer, only their sizes are read for the collision boxes)
     if (textureManager->getWorldID() != worldID) textureManager->loadWorldTextures(renderer, worldID);
-    textureManager->loadMiddlegroundTexture(renderer, mapID);
 
-    // Load map environment
-    loadEnvironmentFromMap(map_name);
+    // Load map environment, only drawn so the headless server skips it
+    if (renderer != nullptr) {
+        textureManager->loadMiddlegroundTexture(renderer, mapID);
+        loadEnvironmentFromMap(map_name);
+    }
     loadPolygonsFromMap(map_name);
     loadPlatformsFromMap(map_name);
     loadTrapsFromMap(map_name);
     loadLeversFromMap(map_name);
     loadItemsFromMap(map_name);
+
+    // Index the static geometry and the moving objects once everything is loaded
+    buildSpatialIndex();
+    buildDynamicIndex();
 }
 
 
@@ -45,7 +51,8 @@ std::array<Point, 4> Level::getSpawnPoints(int index) const {
     return spawnPoints[index];
 }
 
-std::vector<Polygon> Level::getZones(PolygonType type) const {
+const std::vector<Polygon> &Level::getZones(PolygonType type) const {
+    static const std::vector<Polygon> empty;
     switch(type) {
         using enum PolygonType;
         case COLLISION: return collisionZones;
@@ -55,18 +62,19 @@ std::vector<Polygon> Level::getZones(PolygonType type) const {
         case CINEMATIC: return cinematicZones;
         case BOSS: return bossZones;
         case EVENT: return eventZones;
-        default: return {};
+        default: return empty;
     }
 }
 
-std::vector<AABB> Level::getZones(AABBType type) const {
+const std::vector<AABB> &Level::getZones(AABBType type) const {
+    static const std::vector<AABB> empty;
     switch(type) {
         using enum AABBType;
         case SAVE: return saveZones;
         case RESCUE: return rescueZones;
         case TOGGLE_GRAVITY: return toggleGravityZones;
         case INCREASE_FALL_SPEED: return increaseFallSpeedZones;
-        default: return {};
+        default: return empty;
     }
 }
 
@@ -74,11 +82,11 @@ Music& Level::getMusicById(int id) {
     return musics[id];
 }
 
-std::vector<Asteroid> Level::getAsteroids() const {
+AsteroidPool &Level::getAsteroids() {
     return asteroids;
 }
 
-std::vector<TreadmillLever> Level::getTreadmillLevers() const {
+std::vector<TreadmillLever>& Level::getTreadmillLevers() {
     return treadmillLevers;
 }
 
@@ -126,7 +134,7 @@ std::vector<Coin>& Level::getCoins() {
     return coins;
 }
 
-std::vector<Item*> Level::getItems() const {
+std::vector<Item*>& Level::getItems() {
     return items;
 }
 
@@ -134,6 +142,46 @@ short Level::getLastCheckpoint() const {
     return lastCheckpoint;
 }
 
+const Polygon *Level::getZone(PolygonType type, Handle<Polygon> handle) const {
+    return resolveHandle(getZones(type), generation, handle);
+}
+
+const AABB *Level::getZone(AABBType type, Handle<AABB> handle) const {
+    return resolveHandle(getZones(type), generation, handle);
+}
+
+void Level::queryZones(PolygonType type, const SDL_FRect &area, std::vector<size_t> &result) const {
+    switch(type) {
+        using enum PolygonType;
+        case COLLISION: collisionZonesGrid.query(area, result); break;
+        case DEATH: deathZonesGrid.query(area, result); break;
+        default: result.clear(); break;
+    }
+}
+
+void Level::queryZones(AABBType type, const SDL_FRect &area, std::vector<size_t> &result) const {
+    switch(type) {
+        using enum AABBType;
+        case SAVE: saveZonesGrid.query(area, result); break;
+        case RESCUE: rescueZonesGrid.query(area, result); break;
+        case TOGGLE_GRAVITY: toggleGravityZonesGrid.query(area, result); break;
+        case INCREASE_FALL_SPEED: increaseFallSpeedZonesGrid.query(area, result); break;
+        default: result.clear(); break;
+    }
+}
+
+void Level::queryTreadmillLevers(const SDL_FRect &area, std::vector<size_t> &result) const {
+    treadmillLeversGrid.query(area, result);
+}
+
+void Level::queryPlatformLevers(const SDL_FRect &area, std::vector<size_t> &result) const {
+    platformLeversGrid.query(area, result);
+}
+
+void Level::queryCrusherLevers(const SDL_FRect &area, std::vector<size_t> &result) const {
+    crusherLeversGrid.query(area, result);
+}
+
 
 /* MUTATORS */
 
@@ -141,93 +189,100 @@ void Level::setLastCheckpoint(short checkpoint) {
     lastCheckpoint = checkpoint;
 }
 
-void Level::setAsteroids(std::vector<Asteroid> const &value) {
-    this->asteroids = value;
+void Level::removeAsteroid(size_t index) {
+    // Swap and pop, the tree does the same so the indices still match
+    asteroidsTree.swapRemove(index);
+    asteroids.swapRemove(index);
 }
 
-void Level::activateTreadmillLever(const TreadmillLever &lever) {
-    // Search the lever and activate it
-    auto it = std::ranges::find(treadmillLevers, lever);
-    if (it != treadmillLevers.end()) {
-        it->toggleIsActivated();
-    }
-}
+/**
+ * @brief Remove objects of a collection, from the last one so the indices not removed yet still match.
+ * @param collection The collection of the level.
+ * @param indices The indices of the objects to remove, sorted in descending order and deduplicated.
+ * @return True if an object was removed.
+ */
+template<typename T>
+static bool eraseIndices(std::vector<T> &collection, std::vector<uint32_t> &indices) {
+    std::ranges::sort(indices, std::ranges::greater());
+    auto duplicates = std::ranges::unique(indices);
+    indices.erase(duplicates.begin(), duplicates.end());
 
-void Level::activatePlatformLever(const PlatformLever &lever) {
-    // Search the lever and activate it
-    auto it = std::ranges::find(platformLevers, lever);
-    if (it != platformLevers.end()) {
-        it->toggleIsActivated();
+    bool removed = false;
+    for (uint32_t index: indices) {
+        if (index >= collection.size()) continue;
+        collection.erase(collection.begin() + index);
+        removed = true;
     }
+    return removed;
 }
 
-void Level::activateCrusherLever(const CrusherLever &lever) {
-    // Search the lever and activate it
-    auto it = std::ranges::find(crusherLevers, lever);
-    if (it != crusherLevers.end()) {
-        it->toggleIsActivated();
-    }
+void Level::removeItemsFromSizePowerUp(std::vector<uint32_t> &indices) {
+    // The following items moved, every handle of the collection is invalidated (once for the whole batch)
+    if (eraseIndices(sizePowerUp, indices)) sizePowerUpGeneration = nextGeneration++;
 }
 
-void Level::increaseWeightForPlatform(const WeightPlatform &platform) {
-    // Search the platform and increase its weight
-    auto it = std::ranges::find(weightPlatforms, platform);
-    if (it != weightPlatforms.end()) {
-        it->increaseWeight();
-    }
+void Level::removeItemsFromSpeedPowerUp(std::vector<uint32_t> &indices) {
+    // The following items moved, every handle of the collection is invalidated (once for the whole batch)
+    if (eraseIndices(speedPowerUp, indices)) speedPowerUpGeneration = nextGeneration++;
 }
 
-void Level::decreaseWeightForPlatform(const WeightPlatform &platform) {
-    // Search the platform and decrease its weight
-    auto it = std::ranges::find(weightPlatforms, platform);
-    if (it != weightPlatforms.end()) {
-        it->decreaseWeight();
-    }
+void Level::removeItemsFromCoins(std::vector<uint32_t> &indices) {
+    // The following coins moved, every handle of the collection is invalidated (once for the whole batch)
+    if (eraseIndices(coins, indices)) coinsGeneration = nextGeneration++;
 }
 
-void Level::removeItemFromSizePowerUp(SizePowerUp const &item) {
-    // Search the item and remove it
-    auto it = std::ranges::find(sizePowerUp, item);
-    if (it != sizePowerUp.end()) {
-        sizePowerUp.erase(it);
-    }
+void Level::removeItems(std::vector<uint32_t> &indices) {
+    // The following items moved, every handle of the collection is invalidated (once for the whole batch)
+    if (eraseIndices(items, indices)) itemsGeneration = nextGeneration++;
 }
 
-void Level::removeItemFromSpeedPowerUp(SpeedPowerUp const &item) {
-    // Search the item and remove it
-    auto it = std::ranges::find(speedPowerUp, item);
-    if (it != speedPowerUp.end()) {
-        speedPowerUp.erase(it);
-    }
-}
 
-void Level::removeItemFromCoins(Coin const &item) {
-    // Search the item and remove it
-    auto it = std::ranges::find(coins, item);
-    if (it != coins.end()) {
-        coins.erase(it);
+/* METHODS */
+
+/**
+ * @brief Apply the movement of the awake platforms of a collection and update their bounds in its tree.
+ * @param collection The collection of the level.
+ * @param active The awake platforms of the collection.
+ * @param tree The tree indexing the collection.
+ * @param delta_time The time elapsed since the last frame in seconds.
+ */
+template<typename T>
+static void applyActiveMovement(std::vector<T> &collection, const ActiveSet &active, DynamicAABBTree &tree, double delta_time) {
+    for (size_t index: active) {
+        collection[index].savePreviousPosition();
+        collection[index].applyMovement(delta_time);
+        tree.update(index, collection[index].getBoundingBox()); // The leaf only moves in the tree when it leaves its fat box
     }
 }
 
-void Level::removeItem(Item const &item) {
-    // Search the item and remove it
-    for (auto it = items.begin(); it != items.end(); ++it) {
-        if (it != items.end() && *it == &item) {
-            items.erase(it);
-            break; // Found and removed the item, exit the loop
+/**
+ * @brief Record the objects of a collection, the awake ones with their motion during the tick.
+ * @param snapshot The snapshot recording the drawing of the tick.
+ * @param collection The collection of the level.
+ * @param active The awake objects of the collection, the sleeping ones do not move.
+ */
+template<typename T>
+static void renderInterpolated(RenderSnapshot &snapshot, const std::vector<T> &collection, const ActiveSet &active) {
+    for (size_t i = 0; i < collection.size(); i++) {
+        const T &object = collection[i];
+        if (active.contains(i)) {
+            Point previous = object.getPreviousPosition();
+            snapshot.setMotion({object.getX() - previous.x, object.getY() - previous.y});
+            object.render(snapshot);
+            snapshot.setMotion({0, 0});
+        } else {
+            object.render(snapshot);
         }
     }
 }
 
-
-/* METHODS */
-
-void Level::generateAsteroid(int nbAsteroid, Point camera, size_t seed) {
+void Level::generateAsteroid(int nbAsteroid, Point camera) {
     // Loop to generate asteroids until the desired number is reached
     for (auto i = static_cast<int>(asteroids.size()); i < nbAsteroid; i++){
-        // Add a new asteroid to the asteroids vector with coordinates based on the camera position
-        Asteroid new_asteroid(camera.x, camera.y, seed);
-        asteroids.emplace_back(new_asteroid);
+        // Add a new asteroid to the pool with coordinates based on the camera position
+        Asteroid new_asteroid(camera.x, camera.y);
+        asteroids.push(new_asteroid);
+        asteroidsTree.push(new_asteroid.getBoundingBox());
 
         // Send the asteroid throw the network
         if (Mediator::isServerRunning()) {
@@ -237,7 +292,29 @@ void Level::generateAsteroid(int nbAsteroid, Point camera, size_t seed) {
 }
 
 void Level::addAsteroid(Asteroid const &asteroid) {
-    asteroids.emplace_back(asteroid);
+    asteroids.push(asteroid);
+    asteroidsTree.push(asteroid.getBoundingBox());
+}
+
+void Level::refreshActivity(const PlatformLever &lever) {
+    for (const MovingPlatform1D *platform: lever.getMovingPlatforms1D()) {
+        refreshActivity<MovingPlatform1D>(static_cast<size_t>(platform - movingPlatforms1D.data()));
+    }
+    for (const MovingPlatform2D *platform: lever.getMovingPlatforms2D()) {
+        refreshActivity<MovingPlatform2D>(static_cast<size_t>(platform - movingPlatforms2D.data()));
+    }
+}
+
+void Level::refreshActivity(const CrusherLever &lever) {
+    for (const Crusher *crusher: lever.getCrushers()) {
+        refreshActivity<Crusher>(static_cast<size_t>(crusher - crushers.data()));
+    }
+}
+
+void Level::refreshActivity(const TreadmillLever &lever) {
+    for (const Treadmill *treadmill: lever.getTreadmills()) {
+        refreshActivity<Treadmill>(static_cast<size_t>(treadmill - treadmills.data()));
+    }
 }
 
 void Level::togglePlatformsMovement(bool state){
@@ -246,33 +323,44 @@ void Level::togglePlatformsMovement(bool state){
     for (SwitchingPlatform &platform: switchingPlatforms) platform.setIsMoving(state);
     for (WeightPlatform &platform: weightPlatforms) platform.setIsMoving(state);
     for (Treadmill &treadmill: treadmills) treadmill.setIsMoving(state);
+
+    rebuildActiveSet<MovingPlatform1D>();
+    rebuildActiveSet<MovingPlatform2D>();
+    rebuildActiveSet<SwitchingPlatform>();
+    rebuildActiveSet<WeightPlatform>();
+    rebuildActiveSet<Treadmill>();
 }
 
 void Level::toggleCrushersMovement(bool state){
     for (Crusher &crusher: crushers) crusher.setIsMoving(state);
+    rebuildActiveSet<Crusher>();
 }
 
 void Level::applyAsteroidsMovement(double delta_time) {
-    // Apply movement to all players
-    for (Asteroid &asteroid: asteroids) {
-        asteroid.applyMovement(delta_time);
+    // Apply movement to all asteroids, then refit their boxes in the tree
+    asteroids.applyMovement(delta_time);
+    for (size_t i = 0; i < asteroids.size(); i++) {
+        asteroidsTree.update(i, asteroids.getBoundingBox(i));
     }
 }
 
 void Level::applyPlatformsMovement(double delta_time) {
-    for (MovingPlatform1D &platform: movingPlatforms1D) platform.applyMovement(delta_time); // Apply movement for 1D platforms
-    for (MovingPlatform2D &platform: movingPlatforms2D) platform.applyMovement(delta_time); // Apply movement for 2D platforms
-    for (SwitchingPlatform &platform: switchingPlatforms) platform.applyMovement(delta_time); // Apply movement for switching platforms
-    for (WeightPlatform &platform: weightPlatforms) platform.applyMovement(delta_time); // Apply movement for weight platforms
-    for (Treadmill &treadmill: treadmills) treadmill.calculateMovement(delta_time); // Calculate movement for treadmills
+    // Only the awake platforms are simulated, the sleeping ones have been settled when they fell asleep
+    applyActiveMovement(movingPlatforms1D, movingPlatforms1DActive, movingPlatforms1DTree, delta_time); // Apply movement for 1D platforms
+    applyActiveMovement(movingPlatforms2D, movingPlatforms2DActive, movingPlatforms2DTree, delta_time); // Apply movement for 2D platforms
+    applyActiveMovement(switchingPlatforms, switchingPlatformsActive, switchingPlatformsTree, delta_time); // Apply movement for switching platforms
+    applyActiveMovement(weightPlatforms, weightPlatformsActive, weightPlatformsTree, delta_time); // Apply movement for weight platforms
+    for (size_t index: treadmillsActive) treadmills[index].calculateMovement(delta_time); // Calculate movement for treadmills
 }
 
 bool Level::applyTrapsMovement(double delta_time) {
     bool check = false;
 
-    // Apply movement to all crushers
-    for (Crusher &crusher: crushers) {
-        if (crusher.applyMovement(delta_time)) check = true;
+    // Apply movement to the awake crushers
+    for (size_t index: crushersActive) {
+        crushers[index].savePreviousPosition();
+        if (crushers[index].applyMovement(delta_time)) check = true;
+        crushersTree.update(index, crushers[index].getBoundingBox());
     }
 
     return check;
@@ -299,8 +387,8 @@ void Level::renderForegrounds(SDL_Renderer *renderer, const Point camera) const
 void Level::renderPolygonsDebug(SDL_Renderer *renderer, Point camera) const {
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
     for (const Polygon &obstacle: collisionZones) {
-        for (size_t i = 0; i < obstacle.getVertices().size(); ++i) {
-            std::vector<Point> vertices = obstacle.getVertices();
+        const std::vector<Point> &vertices = obstacle.getVertices();
+        for (size_t i = 0; i < vertices.size(); ++i) {
             const auto &vertex1 = vertices[i];
             const auto &vertex2 = vertices[(i + 1) % vertices.size()];
             SDL_RenderDrawLineF(renderer, vertex1.x - camera.x, vertex1.y - camera.y, vertex2.x - camera.x, vertex2.y - camera.y);
@@ -309,8 +397,8 @@ void Level::renderPolygonsDebug(SDL_Renderer *renderer, Point camera) const {
 
     SDL_SetRenderDrawColor(renderer, 255, 25, 25, 255);
     for (const Polygon &obstacle: deathZones) {
-        for (size_t i = 0; i < obstacle.getVertices().size(); ++i) {
-            std::vector<Point> vertices = obstacle.getVertices();
+        const std::vector<Point> &vertices = obstacle.getVertices();
+        for (size_t i = 0; i < vertices.size(); ++i) {
             const auto &vertex1 = vertices[i];
             const auto &vertex2 = vertices[(i + 1) % vertices.size()];
             SDL_RenderDrawLineF(renderer, vertex1.x - camera.x, vertex1.y - camera.y, vertex2.x - camera.x, vertex2.y - camera.y);
@@ -346,73 +434,69 @@ void Level::renderPolygonsDebug(SDL_Renderer *renderer, Point camera) const {
     }
 }
 
-void Level::renderAsteroids(SDL_Renderer *renderer, Point camera) {
-    for (Asteroid &asteroid : asteroids) {
-        asteroid.render(renderer, camera);
-    }
+void Level::renderAsteroids(RenderSnapshot &snapshot) {
+    asteroids.render(snapshot);
 }
 
-void Level::renderAsteroidsDebug(SDL_Renderer *renderer, Point camera) const {
-    for (Asteroid const &asteroid : asteroids) {
-        asteroid.renderDebug(renderer, camera);
-    }
+void Level::renderAsteroidsDebug(RenderSnapshot &snapshot) const {
+    asteroids.renderDebug(snapshot);
 }
 
-void Level::renderLevers(SDL_Renderer *renderer, Point camera) const {
-    for (const TreadmillLever &lever : treadmillLevers) lever.render(renderer, camera);
-    for (const PlatformLever &lever : platformLevers) lever.render(renderer, camera);
-    for (const CrusherLever &lever : crusherLevers) lever.render(renderer, camera);
+void Level::renderLevers(RenderSnapshot &snapshot) const {
+    for (const TreadmillLever &lever : treadmillLevers) lever.render(snapshot);
+    for (const PlatformLever &lever : platformLevers) lever.render(snapshot);
+    for (const CrusherLever &lever : crusherLevers) lever.render(snapshot);
 }
 
-void Level::renderLeversDebug(SDL_Renderer *renderer, Point camera) const {
-    for (const TreadmillLever &lever : treadmillLevers) lever.renderDebug(renderer, camera);
-    for (const PlatformLever &lever : platformLevers) lever.renderDebug(renderer, camera);
-    for (const CrusherLever &lever : crusherLevers) lever.renderDebug(renderer, camera);
+void Level::renderLeversDebug(RenderSnapshot &snapshot) const {
+    for (const TreadmillLever &lever : treadmillLevers) lever.renderDebug(snapshot);
+    for (const PlatformLever &lever : platformLevers) lever.renderDebug(snapshot);
+    for (const CrusherLever &lever : crusherLevers) lever.renderDebug(snapshot);
 }
 
-void Level::renderPlatforms(SDL_Renderer *renderer, Point camera) {
-    for (const MovingPlatform1D &platform: movingPlatforms1D) platform.render(renderer, camera);
-    for (const MovingPlatform2D &platform: movingPlatforms2D) platform.render(renderer, camera);
-    for (const SwitchingPlatform &platform: switchingPlatforms) platform.render(renderer, camera);
-    for (const WeightPlatform &platform: weightPlatforms) platform.render(renderer, camera);
-    for (Treadmill &treadmill: treadmills) treadmill.render(renderer, camera);
+void Level::renderPlatforms(RenderSnapshot &snapshot) {
+    renderInterpolated(snapshot, movingPlatforms1D, movingPlatforms1DActive);
+    renderInterpolated(snapshot, movingPlatforms2D, movingPlatforms2DActive);
+    renderInterpolated(snapshot, switchingPlatforms, switchingPlatformsActive);
+    renderInterpolated(snapshot, weightPlatforms, weightPlatformsActive);
+    for (Treadmill &treadmill: treadmills) treadmill.render(snapshot); // Treadmills never move
 }
 
-void Level::renderPlatformsDebug(SDL_Renderer *renderer, Point camera) const {
-    for (const MovingPlatform1D &platform: movingPlatforms1D) platform.renderDebug(renderer, camera);
-    for (const MovingPlatform2D &platform: movingPlatforms2D) platform.renderDebug(renderer, camera);
-    for (const SwitchingPlatform &platform: switchingPlatforms) platform.renderDebug(renderer, camera);
-    for (const WeightPlatform &platform: weightPlatforms) platform.renderDebug(renderer, camera);
-    for (const Treadmill &treadmill: treadmills) treadmill.renderDebug(renderer, camera);
+void Level::renderPlatformsDebug(RenderSnapshot &snapshot) const {
+    for (const MovingPlatform1D &platform: movingPlatforms1D) platform.renderDebug(snapshot);
+    for (const MovingPlatform2D &platform: movingPlatforms2D) platform.renderDebug(snapshot);
+    for (const SwitchingPlatform &platform: switchingPlatforms) platform.renderDebug(snapshot);
+    for (const WeightPlatform &platform: weightPlatforms) platform.renderDebug(snapshot);
+    for (const Treadmill &treadmill: treadmills) treadmill.renderDebug(snapshot);
 
 }
 
-void Level::renderTraps(SDL_Renderer *renderer, Point camera) const {
-    for (const Crusher &crusher: crushers) crusher.render(renderer, camera); // Draw the crushers
+void Level::renderTraps(RenderSnapshot &snapshot) const {
+    renderInterpolated(snapshot, crushers, crushersActive); // Draw the crushers
 }
 
-void Level::renderTrapsDebug(SDL_Renderer *renderer, Point camera) const {
-    for (const Crusher &crusher: crushers) crusher.renderDebug(renderer, camera); // Draw the crushers
+void Level::renderTrapsDebug(RenderSnapshot &snapshot) const {
+    for (const Crusher &crusher: crushers) crusher.renderDebug(snapshot); // Draw the crushers
 }
 
-void Level::renderItems(SDL_Renderer *renderer, Point camera) {
-    SDL_SetRenderDrawColor(renderer, 0, 255, 120, 255);
+void Level::renderItems(RenderSnapshot &snapshot) {
+    snapshot.setDrawColor(0, 255, 120, 255);
     for (const Item* item : items) {
-        item->renderDebug(renderer, camera);
+        item->renderDebug(snapshot);
     }
 
-    for (Coin &item : coins) item.render(renderer, camera); // Draw the coins
+    for (Coin &item : coins) item.render(snapshot); // Draw the coins
 }
 
-void Level::renderItemsDebug(SDL_Renderer *renderer, Point camera) const {
-    SDL_SetRenderDrawColor(renderer, 0, 255, 120, 255);
+void Level::renderItemsDebug(RenderSnapshot &snapshot) const {
+    snapshot.setDrawColor(0, 255, 120, 255);
     for (const Item* item : items) {
-        item->renderDebug(renderer, camera);
+        item->renderDebug(snapshot);
     }
 
     // Draw the coins
-    SDL_SetRenderDrawColor(renderer, 255, 255, 64, 255);
-    for (const Coin &item : coins) item.renderDebug(renderer, camera);
+    snapshot.setDrawColor(255, 255, 64, 255);
+    for (const Coin &item : coins) item.renderDebug(snapshot);
 
 }
 
@@ -705,7 +789,7 @@ void Level::loadLeversFromMap(const std::string &map_file_name) {
 
     // Load all treadmill levers
     for (const auto &lever : j["treadmillLevers"]) {
-        auto texture = Texture(textureManagerPtr->getLever());
+        Texture texture = textureManagerPtr->getLever();
         float x = lever["x"];
         float y = lever["y"];
         float size = lever["size"];
@@ -720,7 +804,7 @@ void Level::loadLeversFromMap(const std::string &map_file_name) {
 
     // Load all platform levers
     for (const auto &lever : j["platformLevers"]) {
-        auto texture = Texture(textureManagerPtr->getLever());
+        Texture texture = textureManagerPtr->getLever();
         float x = lever["x"];
         float y = lever["y"];
         float size = lever["size"];
@@ -738,7 +822,7 @@ void Level::loadLeversFromMap(const std::string &map_file_name) {
 
     // Load all crusher levers
     for (const auto &lever : j["crusherLevers"]) {
-        auto texture = Texture(textureManagerPtr->getLever());
+        Texture texture = textureManagerPtr->getLever();
         float x = lever["x"];
         float y = lever["y"];
         float size = lever["size"];
@@ -806,4 +890,80 @@ void Level::loadItemsFromMap(const std::string &mapFileName) {
 
     std::cout << "Level: Loaded " << items.size() << " items." << std::endl;
     std::cout << "Level: Loaded " << coins.size() << " coins." << std::endl;
-}
\ No newline at end of file
+}
+
+void Level::buildSpatialIndex() {
+    collisionZonesGrid.clear();
+    deathZonesGrid.clear();
+    saveZonesGrid.clear();
+    rescueZonesGrid.clear();
+    toggleGravityZonesGrid.clear();
+    increaseFallSpeedZonesGrid.clear();
+    treadmillLeversGrid.clear();
+    platformLeversGrid.clear();
+    crusherLeversGrid.clear();
+
+    // Index the polygons with their bounding box
+    for (size_t i = 0; i < collisionZones.size(); i++) collisionZonesGrid.insert(i, collisionZones[i].getBoundingBox());
+    for (size_t i = 0; i < deathZones.size(); i++) deathZonesGrid.insert(i, deathZones[i].getBoundingBox());
+
+    // Index the AABBs
+    for (size_t i = 0; i < saveZones.size(); i++) saveZonesGrid.insert(i, saveZones[i].getRect());
+    for (size_t i = 0; i < rescueZones.size(); i++) rescueZonesGrid.insert(i, rescueZones[i].getRect());
+    for (size_t i = 0; i < toggleGravityZones.size(); i++) toggleGravityZonesGrid.insert(i, toggleGravityZones[i].getRect());
+    for (size_t i = 0; i < increaseFallSpeedZones.size(); i++) increaseFallSpeedZonesGrid.insert(i, increaseFallSpeedZones[i].getRect());
+
+    // Index the levers (they never move)
+    for (size_t i = 0; i < treadmillLevers.size(); i++) treadmillLeversGrid.insert(i, treadmillLevers[i].getBoundingBox());
+    for (size_t i = 0; i < platformLevers.size(); i++) platformLeversGrid.insert(i, platformLevers[i].getBoundingBox());
+    for (size_t i = 0; i < crusherLevers.size(); i++) crusherLeversGrid.insert(i, crusherLevers[i].getBoundingBox());
+
+    std::cout << "Level: Spatial index built (" << collisionZonesGrid.getCount() << " collision zones, " << deathZonesGrid.getCount() << " death zones, " << treadmillLeversGrid.getCount() + platformLeversGrid.getCount() + crusherLeversGrid.getCount() << " levers)." << std::endl;
+}
+
+void Level::buildDynamicIndex() {
+    movingPlatforms1DTree.clear();
+    movingPlatforms2DTree.clear();
+    switchingPlatformsTree.clear();
+    weightPlatformsTree.clear();
+    crushersTree.clear();
+    treadmillsTree.clear();
+    asteroidsTree.clear();
+
+    // Index the moving objects, they are hidden until the broad phase finds them in its area
+    for (MovingPlatform1D &platform: movingPlatforms1D) {
+        movingPlatforms1DTree.push(platform.getBoundingBox());
+        platform.setIsOnScreen(false);
+    }
+    for (MovingPlatform2D &platform: movingPlatforms2D) {
+        movingPlatforms2DTree.push(platform.getBoundingBox());
+        platform.setIsOnScreen(false);
+    }
+    for (SwitchingPlatform &platform: switchingPlatforms) {
+        switchingPlatformsTree.push(platform.getBoundingBox());
+        platform.setIsOnScreen(false);
+    }
+    for (WeightPlatform &platform: weightPlatforms) {
+        weightPlatformsTree.push(platform.getBoundingBox());
+        platform.setIsOnScreen(false);
+    }
+    for (Crusher &crusher: crushers) {
+        crushersTree.push(crusher.getBoundingBox());
+        crusher.setIsOnScreen(false);
+    }
+    for (Treadmill &treadmill: treadmills) {
+        treadmillsTree.push(treadmill.getBoundingBox());
+        treadmill.setIsOnScreen(false);
+    }
+    for (size_t i = 0; i < asteroids.size(); i++) asteroidsTree.push(asteroids.getBoundingBox(i));
+
+    // Every hidden object sleeps, only the moving switching platforms start awake
+    rebuildActiveSet<MovingPlatform1D>();
+    rebuildActiveSet<MovingPlatform2D>();
+    rebuildActiveSet<SwitchingPlatform>();
+    rebuildActiveSet<WeightPlatform>();
+    rebuildActiveSet<Treadmill>();
+    rebuildActiveSet<Crusher>();
+
+    std::cout << "Level: Dynamic index built (" << movingPlatforms1DTree.size() + movingPlatforms2DTree.size() + switchingPlatformsTree.size() + weightPlatformsTree.size() << " platforms, " << crushersTree.size() << " crushers)." << std::endl;
+}
@@ -13,6 +13,13 @@ CrusherLever::CrusherLever(float x, float y, float size, bool is_activated, cons
 
 
 
+/* ACCESSORS */
+
+const std::vector<Crusher*> &CrusherLever::getCrushers() const {
+    return crushers;
+}
+
+
 /* METHODS */
 
 void CrusherLever::applyEffect() const {
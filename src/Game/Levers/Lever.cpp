@@ -81,19 +81,19 @@ bool Lever::operator==(const Lever &item) const {
            && h == item.getH();
 }
 
-void Lever::render(SDL_Renderer *renderer, Point camera) const {
+void Lever::render(RenderSnapshot &snapshot) const {
     if (isOnScreen) {
         SDL_Rect src_rect = texture.getSize();
-        SDL_FRect platform_rect = {x - camera.x - textureOffsets.x, y - camera.y - textureOffsets.y,
+        SDL_FRect platform_rect = {x - textureOffsets.x, y - textureOffsets.y,
                                    w + textureOffsets.w, h + textureOffsets.h};
-        SDL_RenderCopyExF(renderer, texture.getTexture(), &src_rect, &platform_rect, 0.0, nullptr, texture.getFlip());
+        snapshot.copy(texture.getTexture(), src_rect, platform_rect, 0.0, texture.getFlip());
     }
 }
 
-void Lever::renderDebug(SDL_Renderer *renderer, Point camera) const {
+void Lever::renderDebug(RenderSnapshot &snapshot) const {
     if (isOnScreen) {
-        SDL_SetRenderDrawColor(renderer, 102, 51, 0, 255);
-        SDL_FRect platform_rect = {x - camera.x, y - camera.y, w, h};
-        SDL_RenderFillRectF(renderer, &platform_rect);
+        snapshot.setDrawColor(102, 51, 0, 255);
+        SDL_FRect platform_rect = {x, y, w, h};
+        snapshot.fillRect(platform_rect);
     }
 }
\ No newline at end of file
@@ -12,6 +12,17 @@ PlatformLever::PlatformLever(float x, float y, float size, bool is_activated, co
         : Lever(x, y, size, is_activated, texture), movingPlatform1D(platforms1D), movingPlatform2D(platforms2D) {};
 
 
+/* ACCESSORS */
+
+const std::vector<MovingPlatform1D*> &PlatformLever::getMovingPlatforms1D() const {
+    return movingPlatform1D;
+}
+
+const std::vector<MovingPlatform2D*> &PlatformLever::getMovingPlatforms2D() const {
+    return movingPlatform2D;
+}
+
+
 /* METHODS */
 
 void PlatformLever::applyEffect() const {
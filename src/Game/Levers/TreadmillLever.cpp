@@ -12,6 +12,13 @@ TreadmillLever::TreadmillLever(float x, float y, float size, bool is_activated,
         : Lever(x, y, size, is_activated, texture), type(type), treadmills(treadmills) {};
 
 
+/* ACCESSORS */
+
+const std::vector<Treadmill*> &TreadmillLever::getTreadmills() const {
+    return treadmills;
+}
+
+
 /* METHODS */
 
 void TreadmillLever::applyEffect() const {
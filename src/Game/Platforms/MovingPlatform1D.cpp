@@ -39,6 +39,10 @@ float MovingPlatform1D::getY() const {
     return y;
 }
 
+Point MovingPlatform1D::getPreviousPosition() const {
+    return previousPosition;
+}
+
 float MovingPlatform1D::getW() const {
     return w;
 }
@@ -63,6 +67,10 @@ bool MovingPlatform1D::getIsMoving() const {
     return isMoving;
 }
 
+bool MovingPlatform1D::getIsOnScreen() const {
+    return isOnScreen;
+}
+
 SDL_FRect MovingPlatform1D::getBoundingBox() const {
     return {x, y, w, h};
 }
@@ -101,6 +109,10 @@ void MovingPlatform1D::setIsOnScreen(bool state) {
 
 /* METHODS */
 
+void MovingPlatform1D::savePreviousPosition() {
+    previousPosition = {x, y};
+}
+
 void MovingPlatform1D::applyXaxisMovement(double delta_time) {
     move = 150; // Add basic movement
     move *= static_cast<float>(delta_time); // Apply movement per second
@@ -172,18 +184,18 @@ void MovingPlatform1D::applyMovement(double delta_time) {
     } else move = 0;
 }
 
-void MovingPlatform1D::render(SDL_Renderer *renderer, Point camera) const {
+void MovingPlatform1D::render(RenderSnapshot &snapshot) const {
     if (isOnScreen) {
         SDL_Rect src_rect = texture.getSize();
-        SDL_FRect platform_rect = {x - camera.x - textureOffsets.x, y - camera.y - textureOffsets.y,w + textureOffsets.w, h + textureOffsets.h};
-        SDL_RenderCopyExF(renderer, texture.getTexture(), &src_rect, &platform_rect, 0.0, nullptr, texture.getFlip());
+        SDL_FRect platform_rect = {x - textureOffsets.x, y - textureOffsets.y,w + textureOffsets.w, h + textureOffsets.h};
+        snapshot.copy(texture.getTexture(), src_rect, platform_rect, 0.0, texture.getFlip());
     }
 }
 
-void MovingPlatform1D::renderDebug(SDL_Renderer *renderer, Point camera) const {
+void MovingPlatform1D::renderDebug(RenderSnapshot &snapshot) const {
     if (isOnScreen) {
-        SDL_SetRenderDrawColor(renderer, 145, 0, 145, 255);
-        SDL_FRect platform_rect = {x - camera.x, y - camera.y, w, h};
-        SDL_RenderFillRectF(renderer, &platform_rect);
+        snapshot.setDrawColor(145, 0, 145, 255);
+        SDL_FRect platform_rect = {x, y, w, h};
+        snapshot.fillRect(platform_rect);
     }
 }
\ No newline at end of file
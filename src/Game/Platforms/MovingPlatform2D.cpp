@@ -45,6 +45,10 @@ float MovingPlatform2D::getY() const {
     return y;
 }
 
+Point MovingPlatform2D::getPreviousPosition() const {
+    return previousPosition;
+}
+
 float MovingPlatform2D::getW() const {
     return w;
 }
@@ -73,6 +77,10 @@ bool MovingPlatform2D::getIsMoving() const {
     return isMoving;
 }
 
+bool MovingPlatform2D::getIsOnScreen() const {
+    return isOnScreen;
+}
+
 SDL_FRect MovingPlatform2D::getBoundingBox() const {
     return {x, y, w, h};
 }
@@ -119,6 +127,10 @@ void MovingPlatform2D::setIsOnScreen(bool state) {
 
 /* METHODS */
 
+void MovingPlatform2D::savePreviousPosition() {
+    previousPosition = {x, y};
+}
+
 void MovingPlatform2D::applyMovement(double delta_time) {
     if (isMoving && isOnScreen) {
         // Add basic movement
@@ -181,18 +193,18 @@ void MovingPlatform2D::applyMovement(double delta_time) {
     }
 }
 
-void MovingPlatform2D::render(SDL_Renderer *renderer, Point camera) const {
+void MovingPlatform2D::render(RenderSnapshot &snapshot) const {
     if (isOnScreen) {
         SDL_Rect src_rect = texture.getSize();
-        SDL_FRect platform_rect = {x - camera.x - textureOffsets.x, y - camera.y - textureOffsets.y,w + textureOffsets.w, h + textureOffsets.h};
-        SDL_RenderCopyExF(renderer, texture.getTexture(), &src_rect, &platform_rect, 0.0, nullptr, texture.getFlip());
+        SDL_FRect platform_rect = {x - textureOffsets.x, y - textureOffsets.y,w + textureOffsets.w, h + textureOffsets.h};
+        snapshot.copy(texture.getTexture(), src_rect, platform_rect, 0.0, texture.getFlip());
     }
 }
 
-void MovingPlatform2D::renderDebug(SDL_Renderer *renderer, Point camera) const {
+void MovingPlatform2D::renderDebug(RenderSnapshot &snapshot) const {
     if (isOnScreen) {
-        SDL_SetRenderDrawColor(renderer, 145, 0, 145, 255);
-        SDL_FRect platform_rect = {x - camera.x, y - camera.y, w, h};
-        SDL_RenderFillRectF(renderer, &platform_rect);
+        snapshot.setDrawColor(145, 0, 145, 255);
+        SDL_FRect platform_rect = {x, y, w, h};
+        snapshot.fillRect(platform_rect);
     }
 }
\ No newline at end of file
@@ -28,6 +28,10 @@ float SwitchingPlatform::getY() const {
     return y;
 }
 
+Point SwitchingPlatform::getPreviousPosition() const {
+    return previousPosition;
+}
+
 float SwitchingPlatform::getW() const {
     return w;
 }
@@ -40,6 +44,10 @@ bool SwitchingPlatform::getIsMoving() const {
     return isMoving;
 }
 
+bool SwitchingPlatform::getIsOnScreen() const {
+    return isOnScreen;
+}
+
 SDL_FRect SwitchingPlatform::getBoundingBox() const {
     return {x, y, w, h};
 }
@@ -58,9 +66,13 @@ void SwitchingPlatform::setIsOnScreen(bool state) {
 
 /* METHODS */
 
+void SwitchingPlatform::savePreviousPosition() {
+    previousPosition = {x, y};
+}
+
 void SwitchingPlatform::applyMovement([[maybe_unused]] double delta_time) {
     if (isMoving) {
-        Uint32 currentTime = SDL_GetTicks(); // Get the current time
+        Uint32 currentTime = SimulationClock::getTicks(); // Get the current time
 
         // Check if a beat has passed
         if (currentTime - startTime > (60000 / bpm)) {
@@ -75,18 +87,18 @@ void SwitchingPlatform::applyMovement([[maybe_unused]] double delta_time) {
     }
 }
 
-void SwitchingPlatform::render(SDL_Renderer *renderer, Point camera) const {
+void SwitchingPlatform::render(RenderSnapshot &snapshot) const {
     if (isOnScreen) {
         SDL_Rect src_rect = texture.getSize();
-        SDL_FRect platform_rect = {x - camera.x - textureOffsets.x, y - camera.y - textureOffsets.y,w + textureOffsets.w, h + textureOffsets.h};
-        SDL_RenderCopyExF(renderer, texture.getTexture(), &src_rect, &platform_rect, 0.0, nullptr, texture.getFlip());
+        SDL_FRect platform_rect = {x - textureOffsets.x, y - textureOffsets.y,w + textureOffsets.w, h + textureOffsets.h};
+        snapshot.copy(texture.getTexture(), src_rect, platform_rect, 0.0, texture.getFlip());
     }
 }
 
-void SwitchingPlatform::renderDebug(SDL_Renderer *renderer, Point camera) const {
+void SwitchingPlatform::renderDebug(RenderSnapshot &snapshot) const {
     if (isOnScreen) {
-        SDL_SetRenderDrawColor(renderer, 145, 0, 145, 255);
-        SDL_FRect platform_rect = {x - camera.x, y - camera.y, w, h};
-        SDL_RenderFillRectF(renderer, &platform_rect);
+        snapshot.setDrawColor(145, 0, 145, 255);
+        SDL_FRect platform_rect = {x, y, w, h};
+        snapshot.fillRect(platform_rect);
     }
 }
\ No newline at end of file
@@ -18,7 +18,7 @@ Treadmill::Treadmill(float x, float y, float size, float speed, float direction,
                     : x(x), y(y), size(size), speed(speed), direction(direction), spriteSpeed(spriteSpeed) {
     w = static_cast<float>(SPRITE_WIDTH) * size;
     h = static_cast<float>(SPRITE_HEIGHT) * size;
-    sprite = Sprite(*spriteTexturePtr, direction > 0 ? right : left, SPRITE_WIDTH, SPRITE_HEIGHT);
+    sprite = Sprite(spriteTexturePtr, direction > 0 ? right : left, SPRITE_WIDTH, SPRITE_HEIGHT);
 }
 
 
@@ -56,6 +56,10 @@ bool Treadmill::getIsMoving() const {
     return isMoving;
 }
 
+bool Treadmill::getIsOnScreen() const {
+    return isOnScreen;
+}
+
 SDL_FRect Treadmill::getBoundingBox() const {
     return {x, y, w, h};
 }
@@ -80,14 +84,12 @@ void Treadmill::setIsOnScreen(bool state) {
     isOnScreen = state;
 }
 
-void Treadmill::setTexture(SDL_Texture *texturePtr) {
-    spriteTexturePtr = texturePtr;
+void Treadmill::setTexture(const Texture &texture) {
+    spriteTexturePtr = texture.getTexture();
 
-    int w;
-    int h;
-    SDL_QueryTexture(spriteTexturePtr, nullptr, nullptr, &w, &h);
-    SPRITE_WIDTH = w / FRAME_NUMBER;
-    SPRITE_HEIGHT = h / 2;
+    SDL_Rect size = texture.getSize();
+    SPRITE_WIDTH = size.w / FRAME_NUMBER;
+    SPRITE_HEIGHT = size.h / 2;
 }
 
 /* METHODS */
@@ -104,19 +106,19 @@ void Treadmill::calculateMovement(double delta_time) {
 
 }
 
-void Treadmill::render(SDL_Renderer *renderer, Point camera) {
+void Treadmill::render(RenderSnapshot &snapshot) {
     if (isOnScreen) {
         if (isMoving) sprite.updateAnimation();
         SDL_Rect srcRect = sprite.getSrcRect();
-        SDL_FRect treadmill_rect = {x - camera.x, y - camera.y, w, h};
-        SDL_RenderCopyExF(renderer, sprite.getTexture(), &srcRect, &treadmill_rect, 0.0, nullptr, sprite.getFlip());
+        SDL_FRect treadmill_rect = {x, y, w, h};
+        snapshot.copy(sprite.getTexture(), srcRect, treadmill_rect, 0.0, sprite.getFlip());
     }
 }
 
-void Treadmill::renderDebug(SDL_Renderer *renderer, Point camera) const {
+void Treadmill::renderDebug(RenderSnapshot &snapshot) const {
     if (isOnScreen) {
-        SDL_SetRenderDrawColor(renderer, 154, 153, 150, 255);
-        SDL_FRect platform_rect = {x - camera.x, y - camera.y, w, h};
-        SDL_RenderFillRectF(renderer, &platform_rect);
+        snapshot.setDrawColor(154, 153, 150, 255);
+        SDL_FRect platform_rect = {x, y, w, h};
+        snapshot.fillRect(platform_rect);
     }
 }
\ No newline at end of file
@@ -28,6 +28,10 @@ float WeightPlatform::getY() const {
     return y;
 }
 
+Point WeightPlatform::getPreviousPosition() const {
+    return previousPosition;
+}
+
 float WeightPlatform::getW() const {
     return w;
 }
@@ -44,6 +48,10 @@ bool WeightPlatform::getIsMoving() const {
     return isMoving;
 }
 
+bool WeightPlatform::getIsOnScreen() const {
+    return isOnScreen;
+}
+
 SDL_FRect WeightPlatform::getBoundingBox() const {
     return {x, y, w, h};
 }
@@ -70,6 +78,10 @@ void WeightPlatform::decreaseWeight() {
 
 /* METHODS */
 
+void WeightPlatform::savePreviousPosition() {
+    previousPosition = {x, y};
+}
+
 void WeightPlatform::applyMovement(double delta_time) {
     if (isMoving && isOnScreen) {
         auto blend = static_cast<float>(1.0f - std::pow(0.5F, delta_time * lerpSmoothingFactor));
@@ -80,18 +92,18 @@ void WeightPlatform::applyMovement(double delta_time) {
     }
 }
 
-void WeightPlatform::render(SDL_Renderer *renderer, Point camera) const {
+void WeightPlatform::render(RenderSnapshot &snapshot) const {
     if (isOnScreen) {
         SDL_Rect src_rect = texture.getSize();
-        SDL_FRect platform_rect = {x - camera.x - textureOffsets.x, y - camera.y - textureOffsets.y,w + textureOffsets.w, h + textureOffsets.h};
-        SDL_RenderCopyExF(renderer, texture.getTexture(), &src_rect, &platform_rect, 0.0, nullptr, texture.getFlip());
+        SDL_FRect platform_rect = {x - textureOffsets.x, y - textureOffsets.y,w + textureOffsets.w, h + textureOffsets.h};
+        snapshot.copy(texture.getTexture(), src_rect, platform_rect, 0.0, texture.getFlip());
     }
 }
 
-void WeightPlatform::renderDebug(SDL_Renderer *renderer, Point camera) const {
+void WeightPlatform::renderDebug(RenderSnapshot &snapshot) const {
     if (isOnScreen) {
-        SDL_SetRenderDrawColor(renderer, 145, 0, 145, 255);
-        SDL_FRect platform_rect = {x - camera.x, y - camera.y, w, h};
-        SDL_RenderFillRectF(renderer, &platform_rect);
+        snapshot.setDrawColor(145, 0, 145, 255);
+        SDL_FRect platform_rect = {x, y, w, h};
+        snapshot.fillRect(platform_rect);
     }
 }
\ No newline at end of file
@@ -24,7 +24,7 @@ SDL_Texture *Player::spriteTexture4MedalPtr = nullptr;
 Player::Player(int playerID, Point spawnPoint, float size)
         : playerID(playerID), x(spawnPoint.x), y(spawnPoint.y), size(size) {
 
-    sprite = Sprite(*baseSpriteTexturePtr, Player::idle, BASE_SPRITE_WIDTH, BASE_SPRITE_HEIGHT);
+    sprite = Sprite(baseSpriteTexturePtr, Player::idle, BASE_SPRITE_WIDTH, BASE_SPRITE_HEIGHT);
     setSpriteTextureByID(playerID);
 }
 
@@ -47,6 +47,10 @@ float Player::getY() const {
     return y;
 }
 
+Point Player::getPreviousPosition() const {
+    return previousPosition;
+}
+
 float Player::getW() const {
     return width;
 }
@@ -84,6 +88,10 @@ float Player::getMoveY() const {
     return moveY;
 }
 
+Buffer Player::getBuffer() const {
+    return buffer;
+}
+
 int Player::getDirectionX() const {
     return (int)directionX;
 }
@@ -120,8 +128,8 @@ bool Player::getIsJumping() const {
     return isJumping;
 }
 
-size_t Player::getCurrentZoneID() const {
-    return currentZoneID;
+TriggerSet &Player::getTriggers() {
+    return triggers;
 }
 
 bool Player::getIsOnPlatform() const {
@@ -138,84 +146,84 @@ bool Player::getIsHitting() const {
 
 /* SPECIFIC ACCESSORS */
 
-std::vector<Point> Player::getVertices() const {
+Quad Player::getVertices() const {
     // Return the vertices of the player's bounding box.
-    return {
+    return {{
             {x, y},
             {x + width, y},
             {x + width, y + height},
             {x, y + height}
-    };
+    }};
 }
 
-std::vector<Point> Player::getVerticesNextFrame() const {
-    return {
+Quad Player::getVerticesNextFrame() const {
+    return {{
             {x + moveX, y + moveY},
             {x + moveX + width, y + moveY},
             {x + moveX + width, y + moveY + height},
             {x + moveX, y + moveY + height}
-    };
+    }};
 }
 
-std::vector<Point> Player::getHorizontalColliderVertices() const {
+Quad Player::getHorizontalColliderVertices() const {
     return directionX == PLAYER_LEFT ? getLeftColliderVertices() : getRightColliderVertices();
 }
 
-std::vector<Point> Player::getLeftColliderVertices() const {
-    return {
+Quad Player::getLeftColliderVertices() const {
+    return {{
             {x - 1,y},
             {x, y},
             {x, y + height},
             {x - 1,y + height}
-    };
+    }};
 }
 
-std::vector<Point> Player::getRightColliderVertices() const {
-    return {
+Quad Player::getRightColliderVertices() const {
+    return {{
             {x + width + 1, y},
             {x + width, y},
             {x + width, y + height},
             {x + width + 1, y + height}
-    };
+    }};
 }
 
-std::vector<Point> Player::getGroundColliderVertices() const {
-    if (mavity > 0) return {
+Quad Player::getGroundColliderVertices() const {
+    if (mavity > 0) return {{
             {x, y + height},
             {x + width, y + height},
             {x + width, y + height + 1},
             {x, y + height + 1}
-    };
-    else return {
+    }};
+    else return {{
                 {x, y - 1},
                 {x + width, y - 1},
                 {x + width, y},
                 {x, y}
-        };
+        }};
 }
 
-std::vector<Point> Player::getRoofColliderVertices() const {
-    if (mavity > 0) return {
+Quad Player::getRoofColliderVertices() const {
+    if (mavity > 0) return {{
             {x, y - 1},
             {x + width, y - 1},
             {x + width, y},
             {x, y}
-    };
-    else return {
+    }};
+    else return {{
                 {x, y + height},
                 {x + width, y + height},
                 {x + width, y + height + 1},
                 {x, y + height + 1}
-        };
+        }};
 }
 
-std::vector<Point> Player::getHitZoneVertices() const {
-    return {
+Quad Player::getHitZoneVertices() const {
+    return {{
             {x + hitZone.x, y + hitZone.y},
             {x + hitZone.x + hitZone.w, y + hitZone.y},
             {x + hitZone.x + hitZone.w, y + hitZone.y + hitZone.h},
             {x + hitZone.x, y + hitZone.y + hitZone.h}
-    };
+    }};
 }
 
 SDL_FRect Player::getHorizontalColliderBoundingBox() const {
@@ -248,6 +256,10 @@ SDL_FRect Player::getBoundingBox() const {
     return {x, y, width, height};
 }
 
+SDL_FRect Player::getBoundingBoxPreviousMove() const {
+    return {x - moveX, y - moveY, width, height};
+}
+
 SDL_FRect Player::getBoundingBoxNextFrame() const {
     return {x + moveX, y + moveY, width, height};
 }
@@ -330,7 +342,7 @@ void Player::setSprint(bool state) {
 void Player::setIsGrounded(bool state) {
     isGrounded = state;
     if (state) {
-        lastTimeOnPlatform = SDL_GetTicks();
+        lastTimeOnPlatform = SimulationClock::getTicks();
     }
 }
 
@@ -362,10 +374,6 @@ void Player::setSpriteID(short id) {
     SpriteID = id;
 }
 
-void Player::setCurrentZoneID(size_t id) {
-    currentZoneID = id;
-}
-
 void Player::setMaxFallSpeed(float val) {
     maxFallSpeed = val;
 }
@@ -410,6 +418,10 @@ void Player::setMedalTexture(SDL_Texture* newTexture) {
 
 /* METHODS */
 
+void Player::savePreviousPosition() {
+    previousPosition = {x, y};
+}
+
 bool Player::loadTextures(SDL_Renderer &renderer) {
     // Load players' sprite texture
     baseSpriteTexturePtr = IMG_LoadTexture(&renderer, "assets/sprites/players/player.png");
@@ -439,43 +451,43 @@ bool Player::loadTextures(SDL_Renderer &renderer) {
 }
 
 void Player::useDefaultTexture() {
-    sprite.setTexture(*defaultTexture);
+    sprite.setTexture(defaultTexture);
 }
 void Player::useMedalTexture(){
-    sprite.setTexture(*medalTexture);
+    sprite.setTexture(medalTexture);
 }
 
 void Player::setSpriteTextureByID(int id) {
     if (id == 1){ // Texture 1
-        sprite.setTexture(*spriteTexture1Ptr);
+        sprite.setTexture(spriteTexture1Ptr);
         defaultTexture = spriteTexture1Ptr;
         medalTexture = spriteTexture1MedalPtr;
         baseNormalOffsets = {4, 4, 5, 3};
         baseRunOffsets = {6, 7, 0, 3};
     }
     else if (id == 2){ // Texture 2
-        sprite.setTexture(*spriteTexture2Ptr);
+        sprite.setTexture(spriteTexture2Ptr);
         defaultTexture = spriteTexture2Ptr;
         medalTexture = spriteTexture2MedalPtr;
         baseNormalOffsets = {6, 4, 3, 3};
         baseRunOffsets = {6, 7, 0, 3};
     }
     else if (id == 3) { // Texture 3
-        sprite.setTexture(*spriteTexture3Ptr);
+        sprite.setTexture(spriteTexture3Ptr);
         defaultTexture = spriteTexture3Ptr;
         medalTexture = spriteTexture3MedalPtr;
         baseNormalOffsets = {4, 4, 5, 3};
         baseRunOffsets = {6, 7, 0, 3};
     }
     else if (id == 4) { // Texture 4
-        sprite.setTexture(*spriteTexture4Ptr);
+        sprite.setTexture(spriteTexture4Ptr);
         defaultTexture = spriteTexture4Ptr;
         medalTexture = spriteTexture4MedalPtr;
         baseNormalOffsets = {4, 4, 5, 3};
         baseRunOffsets = {6, 7, 0, 3};
     }
     else {
-        sprite.setTexture(*baseSpriteTexturePtr);
+        sprite.setTexture(baseSpriteTexturePtr);
         defaultTexture = baseSpriteTexturePtr;
         medalTexture = baseSpriteTexturePtr;
         baseNormalOffsets = {4, 4, 5, 3};
@@ -505,12 +517,12 @@ void Player::hitAction(bool state) {
         sprite.setAnimation(hit);
         hitLock = true;
         hitTimer = HIT_TIME;
-        lastHitTimeUpdate = SDL_GetTicks();
+        lastHitTimeUpdate = SimulationClock::getTicks();
     }
 }
 
 bool Player::canJump() const {
-    return isGrounded || ((static_cast<float>(SDL_GetTicks()) - static_cast<float>(lastTimeOnPlatform)) / 1000.0f <= coyoteTime);
+    return isGrounded || ((static_cast<float>(SimulationClock::getTicks()) - static_cast<float>(lastTimeOnPlatform)) / 1000.0f <= coyoteTime);
 }
 
 void Player::calculateXaxisMovement(double delta_time) {
@@ -602,8 +614,8 @@ void Player::calculateMovement(double delta_time) {
 
 void Player::updateHitZone() {
     if (hitTimer > 0) {
-        hitTimer -= static_cast<int>(SDL_GetTicks() - lastHitTimeUpdate);
-        lastHitTimeUpdate = SDL_GetTicks();
+        hitTimer -= static_cast<int>(SimulationClock::getTicks() - lastHitTimeUpdate);
+        lastHitTimeUpdate = SimulationClock::getTicks();
 
         // Check horizontal orientation
         if (sprite.getFlipHorizontal() == SDL_FLIP_NONE) {
@@ -766,67 +778,66 @@ void Player::updateSpriteOrientation() {
 }
 
 
-void Player::render(SDL_Renderer *renderer, Point camera) {
+void Player::render(RenderSnapshot &snapshot) {
     SDL_Rect srcRect = sprite.getSrcRect();
 
-    float x_rect = x - camera.x - textureOffsets.x;
-    float y_rect = y - camera.y - textureOffsets.y;
+    float x_rect = x - textureOffsets.x;
+    float y_rect = y - textureOffsets.y;
     float w_rect = width + textureOffsets.x + textureOffsets.w;
     float h_rect = height + textureOffsets.y + textureOffsets.h;
 
     SDL_FRect player_rect = {x_rect, y_rect, w_rect, h_rect};
-    SDL_RenderCopyExF(renderer, sprite.getTexture(), &srcRect, &player_rect, 0.0, nullptr, sprite.getFlip());
+    snapshot.copy(sprite.getTexture(), srcRect, player_rect, 0.0, sprite.getFlip());
 }
 
-void Player::renderDebug(SDL_Renderer *renderer, Point camera) const {
-    SDL_SetRenderDrawColor(renderer, 255, 0, 0, 255);
-    SDL_FRect playerRect = {x - camera.x, y - camera.y, width, height};
-    SDL_RenderFillRectF(renderer, &playerRect);
+void Player::renderDebug(RenderSnapshot &snapshot) const {
+    snapshot.setDrawColor(255, 0, 0, 255);
+    SDL_FRect playerRect = {x, y, width, height};
+    snapshot.fillRect(playerRect);
 }
 
-void Player::renderColliders(SDL_Renderer *renderer, Point camera) const {
+void Player::renderColliders(RenderSnapshot &snapshot) const {
     // Draw the right collider
-    SDL_SetRenderDrawColor(renderer, 0, 0, 255, 255);
-    std::vector<Point> vertex_right = getRightColliderVertices();
+    snapshot.setDrawColor(0, 0, 255, 255);
+    Quad vertex_right = getRightColliderVertices();
     for (size_t i = 0; i < vertex_right.size(); ++i) {
         const auto &vertex1 = vertex_right[i];
         const auto &vertex2 = vertex_right[(i + 1) % vertex_right.size()];
-        SDL_RenderDrawLineF(renderer, vertex1.x - camera.x, vertex1.y - camera.y, vertex2.x - camera.x, vertex2.y - camera.y);
+        snapshot.drawLine(vertex1.x, vertex1.y, vertex2.x, vertex2.y);
     }
     // Draw the left collider
-    SDL_SetRenderDrawColor(renderer, 0, 255, 255, 255);
-    std::vector<Point> vertex_left = getLeftColliderVertices();
+    snapshot.setDrawColor(0, 255, 255, 255);
+    Quad vertex_left = getLeftColliderVertices();
     for (size_t i = 0; i < vertex_left.size(); ++i) {
         const auto &vertex1 = vertex_left[i];
         const auto &vertex2 = vertex_left[(i + 1) % vertex_left.size()];
-        SDL_RenderDrawLineF(renderer, vertex1.x - camera.x, vertex1.y - camera.y, vertex2.x - camera.x, vertex2.y - camera.y);
+        snapshot.drawLine(vertex1.x, vertex1.y, vertex2.x, vertex2.y);
     }
     // Draw the roof collider
-    SDL_SetRenderDrawColor(renderer, 0, 255, 0, 255);
-    std::vector<Point> vertex_roof = getRoofColliderVertices();
+    snapshot.setDrawColor(0, 255, 0, 255);
+    Quad vertex_roof = getRoofColliderVertices();
     for (size_t i = 0; i < vertex_roof.size(); ++i) {
         const auto &vertex1 = vertex_roof[i];
         const auto &vertex2 = vertex_roof[(i + 1) % vertex_roof.size()];
-        SDL_RenderDrawLineF(renderer, vertex1.x - camera.x, vertex1.y - camera.y, vertex2.x - camera.x, vertex2.y - camera.y);
+        snapshot.drawLine(vertex1.x, vertex1.y, vertex2.x, vertex2.y);
     }
     // Draw the ground collider
-    SDL_SetRenderDrawColor(renderer, 0, 255, 0, 255);
-    std::vector<Point> vertex_ground = getGroundColliderVertices();
+    snapshot.setDrawColor(0, 255, 0, 255);
+    Quad vertex_ground = getGroundColliderVertices();
     for (size_t i = 0; i < vertex_ground.size(); ++i) {
         const auto &vertex1 = vertex_ground[i];
         const auto &vertex2 = vertex_ground[(i + 1) % vertex_ground.size()];
-        SDL_RenderDrawLineF(renderer, vertex1.x - camera.x, vertex1.y - camera.y, vertex2.x - camera.x, vertex2.y - camera.y);
+        snapshot.drawLine(vertex1.x, vertex1.y, vertex2.x, vertex2.y);
     }
 
     // Draw the hitting collider
     if (isHitting) {
-        SDL_SetRenderDrawColor(renderer, 230, 0, 0, 255);
-        std::vector<Point> vertex_hit_zone = getHitZoneVertices();
+        snapshot.setDrawColor(230, 0, 0, 255);
+        Quad vertex_hit_zone = getHitZoneVertices();
         for (size_t i = 0; i < vertex_hit_zone.size(); ++i) {
             const auto &vertex1 = vertex_hit_zone[i];
             const auto &vertex2 = vertex_hit_zone[(i + 1) % vertex_hit_zone.size()];
-            SDL_RenderDrawLineF(renderer, vertex1.x - camera.x, vertex1.y - camera.y, vertex2.x - camera.x,
-                                vertex2.y - camera.y);
+            snapshot.drawLine(vertex1.x, vertex1.y, vertex2.x, vertex2.y);
         }
     }
 }
\ No newline at end of file
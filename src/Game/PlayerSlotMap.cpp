@@ -0,0 +1,110 @@
+#include "../../include/Game/PlayerSlotMap.h"
+
+/**
+ * @file PlayerSlotMap.cpp
+ * @brief Implements the PlayerSlotMap class storing the players in stable slots.
+ */
+
+
+/* ACCESSORS */
+
+PlayerSlotMap::View PlayerSlotMap::view(PlayerState state) {
+    const std::vector<uint32_t> &list = lists[static_cast<size_t>(state)];
+    return View(std::ranges::ref_view(list), SlotPlayer<std::deque<Player>>{&players});
+}
+
+PlayerSlotMap::ConstView PlayerSlotMap::view(PlayerState state) const {
+    const std::vector<uint32_t> &list = lists[static_cast<size_t>(state)];
+    return ConstView(std::ranges::ref_view(list), SlotPlayer<const std::deque<Player>>{&players});
+}
+
+size_t PlayerSlotMap::count(PlayerState state) const {
+    return lists[static_cast<size_t>(state)].size();
+}
+
+Player *PlayerSlotMap::find(int id) {
+    auto it = slotsById.find(id);
+    return it != slotsById.end() ? &players[it->second] : nullptr;
+}
+
+PlayerState PlayerSlotMap::getState(const Player &player) const {
+    return slots[slotsById.at(player.getPlayerID())].state;
+}
+
+size_t PlayerSlotMap::getPosition(const Player &player) const {
+    return slots[slotsById.at(player.getPlayerID())].position;
+}
+
+
+/* MODIFIERS */
+
+void PlayerSlotMap::setState(const Player &player, PlayerState state) {
+    uint32_t slot = slotsById.at(player.getPlayerID());
+    if (slots[slot].state == state) return;
+
+    unlink(slot);
+    link(slot, state);
+}
+
+
+/* METHODS */
+
+Player &PlayerSlotMap::insert(const Player &player, PlayerState state) {
+    // A player with the same id is replaced, its slot would stay in its state list with no id to erase it
+    erase(player.getPlayerID());
+
+    uint32_t slot;
+
+    // Reuse a free slot, or add one at the end (the other players do not move)
+    if (!freeSlots.empty()) {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+        players[slot] = player;
+    } else {
+        slot = static_cast<uint32_t>(players.size());
+        players.push_back(player);
+        slots.emplace_back();
+    }
+
+    slotsById[player.getPlayerID()] = slot;
+    link(slot, state);
+    return players[slot];
+}
+
+void PlayerSlotMap::erase(int id) {
+    auto it = slotsById.find(id);
+    if (it == slotsById.end()) return;
+
+    uint32_t slot = it->second;
+    slotsById.erase(it);
+    unlink(slot);
+    freeSlots.push_back(slot);
+}
+
+void PlayerSlotMap::clear() {
+    players.clear();
+    slots.clear();
+    for (std::vector<uint32_t> &list: lists) list.clear();
+    freeSlots.clear();
+    slotsById.clear();
+}
+
+
+/* SUB METHODS */
+
+void PlayerSlotMap::unlink(uint32_t slot) {
+    std::vector<uint32_t> &list = lists[static_cast<size_t>(slots[slot].state)];
+    uint32_t position = slots[slot].position;
+
+    // Swap and pop, the moved slot gets its new position
+    list[position] = list.back();
+    slots[list[position]].position = position;
+    list.pop_back();
+}
+
+void PlayerSlotMap::link(uint32_t slot, PlayerState state) {
+    std::vector<uint32_t> &list = lists[static_cast<size_t>(state)];
+    slots[slot].state = state;
+    slots[slot].position = static_cast<uint32_t>(list.size());
+    list.push_back(slot);
+}
@@ -23,6 +23,10 @@ float Crusher::getY() const {
     return y;
 }
 
+Point Crusher::getPreviousPosition() const {
+    return previousPosition;
+}
+
 float Crusher::getW() const {
     return w;
 }
@@ -88,6 +92,10 @@ void Crusher::setIsOnScreen(bool state) {
 
 /* METHODS */
 
+void Crusher::savePreviousPosition() {
+    previousPosition = {x, y};
+}
+
 void Crusher::applyUpMovement(double delta_time) {
     auto blend = static_cast<float>(1 - std::pow(0.5F, delta_time * 20));
     float smooth_movement = (max - y + 0.1F) * blend;
@@ -104,7 +112,7 @@ void Crusher::applyUpMovement(double delta_time) {
         y = min;
         direction = 1;
         timer = static_cast<int>(waitUpTime);
-        lastUpdate = SDL_GetTicks();
+        lastUpdate = SimulationClock::getTicks();
     }
 }
 
@@ -127,7 +135,7 @@ bool Crusher::applyDownMovement(double delta_time) {
         isCrushing = false;
         crushingSound.play(0, -1);
         timer = static_cast<int>(waitDownTime);
-        lastUpdate = SDL_GetTicks();
+        lastUpdate = SimulationClock::getTicks();
         return true;
     }
 
@@ -140,8 +148,8 @@ bool Crusher::applyMovement(double delta_time) {
     if (isMoving && isOnScreen) {
         // The crusher is in a waiting state
         if (timer > 0) {
-            timer -= static_cast<int>(SDL_GetTicks() - lastUpdate);
-            lastUpdate = SDL_GetTicks();
+            timer -= static_cast<int>(SimulationClock::getTicks() - lastUpdate);
+            lastUpdate = SimulationClock::getTicks();
         }
         // The crusher is moving
         else {
@@ -156,18 +164,18 @@ bool Crusher::applyMovement(double delta_time) {
     return check;
 }
 
-void Crusher::render(SDL_Renderer *renderer, Point camera) const {
+void Crusher::render(RenderSnapshot &snapshot) const {
     if (isOnScreen) {
         SDL_Rect src_rect = texture.getSize();
-        SDL_FRect platform_rect = {x - camera.x - textureOffsets.x, y - camera.y - textureOffsets.y,w + textureOffsets.w, h + textureOffsets.h};
-        SDL_RenderCopyExF(renderer, texture.getTexture(), &src_rect, &platform_rect, 0.0, nullptr, texture.getFlip());
+        SDL_FRect platform_rect = {x - textureOffsets.x, y - textureOffsets.y,w + textureOffsets.w, h + textureOffsets.h};
+        snapshot.copy(texture.getTexture(), src_rect, platform_rect, 0.0, texture.getFlip());
     }
 }
 
-void Crusher::renderDebug(SDL_Renderer *renderer, Point camera) const {
+void Crusher::renderDebug(RenderSnapshot &snapshot) const {
     if (isOnScreen) {
-        SDL_SetRenderDrawColor(renderer, 249, 190, 152, 255);
-        SDL_FRect platform_rect = {x - camera.x, y - camera.y, w, h};
-        SDL_RenderFillRectF(renderer, &platform_rect);
+        snapshot.setDrawColor(249, 190, 152, 255);
+        SDL_FRect platform_rect = {x, y, w, h};
+        snapshot.fillRect(platform_rect);
     }
 }
\ No newline at end of file
@@ -0,0 +1,63 @@
+#include "../../include/Graphics/RenderSnapshot.h"
+
+/**
+ * @file RenderSnapshot.cpp
+ * @brief Implements the RenderSnapshot class recording the drawing of a simulation tick.
+ */
+
+
+/* MODIFIERS */
+
+void RenderSnapshot::setDrawColor(Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
+    color = {r, g, b, a};
+}
+
+void RenderSnapshot::setMotion(Point newMotion) {
+    motion = newMotion;
+}
+
+
+/* METHODS */
+
+void RenderSnapshot::clear() {
+    commands.clear();
+    color = {0, 0, 0, 255};
+    motion = {0, 0};
+}
+
+void RenderSnapshot::copy(SDL_Texture *texture, const SDL_Rect &srcRect, const SDL_FRect &rect, double angle, SDL_RendererFlip flip) {
+    commands.push_back({DrawType::COPY, color, texture, srcRect, rect, angle, flip, motion});
+}
+
+void RenderSnapshot::fillRect(const SDL_FRect &rect) {
+    commands.push_back({DrawType::FILL_RECT, color, nullptr, {0, 0, 0, 0}, rect, 0.0, SDL_FLIP_NONE, motion});
+}
+
+void RenderSnapshot::drawLine(float x1, float y1, float x2, float y2) {
+    commands.push_back({DrawType::DRAW_LINE, color, nullptr, {0, 0, 0, 0}, {x1, y1, x2, y2}, 0.0, SDL_FLIP_NONE, motion});
+}
+
+void RenderSnapshot::render(SDL_Renderer *renderer, Point camera, float alpha) const {
+    for (const DrawCommand &command: commands) {
+        Point offset = interpolateCamera(camera, {0, 0}, command.motion, alpha);
+
+        switch (command.type) {
+            case DrawType::COPY: {
+                SDL_FRect rect = {command.rect.x - offset.x, command.rect.y - offset.y, command.rect.w, command.rect.h};
+                SDL_RenderCopyExF(renderer, command.texture, &command.srcRect, &rect, command.angle, nullptr, command.flip);
+                break;
+            }
+            case DrawType::FILL_RECT: {
+                SDL_SetRenderDrawColor(renderer, command.color.r, command.color.g, command.color.b, command.color.a);
+                SDL_FRect rect = {command.rect.x - offset.x, command.rect.y - offset.y, command.rect.w, command.rect.h};
+                SDL_RenderFillRectF(renderer, &rect);
+                break;
+            }
+            case DrawType::DRAW_LINE:
+                SDL_SetRenderDrawColor(renderer, command.color.r, command.color.g, command.color.b, command.color.a);
+                SDL_RenderDrawLineF(renderer, command.rect.x - offset.x, command.rect.y - offset.y,
+                                    command.rect.w - offset.x, command.rect.h - offset.y);
+                break;
+        }
+    }
+}
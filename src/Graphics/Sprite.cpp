@@ -8,8 +8,8 @@
 
 /* CONSTRUCTORS */
 
-Sprite::Sprite(SDL_Texture &texture, Animation animation, int width, int height) :
-        Texture(texture), animation(animation), srcRect({0, 0, width, height}) {}
+Sprite::Sprite(SDL_Texture *texture, Animation animation, int width, int height) :
+        Texture(texture != nullptr ? Texture(*texture) : Texture()), animation(animation), srcRect({0, 0, width, height}) {}
 
 
 /* ACCESSORS */
@@ -41,7 +41,7 @@ void Sprite::setAnimation(const Animation& newAnimation) {
             animation = newAnimation;
             animationIndexX = 0;
             nbFrameDisplayed = 0;
-            lastAnimationUpdate = SDL_GetTicks();
+            lastAnimationUpdate = SimulationClock::getTicks();
 
         }
         // Else, the current animation is unique, store the new animation to display it after the unique animation ends
@@ -69,8 +69,8 @@ bool Sprite::updateAnimation() {
     }
 
     // Update x position animation
-    if (SDL_GetTicks() - lastAnimationUpdate > animation.speed) {
-        lastAnimationUpdate = SDL_GetTicks() ;
+    if (SimulationClock::getTicks() - lastAnimationUpdate > animation.speed) {
+        lastAnimationUpdate = SimulationClock::getTicks();
         animationIndexX = (animationIndexX + 1) % animation.frames;
         nbFrameDisplayed++;
     }
@@ -12,6 +12,8 @@ Texture::Texture(SDL_Texture &texture, SDL_FRect offsets) : texturePtr(&texture)
     SDL_QueryTexture(&texture, nullptr, nullptr, &sizeRect.w, &sizeRect.h);
 }
 
+Texture::Texture(SDL_Rect size, SDL_FRect offsets) : sizeRect(size), offsets(offsets) {}
+
 
 /* ACCESSORS */
 
@@ -38,8 +40,8 @@ SDL_RendererFlip Texture::getFlip() const {
 
 /* MODIFIERS */
 
-void Texture::setTexture(SDL_Texture &newTexture) {
-    texturePtr = &newTexture;
+void Texture::setTexture(SDL_Texture *newTexture) {
+    texturePtr = newTexture;
 }
 
 void Texture::setFlipHorizontal(SDL_RendererFlip flip) {
@@ -136,6 +136,7 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char *args[]) {
 
             if (mainMessage == "InitializeClientGame") {
                 nlohmann::json message = nlohmann::json::parse(parameters[0]);
+                SimulationClock::setTickRate(message["tickRate"]); // Every peer simulates at the rate of the server
                 game.loadLevel(
                         message["mapName"],
                         message["lastCheckpoint"],
@@ -143,7 +144,8 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char *args[]) {
                         message["camera"],
                         message["platforms1D"],
                         message["platforms2D"],
-                        message["crushers"]
+                        message["crushers"],
+                        message["seed"]
                 );
             }
         }
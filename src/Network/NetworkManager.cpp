@@ -26,21 +26,31 @@ bool NetworkManager::isClientRunning() const {
     return SOCKET_VALID(tcpClient.getSocketFileDescriptor()) && SOCKET_VALID(udpClient.getSocketFileDescriptor());
 }
 
+SnapshotManager &NetworkManager::getSnapshotManager() {
+    return snapshotManager;
+}
+
+PredictionManager &NetworkManager::getPredictionManager() {
+    return predictionManager;
+}
+
 
 /** METHODS **/
 
-void NetworkManager::startServers() {
+void NetworkManager::startServers(unsigned short port) {
+    snapshotManager.reset();
+    predictionManager.reset();
     try {
-        tcpServer.initialize(8080);
-        std::cout << "TCPServer: Server initialized and listening on port 8080" << std::endl;
+        tcpServer.initialize(port);
+        std::cout << "TCPServer: Server initialized and listening on port " << port << std::endl;
 
         // Start the server in a separate thread
         serverTCPThreadPtr = std::make_unique<std::jthread>([this](TCPServer *serverPtr) {
             serverPtr->start(clientAddresses, clientAddressesMutex);
         }, &tcpServer);
 
-        udpServer.initialize(8080);
-        std::cout << "UDPServer: Server initialized and listening on port 8080" << std::endl;
+        udpServer.initialize(port);
+        std::cout << "UDPServer: Server initialized and listening on port " << port << std::endl;
 
         // Start the server in a separate thread
         serverUDPThreadPtr = std::make_unique<std::jthread>([this](UDPServer *serverPtr) {
@@ -54,6 +64,8 @@ void NetworkManager::startServers() {
 
 void NetworkManager::startClients(const std::string& ip, short port) {
     unsigned short clientPort;
+    snapshotManager.reset();
+    predictionManager.reset();
     try {
         tcpClient.connect(ip, port, clientPort);
         std::cout << "TCPClient: Connected to server" << std::endl;
@@ -102,7 +114,7 @@ void NetworkManager::stopClients() {
     clientUDPThreadPtr.reset();
 }
 
-void NetworkManager::broadcastMessage(int protocol, const std::string &message, int socketIgnored) const {
+void NetworkManager::broadcastMessage(int protocol, std::string_view message, int socketIgnored) const {
     if (message.empty()) {
         std::cerr << "Message is empty" << std::endl;
         return;
@@ -127,49 +139,67 @@ void NetworkManager::broadcastMessage(int protocol, const std::string &message,
     }
 }
 
-void NetworkManager::sendPlayerUpdate(uint16_t keyboardStateMask) const {
-
-    // Create a message with the player update
-    using json = nlohmann::json;
-    json message;
+void NetworkManager::sendPlayerUpdate(uint16_t inputSequence, uint16_t keyboardStateMask) const {
 
-    message["messageType"] = "playerUpdate";
-    message["keyboardStateMask"] = keyboardStateMask;
+    // Create a message with the player update, the server fills the player ID when it relays it
+    std::array<char, WireProtocol::getSize(MessageID::PLAYER_UPDATE)> buffer;
+    WireWriter writer(buffer);
+    writer.writeHeader(MessageID::PLAYER_UPDATE);
+    writer.writeI32(0);
+    writer.writeU16(inputSequence);
+    writer.writeU16(static_cast<uint16_t>(SimulationClock::getTickRate()));
+    writer.writeU16(keyboardStateMask);
 
     // If the application is a server, broadcast the message to all clients
     if (isServerRunning()) {
-        udpServer.broadcast(message.dump(), 0);
+        udpServer.broadcast(writer.getMessage(), 0);
     }
 
     // If the application is a client, send the message to the server
     else if (isClientRunning()) {
-        udpClient.send(message.dump());
+        udpClient.send(writer.getMessage());
     }
 
     // Otherwise, the game is local only (development mode)
 }
 
-void NetworkManager::sendSyncCorrection(nlohmann::json &message) {
-    // Send the correction message to all clients
+void NetworkManager::sendSyncCorrection(uint64_t tick) {
+    // Send the correction message to all clients, the clients with the same baseline share the same delta
     std::scoped_lock<std::mutex> lock(clientAddressesMutex);
 
     for (const auto& [clientId, clientAddress] : clientAddresses) {
-        udpServer.sendSyncCorrection(static_cast<int>(clientId), clientAddress, message);
+        int32_t baseline = snapshotManager.getBaseline(static_cast<int>(clientId));
+        std::string_view delta = snapshotManager.encode(baseline);
+        if (delta.empty()) {
+            std::cerr << "NetworkManager: Snapshot too large for a datagram" << std::endl;
+            continue;
+        }
+
+        int32_t processedInput = predictionManager.getProcessedInput(static_cast<int>(clientId), tick, SimulationClock::getTickRate());
+        udpServer.sendSyncCorrection(static_cast<int>(clientId), clientAddress, snapshotManager.getLastSequence(), baseline, processedInput, delta);
     }
 }
 
+void NetworkManager::sendSnapshotAck(uint16_t sequence) const {
+    std::array<char, WireProtocol::getSize(MessageID::SNAPSHOT_ACK)> buffer;
+    WireWriter writer(buffer);
+    writer.writeHeader(MessageID::SNAPSHOT_ACK);
+    writer.writeU16(sequence);
+
+    udpClient.send(writer.getMessage());
+}
+
 void NetworkManager::sendAsteroidCreation(Asteroid const &asteroid) const {
     // Create a message with the asteroid properties
-    using json = nlohmann::json;
-    json message;
-
-    message["messageType"] = "asteroidCreation";
-    message["x"] = asteroid.getX();
-    message["y"] = asteroid.getY();
-    message["speed"] = asteroid.getSpeed();
-    message["h"] = asteroid.getH();
-    message["w"] = asteroid.getW();
-    message["angle"] = asteroid.getAngle();
-
-    udpServer.broadcast(message.dump(), 0);
+    std::array<char, WireProtocol::getSize(MessageID::ASTEROID_CREATION)> buffer;
+    WireWriter writer(buffer);
+    writer.writeHeader(MessageID::ASTEROID_CREATION);
+    writer.writeF32(asteroid.getX());
+    writer.writeF32(asteroid.getY());
+    writer.writeF32(asteroid.getSpeed());
+    writer.writeF32(asteroid.getH());
+    writer.writeF32(asteroid.getW());
+    writer.writeF32(asteroid.getAngle());
+
+    udpServer.broadcast(writer.getMessage(), 0);
 }
\ No newline at end of file
@@ -0,0 +1,99 @@
+#include "../../include/Network/PredictionManager.h"
+
+#include <cmath>
+
+/**
+ * @file PredictionManager.cpp
+ * @brief Implements the PredictionManager class reconciling the movement predicted by a client with the server.
+ */
+
+
+/* ACCESSORS */
+
+int32_t PredictionManager::getProcessedInput(int clientID, uint64_t tick, uint64_t tickRate) const {
+    std::scoped_lock<std::mutex> lock(receivedInputsMutex);
+
+    // The ticks of the server are not the ticks of a client simulating at another rate
+    auto it = receivedInputs.find(clientID);
+    if (it == receivedInputs.end() || it->second.tickRate != tickRate) return NO_INPUT;
+
+    // The client kept its input until the next one, each server tick since the reception is one more client tick
+    const ReceivedInput &input = it->second;
+    return static_cast<uint16_t>(input.sequence + (tick - input.tick) - 1);
+}
+
+
+/* METHODS */
+
+void PredictionManager::receiveInput(int clientID, uint16_t sequence, uint64_t tickRate, uint64_t tick) {
+    std::scoped_lock<std::mutex> lock(receivedInputsMutex);
+
+    // Keep the most recent input, the datagrams can arrive out of order
+    auto [it, inserted] = receivedInputs.try_emplace(clientID, ReceivedInput{sequence, tickRate, tick});
+    if (!inserted && static_cast<int16_t>(sequence - it->second.sequence) > 0) it->second = {sequence, tickRate, tick};
+}
+
+void PredictionManager::removeClient(int clientID) {
+    std::scoped_lock<std::mutex> lock(receivedInputsMutex);
+    receivedInputs.erase(clientID);
+}
+
+void PredictionManager::record(uint16_t sequence, float x, float y) {
+    // The slot of the oldest prediction is reused (HISTORY_SIZE divides 2^16, the slots follow the wrap of the sequence)
+    history[sequence % HISTORY_SIZE] = {sequence, true, x, y};
+}
+
+void PredictionManager::receiveAuthoritativeState(const AuthoritativeState &state) {
+    std::scoped_lock<std::mutex> lock(pendingStateMutex);
+    pendingState = state;
+}
+
+bool PredictionManager::takeAuthoritativeState(AuthoritativeState &state) {
+    std::scoped_lock<std::mutex> lock(pendingStateMutex);
+    if (!pendingState) return false;
+
+    state = *pendingState;
+    pendingState.reset();
+    return true;
+}
+
+Reconciliation PredictionManager::reconcile(const AuthoritativeState &state, PredictionCorrection &correction) {
+    // An input not acknowledged, not predicted yet or too old is not reconciled
+    if (state.sequence == NO_INPUT) return Reconciliation::NO_PREDICTION;
+
+    auto sequence = static_cast<uint16_t>(state.sequence);
+    const PredictedState &predicted = history[sequence % HISTORY_SIZE];
+    if (!predicted.valid || predicted.sequence != sequence) return Reconciliation::NO_PREDICTION;
+
+    float delta_x = state.x - predicted.x;
+    float delta_y = state.y - predicted.y;
+    if (std::abs(delta_x) <= TOLERANCE && std::abs(delta_y) <= TOLERANCE) return Reconciliation::WITHIN_TOLERANCE;
+
+    // Replay the later inputs from the authoritative position, so a later acknowledgement does not correct twice
+    for (PredictedState &predicted_state : history) {
+        auto age = static_cast<int16_t>(predicted_state.sequence - sequence);
+        if (!predicted_state.valid || age < 0 || static_cast<size_t>(age) >= HISTORY_SIZE) continue;
+
+        predicted_state.x += delta_x;
+        predicted_state.y += delta_y;
+    }
+
+    correction = {delta_x, delta_y};
+    return Reconciliation::CORRECTED;
+}
+
+void PredictionManager::clearPredictions() {
+    for (PredictedState &predicted : history) predicted.valid = false;
+}
+
+void PredictionManager::reset() {
+    clearPredictions();
+
+    {
+        std::scoped_lock<std::mutex> lock(pendingStateMutex);
+        pendingState.reset();
+    }
+
+    std::scoped_lock<std::mutex> lock(receivedInputsMutex);
+    receivedInputs.clear();
+}
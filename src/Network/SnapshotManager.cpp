@@ -0,0 +1,262 @@
+#include "../../include/Network/SnapshotManager.h"
+
+#include <cmath>
+#include <algorithm>
+
+/**
+ * @file SnapshotManager.cpp
+ * @brief Implements the SnapshotManager class sending the state of the game as deltas of acknowledged snapshots.
+ */
+
+
+/* ACCESSORS */
+
+uint16_t SnapshotManager::getLastSequence() const {
+    return lastSequence;
+}
+
+int32_t SnapshotManager::getBaseline(int clientID) const {
+    std::scoped_lock<std::mutex> lock(acknowledgedMutex);
+
+    auto it = acknowledged.find(clientID);
+    if (it == acknowledged.end() || find(it->second) == nullptr) return NO_BASELINE;
+    return it->second;
+}
+
+
+/* METHODS */
+
+int32_t SnapshotManager::quantize(float value) {
+    return static_cast<int32_t>(std::lround(value * POSITION_SCALE));
+}
+
+float SnapshotManager::dequantize(int32_t value) {
+    return static_cast<float>(value) / POSITION_SCALE;
+}
+
+Snapshot &SnapshotManager::capture() {
+    lastSequence = hasLastSequence ? static_cast<uint16_t>(lastSequence + 1) : 0;
+    hasLastSequence = true;
+
+    // The slot of the oldest snapshot is reused (HISTORY_SIZE divides 2^16, the slots follow the wrap of the sequence)
+    Snapshot &snapshot = history[lastSequence % HISTORY_SIZE];
+    snapshot.sequence = lastSequence;
+    snapshot.valid = true;
+    snapshot.players.clear();
+    snapshot.platforms1D.clear();
+    snapshot.platforms2D.clear();
+    snapshot.crushers.clear();
+
+    // The deltas of the previous snapshot are outdated
+    encodedCount = 0;
+    return snapshot;
+}
+
+std::string_view SnapshotManager::encode(int32_t baseline) {
+    // Share the delta with the clients already sent the same baseline
+    for (size_t i = 0; i < encodedCount; i++) {
+        if (encodedDeltas[i].baseline == baseline) return {encodedDeltas[i].buffer.data(), encodedDeltas[i].size};
+    }
+
+    if (encodedCount == encodedDeltas.size()) encodedDeltas.emplace_back();
+    EncodedDelta &delta = encodedDeltas[encodedCount++];
+    delta.baseline = baseline;
+
+    static const Snapshot empty;
+    const Snapshot &current = history[lastSequence % HISTORY_SIZE];
+    const Snapshot *base = find(baseline);
+    if (base == nullptr) base = &empty;
+
+    WireWriter writer(delta.buffer);
+    encodePlayers(writer, current.players, base->players);
+    encodePositions(writer, current.platforms1D, base->platforms1D);
+    encodePositions(writer, current.platforms2D, base->platforms2D);
+    encodePositions(writer, current.crushers, base->crushers);
+
+    delta.size = writer.isValid() ? writer.getMessage().size() : 0;
+    return {delta.buffer.data(), delta.size};
+}
+
+void SnapshotManager::acknowledge(int clientID, uint16_t sequence) {
+    std::scoped_lock<std::mutex> lock(acknowledgedMutex);
+
+    // Keep the most recent acknowledgement, the datagrams can arrive out of order
+    auto [it, inserted] = acknowledged.try_emplace(clientID, sequence);
+    if (!inserted && static_cast<int16_t>(sequence - it->second) > 0) it->second = sequence;
+}
+
+void SnapshotManager::removeClient(int clientID) {
+    std::scoped_lock<std::mutex> lock(acknowledgedMutex);
+    acknowledged.erase(clientID);
+}
+
+const Snapshot *SnapshotManager::decode(WireReader &reader, uint16_t sequence, int32_t baseline) {
+    // Drop the snapshots older than the last one applied
+    if (hasLastSequence && static_cast<int16_t>(sequence - lastSequence) <= 0) return nullptr;
+
+    const Snapshot *base = nullptr;
+    if (baseline != NO_BASELINE) {
+        base = find(baseline);
+        if (base == nullptr) return nullptr;
+    }
+
+    // Start from the baseline and apply the delta
+    Snapshot &snapshot = history[sequence % HISTORY_SIZE];
+    if (base == &snapshot) return nullptr;
+
+    snapshot.valid = false;
+    if (base != nullptr) {
+        snapshot.players = base->players;
+        snapshot.platforms1D = base->platforms1D;
+        snapshot.platforms2D = base->platforms2D;
+        snapshot.crushers = base->crushers;
+    } else {
+        snapshot.players.clear();
+        snapshot.platforms1D.clear();
+        snapshot.platforms2D.clear();
+        snapshot.crushers.clear();
+    }
+
+    decodePlayers(reader, snapshot.players);
+    decodePositions(reader, snapshot.platforms1D);
+    decodePositions(reader, snapshot.platforms2D);
+    decodePositions(reader, snapshot.crushers);
+    if (!reader.isValid()) return nullptr;
+
+    snapshot.sequence = sequence;
+    snapshot.valid = true;
+    lastSequence = sequence;
+    hasLastSequence = true;
+    return &snapshot;
+}
+
+void SnapshotManager::reset() {
+    for (Snapshot &snapshot : history) snapshot.valid = false;
+    hasLastSequence = false;
+    encodedCount = 0;
+
+    std::scoped_lock<std::mutex> lock(acknowledgedMutex);
+    acknowledged.clear();
+}
+
+
+/* SUB METHODS */
+
+const Snapshot *SnapshotManager::find(int32_t sequence) const {
+    if (sequence < 0) return nullptr;
+
+    const Snapshot &snapshot = history[static_cast<size_t>(sequence) % HISTORY_SIZE];
+    return snapshot.valid && snapshot.sequence == sequence ? &snapshot : nullptr;
+}
+
+void SnapshotManager::encodePositions(WireWriter &writer, const std::vector<QuantizedPosition> &positions, const std::vector<QuantizedPosition> &baseline) {
+    auto origin = [&baseline](size_t i) { return i < baseline.size() ? baseline[i] : QuantizedPosition{}; };
+
+    uint32_t changed_count = 0;
+    for (size_t i = 0; i < positions.size(); i++) changed_count += !(positions[i] == origin(i));
+
+    writer.writeVarU32(static_cast<uint32_t>(positions.size()));
+    writer.writeVarU32(changed_count);
+
+    // Each changed position: the gap from the previous one, then its move from the baseline
+    size_t next = 0;
+    for (size_t i = 0; i < positions.size(); i++) {
+        QuantizedPosition from = origin(i);
+        if (positions[i] == from) continue;
+
+        writer.writeVarU32(static_cast<uint32_t>(i - next));
+        writer.writeVarI32(positions[i].x - from.x);
+        writer.writeVarI32(positions[i].y - from.y);
+        next = i + 1;
+    }
+}
+
+void SnapshotManager::decodePositions(WireReader &reader, std::vector<QuantizedPosition> &positions) {
+    uint32_t count = reader.readVarU32();
+    uint32_t changed_count = reader.readVarU32();
+    if (!reader.isValid() || count > UINT16_MAX || changed_count > count) {
+        reader.invalidate();
+        return;
+    }
+
+    positions.resize(count);
+
+    size_t index = 0;
+    for (uint32_t i = 0; i < changed_count; i++) {
+        index += reader.readVarU32();
+        int32_t dx = reader.readVarI32();
+        int32_t dy = reader.readVarI32();
+        if (!reader.isValid() || index >= positions.size()) {
+            reader.invalidate();
+            return;
+        }
+
+        positions[index].x += dx;
+        positions[index].y += dy;
+        index++;
+    }
+}
+
+void SnapshotManager::encodePlayers(WireWriter &writer, const std::vector<SnapshotPlayer> &players, const std::vector<SnapshotPlayer> &baseline) {
+    // Walk both lists sorted by ID: a player missing from the baseline is new, a baseline player missing from the list is removed
+    auto walk = [&players, &baseline](auto &&on_player, auto &&on_removed) {
+        size_t j = 0;
+        for (const SnapshotPlayer &player : players) {
+            while (j < baseline.size() && baseline[j].id < player.id) on_removed(baseline[j++]);
+
+            if (j < baseline.size() && baseline[j].id == player.id) on_player(player, baseline[j++].position, false);
+            else on_player(player, QuantizedPosition{}, true);
+        }
+        while (j < baseline.size()) on_removed(baseline[j++]);
+    };
+
+    // A new player is always sent, even at (0, 0), or the client would never learn about it
+    auto is_sent = [](const SnapshotPlayer &player, QuantizedPosition from, bool is_new) {
+        return is_new || !(player.position == from);
+    };
+
+    uint32_t changed_count = 0;
+    uint32_t removed_count = 0;
+    walk([&](const SnapshotPlayer &player, QuantizedPosition from, bool is_new) { changed_count += is_sent(player, from, is_new); },
+         [&](const SnapshotPlayer &) { removed_count++; });
+
+    writer.writeVarU32(changed_count);
+    walk([&](const SnapshotPlayer &player, QuantizedPosition from, bool is_new) {
+             if (!is_sent(player, from, is_new)) return;
+             writer.writeVarI32(player.id);
+             writer.writeVarI32(player.position.x - from.x);
+             writer.writeVarI32(player.position.y - from.y);
+         },
+         [](const SnapshotPlayer &) {});
+
+    writer.writeVarU32(removed_count);
+    walk([](const SnapshotPlayer &, QuantizedPosition, bool) {},
+         [&](const SnapshotPlayer &removed) { writer.writeVarI32(removed.id); });
+}
+
+void SnapshotManager::decodePlayers(WireReader &reader, std::vector<SnapshotPlayer> &players) {
+    auto lower_bound = [&players](int32_t id) {
+        return std::ranges::lower_bound(players, id, {}, &SnapshotPlayer::id);
+    };
+
+    // The changed and new players, their move is from the baseline (or from 0 for a new player)
+    uint32_t changed_count = reader.readVarU32();
+    for (uint32_t i = 0; i < changed_count && reader.isValid(); i++) {
+        int32_t id = reader.readVarI32();
+        int32_t dx = reader.readVarI32();
+        int32_t dy = reader.readVarI32();
+        if (!reader.isValid()) return;
+
+        auto it = lower_bound(id);
+        if (it == players.end() || it->id != id) it = players.insert(it, SnapshotPlayer{id, {}});
+        it->position.x += dx;
+        it->position.y += dy;
+    }
+
+    uint32_t removed_count = reader.readVarU32();
+    for (uint32_t i = 0; i < removed_count && reader.isValid(); i++) {
+        int32_t id = reader.readVarI32();
+        auto it = lower_bound(id);
+        if (it != players.end() && it->id == id) players.erase(it);
+    }
+}
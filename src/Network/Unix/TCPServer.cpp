@@ -3,23 +3,20 @@
 #include "../../../include/Network/Unix/TCPServer.h"
 
 /*
-    The TCP server listens on a specified port and accepts incoming connections from clients. For each
-    connected client, a new thread is created to handle incoming and outgoing messages.
+    The TCP server listens on a specified port and accepts incoming connections from clients. A single thread
+    runs an epoll event loop over the server socket and every client socket, all of them non-blocking.
 
     The server can receive variable-sized messages from clients. Each message starts with the message size
-    (an integer) followed by the message content. This structure allows for reliable message handling and
-    determining the length of the received message.
+    (an integer) followed by the message content. The bytes received are appended to the read buffer of the
+    client, and every complete message of the buffer is handled, so a message can arrive in any number of parts.
+
+    The messages sent are appended to the write buffer of the client (from any thread), and the socket sends
+    what it accepts at once. The rest is sent when epoll reports the socket writable again.
 
     When a client disconnects, the server closes the associated connection and removes the client from its
     list of connected clients.
 
-    The server uses exceptions to handle errors during socket creation, binding, and read/write operations.
-
-    Thread Operation:
-    - The server creates a dedicated thread for each connected client to handle incoming and outgoing
-    messages asynchronously.
-    - Each client thread constantly monitors incoming messages and processes the received data according
-    to the application's needs.
+    The server uses exceptions to handle errors during socket creation, binding, and listening.
  */
 
 /** CONSTRUCTORS **/
@@ -38,9 +35,9 @@ int TCPServer::getSocketFileDescriptor() const {
 /** METHODS **/
 
 // Initialize the server with a specified port
-void TCPServer::initialize(short port) {
+void TCPServer::initialize(unsigned short port) {
     // Create socket
-    socketFileDescriptor = socket(AF_INET, SOCK_STREAM, 0);
+    socketFileDescriptor = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
     if (socketFileDescriptor == -1) {
         throw TCPSocketCreationError("TCPServer: Error during socket creation");
     }
@@ -55,9 +52,25 @@ void TCPServer::initialize(short port) {
     }
 
     // Listen for incoming connections
-    if (listen(socketFileDescriptor, 5) == -1) {
+    if (listen(socketFileDescriptor, SOMAXCONN) == -1) {
         throw TCPSocketListenError("TCPServer: Error during listen");
     }
+
+    // Watch the server socket and the wake-up eventfd
+    epollFileDescriptor = epoll_create1(EPOLL_CLOEXEC);
+    wakeFileDescriptor = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (epollFileDescriptor == -1 || wakeFileDescriptor == -1) {
+        throw TCPSocketCreationError("TCPServer: Error during epoll creation");
+    }
+
+    for (int fileDescriptor : {socketFileDescriptor, wakeFileDescriptor}) {
+        epoll_event event = {};
+        event.events = EPOLLIN;
+        event.data.fd = fileDescriptor;
+        if (epoll_ctl(epollFileDescriptor, EPOLL_CTL_ADD, fileDescriptor, &event) == -1) {
+            throw TCPSocketCreationError("TCPServer: Error during epoll registration");
+        }
+    }
 }
 
 // Start the server
@@ -66,54 +79,226 @@ void TCPServer::start(std::map<int, sockaddr_in> &clientAddresses, std::mutex &c
     clientAddressesMutexPtr = &clientAddressesMutex;
 
     stopRequested = false;
-    acceptConnections();
+    runEventLoop();
     clearResources();
     std::cout << "TCPServer: Server shutdown" << std::endl;
 }
 
-// Accept incoming client connections
-void TCPServer::acceptConnections() {
+// Send a message to a client
+bool TCPServer::send(int clientSocket, std::string_view message) const {
+#ifdef DEVELOPMENT_MODE
+    std::cout << "TCPServer: Sending message: " << WireProtocol::describe(message) << " (" << message.length() << " bytes) to client " << clientSocket << std::endl;
+#endif
+
+    std::scoped_lock<std::mutex> lock(connectionsMutex);
+    auto it = connections.find(clientSocket);
+    if (it == connections.end()) return false;
+
+    return queueMessage(*it->second, message);
+}
+
+// Broadcast a message to all connected clients
+bool TCPServer::broadcast(std::string_view message, int socketIgnored) const {
+    std::scoped_lock<std::mutex> lock(connectionsMutex);
+#ifdef DEVELOPMENT_MODE
+    std::cout << "TCPServer: Broadcasting message: " << WireProtocol::describe(message) << " (" << message.length() << " bytes) to " << connections.size() << " clients" << std::endl;
+#endif
+
+    bool send_successful = true;
+    for (const auto &[clientSocket, connection] : connections) {
+        if (clientSocket == socketIgnored) continue;
+        send_successful = queueMessage(*connection, message) && send_successful;
+    }
+
+    return send_successful;
+}
+
+bool TCPServer::sendGameProperties(int clientSocket) const {
+    using json = nlohmann::json;
+
+    // Create JSON message
+    json message;
+    message["messageType"] = "gameProperties";
+    Mediator::getGameProperties(message);
+
+    // Add all connected clients to the player list
+    message["players"] = json::array();
+    for (const Player &player : Mediator::getAlivePlayers()) {
+        int playerID = player.getPlayerID();
+        if (playerID == -1) playerID = 0; // The server player has ID 0
+        if (playerID == clientSocket) playerID = -1; // The client itself has ID -1
+
+        // Replace the client socket with -1 for the client itself
+        json playerInfo;
+        playerInfo["playerID"] = playerID;
+        playerInfo["x"] = player.getX();
+        playerInfo["y"] = player.getY();
+        playerInfo["moveX"] = player.getMoveX();
+        playerInfo["moveY"] = player.getMoveY();
+
+        message["players"].push_back(playerInfo);
+    }
+
+    return send(clientSocket, message.dump());
+}
+
+bool TCPServer::relayClientConnection(int clientSocket) const {
+    std::array<char, WireProtocol::getSize(MessageID::PLAYER_CONNECT)> buffer;
+    WireWriter writer(buffer);
+    writer.writeHeader(MessageID::PLAYER_CONNECT);
+    writer.writeI32(static_cast<int32_t>(clientSocket));
+
+    return broadcast(writer.getMessage(), clientSocket);
+}
+
+bool TCPServer::relayClientDisconnection(int clientSocket) const {
+    std::array<char, WireProtocol::getSize(MessageID::PLAYER_DISCONNECT)> buffer;
+    WireWriter writer(buffer);
+    writer.writeHeader(MessageID::PLAYER_DISCONNECT);
+    writer.writeI32(static_cast<int32_t>(clientSocket));
+
+    return broadcast(writer.getMessage(), clientSocket);
+}
+
+// Stop the server
+void TCPServer::stop() {
+    // Send a disconnect message to all connected clients
+    std::cout << "TCPServer: Sending disconnect message to all clients" << std::endl;
+    broadcast("DISCONNECT", 0);
+
+    // Stop the event loop
+    stopRequested = true;
+    if (wakeFileDescriptor != -1) {
+        uint64_t value = 1;
+        if (write(wakeFileDescriptor, &value, sizeof(value)) == -1) perror("TCPServer: Error waking the event loop");
+    }
+
+    if (socketFileDescriptor != -1) {
+        ::shutdown(socketFileDescriptor, SHUT_RDWR);
+        close(socketFileDescriptor);
+        socketFileDescriptor = -1;
+
+        std::cout << "TCPServer: Server socket closed" << std::endl;
+    }
+}
+
+void TCPServer::runEventLoop() {
     std::cout << "TCPServer: Handling incoming connections..." << std::endl;
 
+    int serverSocket = socketFileDescriptor;
+    std::array<epoll_event, MAX_EVENTS> events = {};
+
     while (!stopRequested.load()) {
-        int clientSocket = waitForConnection();
-        if (clientSocket != -1) {
-            // Create a new thread to handle messages from the client
-            std::jthread clientThread(&TCPServer::handleMessage, this, clientSocket);
-            clientThreads.push_back(std::move(clientThread));
+        int eventCount = epoll_wait(epollFileDescriptor, events.data(), MAX_EVENTS, -1);
+        if (eventCount == -1) {
+            if (errno == EINTR) continue;
+            perror("TCPServer: Error in epoll_wait()");
+            break;
+        }
+
+        for (int i = 0; i < eventCount; i++) {
+            int fileDescriptor = events[i].data.fd;
+            uint32_t flags = events[i].events;
+
+            if (fileDescriptor == wakeFileDescriptor) {
+                uint64_t value;
+                while (read(wakeFileDescriptor, &value, sizeof(value)) > 0) {}
+                continue;
+            }
+
+            if (fileDescriptor == serverSocket) {
+                acceptConnections();
+                continue;
+            }
+
+            // The connection may have been closed by a previous event of this wait
+            Connection *connection;
+            {
+                std::scoped_lock<std::mutex> lock(connectionsMutex);
+                auto it = connections.find(fileDescriptor);
+                if (it == connections.end()) continue;
+                connection = it->second.get();
+            }
+
+            // Handle the messages received before a hang up, then close the connection
+            bool connected = true;
+            if (flags & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+                bool readable = readConnection(*connection);
+                connected = handleMessages(*connection) && readable;
+            }
+
+            if (connected && (flags & EPOLLOUT)) {
+                std::scoped_lock<std::mutex> lock(connectionsMutex);
+                connected = flushConnection(*connection);
+            }
+
+            if (!connected) closeConnection(fileDescriptor);
         }
     }
 
     std::cout << "TCPServer: Stopping connection handling" << std::endl;
 }
 
-// Wait for a connection from a client
-int TCPServer::waitForConnection() {
-    struct sockaddr_in clientAddr = {};
-    socklen_t clientLen = sizeof(clientAddr);
+void TCPServer::acceptConnections() {
+    while (!stopRequested.load()) {
+        struct sockaddr_in clientAddr = {};
+        socklen_t clientLen = sizeof(clientAddr);
+
+        int clientSocket = accept4(socketFileDescriptor, (struct sockaddr *) &clientAddr, &clientLen, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (clientSocket == -1) {
+            if (errno == EINTR) continue;
+            return; // No more pending connection (EAGAIN) or the server socket is closed
+        }
 
-    std::cout << "TCPServer: Waiting for new client connection" << std::endl;
-    int clientSocket = accept(socketFileDescriptor, (struct sockaddr *) &clientAddr, &clientLen);
-    if (clientSocket == -1) return -1;
+        openConnection(clientSocket, clientAddr);
+    }
+}
 
+void TCPServer::openConnection(int clientSocket, const sockaddr_in &clientAddress) {
     // Check if the maximum number of clients has been reached, if so, close the connection
     clientAddressesMutexPtr->lock();
-    if (clientAddressesPtr->size() >= maxClients) {
-        clientAddressesMutexPtr->unlock();
+    bool serverFull = clientAddressesPtr->size() >= maxClients;
+    clientAddressesMutexPtr->unlock();
+
+    if (serverFull) {
+        constexpr std::string_view disconnect = "DISCONNECT";
+        auto messageSize = static_cast<int>(disconnect.size());
+        std::array<char, sizeof(int) + disconnect.size()> frame = {};
+        memcpy(frame.data(), &messageSize, sizeof(int));
+        memcpy(frame.data() + sizeof(int), disconnect.data(), disconnect.size());
 
-        send(clientSocket, "DISCONNECT");
+        // A new socket accepts this small frame at once
+        ::send(clientSocket, frame.data(), frame.size(), MSG_NOSIGNAL);
         close(clientSocket);
         std::cout << "TCPServer: Maximum number of clients reached" << std::endl;
-        return -1;
+        return;
+    }
+
+    std::string clientIp = inet_ntoa(clientAddress.sin_addr);
+    std::cout << "TCPServer: New client connected from " << clientIp << ":" << ntohs(clientAddress.sin_port) << std::endl;
+
+    // Watch the client socket
+    {
+        std::scoped_lock<std::mutex> lock(connectionsMutex);
+        auto connection = std::make_unique<Connection>();
+        connection->socket = clientSocket;
+        connections.emplace(clientSocket, std::move(connection));
     }
-    clientAddressesMutexPtr->unlock();
 
-    std::string clientIp = inet_ntoa(clientAddr.sin_addr);
-    std::cout << "TCPServer: New client connected from " << clientIp << ":" << ntohs(clientAddr.sin_port) << std::endl;
+    epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.fd = clientSocket;
+    if (epoll_ctl(epollFileDescriptor, EPOLL_CTL_ADD, clientSocket, &event) == -1) {
+        perror("TCPServer: Error watching the client socket");
+        std::scoped_lock<std::mutex> lock(connectionsMutex);
+        connections.erase(clientSocket);
+        close(clientSocket);
+        return;
+    }
 
     // Add the client to the list of connected clients
     clientAddressesMutexPtr->lock();
-    clientAddressesPtr->insert({clientSocket, clientAddr});
+    clientAddressesPtr->insert({clientSocket, clientAddress});
     clientAddressesMutexPtr->unlock();
     std::cout << "TCPServer: New client connected with ID: " << clientSocket << std::endl;
 
@@ -121,40 +306,13 @@ int TCPServer::waitForConnection() {
     Mediator::handleClientConnect(clientSocket);
     sendGameProperties(clientSocket);
     relayClientConnection(clientSocket);
-
-    return clientSocket;
 }
 
-// Handle messages from a client
-void TCPServer::handleMessage(int clientSocket) {
-    bool clientConnected = true;
-    while (clientConnected) {
-        try {
-            // Check if the client is still connected (if the clientFileDescriptor is still in the list of connected clients)
-            clientAddressesMutexPtr->lock();
-            clientConnected = clientAddressesPtr->contains(clientSocket);
-            clientAddressesMutexPtr->unlock();
-
-            if (clientConnected) {
-                std::cout << "TCPServer: Waiting for message from client " << clientSocket << std::endl;
-                std::string message = receive(clientSocket);
-
-                if (message == "DISCONNECT") {
-                    std::cout << "TCPServer: Client " << clientSocket << " asked to disconnect" << std::endl;
-                    clientConnected = false;
-                } else if (!message.empty()) {
-                    // Handle received message
-                    Mediator::handleMessages(0, message, clientSocket);
-                } else {
-                    std::cout << "TCPServer: Client " << clientSocket << " disconnected" << std::endl;
-                    clientConnected = false;
-                }
-            }
-        } catch (const TCPSocketReceiveError& e) {
-            std::cerr << e.what() << std::endl;
-            // Exit the loop on error
-            clientConnected = false;
-        }
+void TCPServer::closeConnection(int clientSocket) {
+    epoll_ctl(epollFileDescriptor, EPOLL_CTL_DEL, clientSocket, nullptr);
+    {
+        std::scoped_lock<std::mutex> lock(connectionsMutex);
+        connections.erase(clientSocket);
     }
 
     std::cout << "TCPServer: Client " << clientSocket << " disconnected" << std::endl;
@@ -171,184 +329,117 @@ void TCPServer::handleMessage(int clientSocket) {
     clientAddressesMutexPtr->unlock();
 }
 
-// Send a message to a client
-bool TCPServer::send(int clientSocket, const std::string &message) const {
-#ifdef DEVELOPMENT_MODE
-    std::cout << "TCPServer: Sending message: " << message << " (" << message.length() << " bytes) to client " << clientSocket << std::endl;
-#endif
+bool TCPServer::readConnection(Connection &connection) {
+    while (true) {
+        // Read directly at the end of the buffer
+        size_t used = connection.readBuffer.size();
+        connection.readBuffer.resize(used + READ_CHUNK_SIZE);
+        ssize_t bytesRead = recv(connection.socket, connection.readBuffer.data() + used, READ_CHUNK_SIZE, 0);
+        connection.readBuffer.resize(used + std::max<ssize_t>(bytesRead, 0));
+
+        if (bytesRead > 0) continue;
+        if (bytesRead == 0) return false; // Connection closed by the client
+        if (errno == EAGAIN || errno == EWOULDBLOCK) return true; // Everything available was read
+        if (errno == EINTR) continue;
 
-    // First, send the size of the message
-    auto messageSize = static_cast<int>(message.length()); // Message size including null terminator
-    if (::send(clientSocket, &messageSize, sizeof(int), 0) == -1) {
-        perror("TCPServer: Error sending message size");
+        perror("TCPServer: Error receiving message");
         return false;
     }
+}
 
-    // Then, send the message itself
-    const char *messagePtr = message.c_str();
-    ssize_t totalBytesSent = 0;
-    while (totalBytesSent < messageSize) {
-        ssize_t bytesSent = ::send(clientSocket, messagePtr + totalBytesSent, messageSize - totalBytesSent, 0);
-        if (bytesSent == -1) {
-            perror("TCPServer: Error sending message");
+bool TCPServer::handleMessages(Connection &connection) {
+    const std::vector<char> &buffer = connection.readBuffer;
+    size_t offset = 0;
+    bool connected = true;
+
+    // Handle every complete message, an incomplete one waits for the next bytes
+    while (connected && buffer.size() - offset >= sizeof(int)) {
+        int messageSize;
+        memcpy(&messageSize, buffer.data() + offset, sizeof(int));
+        if (messageSize < 0 || messageSize > MAX_MESSAGE_SIZE) {
+            std::cerr << "TCPServer: Invalid message size from client " << connection.socket << std::endl;
             return false;
         }
-        totalBytesSent += bytesSent;
-    }
-
-    return true;
-}
-
-// Broadcast a message to all connected clients
-bool TCPServer::broadcast(const std::string &message, int socketIgnored) const {
-    clientAddressesMutexPtr->lock();
-#ifdef DEVELOPMENT_MODE
-    std::cout << "TCPServer: Broadcasting message: " << message << " (" << message.length() << " bytes) to " << clientAddressesPtr->size() << " clients" << std::endl;
-#endif
-
-    auto send_successful = std::ranges::all_of(*clientAddressesPtr, [&](const auto& client) {
-        if (client.first == socketIgnored) return true;
-        return send(client.first, message);
-    });
-
-    clientAddressesMutexPtr->unlock();
-    return send_successful;
-}
+        if (buffer.size() - offset - sizeof(int) < static_cast<size_t>(messageSize)) break;
 
-// Receive a message from a client
-std::string TCPServer::receive(int clientSocket) const {
-    char sizeBuffer[sizeof(int)];
-    ssize_t bytesRead;
-
-    // Receive the size of the message
-    bytesRead = recv(clientSocket, sizeBuffer, sizeof(sizeBuffer), MSG_WAITALL);
-    if (bytesRead <= 0) {
-        if (bytesRead == 0) {
-            // No data available, return empty string
-            return "";
-        } else {
-            // Error or connection closed by client
-            throw TCPSocketReceiveError("TCPServer: Error receiving message size, client disconnected");
-        }
-    }
+        std::string_view message(buffer.data() + offset + sizeof(int), messageSize);
+        offset += sizeof(int) + messageSize;
 
-    int messageSize;
-    memcpy(&messageSize, sizeBuffer, sizeof(int));
-
-    std::string receivedData;
-    receivedData.resize(messageSize);
-
-    size_t totalBytesReceived = 0;
-    while (totalBytesReceived < static_cast<size_t>(messageSize)) {
-        bytesRead = recv(clientSocket, &receivedData[totalBytesReceived], messageSize - totalBytesReceived, 0);
-        if (bytesRead <= 0) {
-            if (bytesRead == 0) {
-                // No data available, return empty string
-                return "";
-            } else {
-                // Error or connection closed by client
-                throw TCPSocketReceiveError("TCPServer: Error receiving message data, client disconnected");
-            }
+        if (message == "DISCONNECT") {
+            std::cout << "TCPServer: Client " << connection.socket << " asked to disconnect" << std::endl;
+            connected = false;
+        } else if (!message.empty()) {
+            // Handle received message
+            Mediator::handleMessages(0, message, connection.socket);
         }
-        totalBytesReceived += bytesRead;
-    }
-
-    return receivedData;
-}
-
-bool TCPServer::sendGameProperties(int clientSocket) const {
-    using json = nlohmann::json;
-
-    // Create JSON message
-    json message;
-    message["messageType"] = "gameProperties";
-    Mediator::getGameProperties(message);
-
-    // Add all connected clients to the player list
-    message["players"] = json::array();
-    for (std::vector<Player> players = Mediator::getAlivePlayers(); const auto &player : players) {
-        int playerID = player.getPlayerID();
-        if (playerID == -1) playerID = 0; // The server player has ID 0
-        if (playerID == clientSocket) playerID = -1; // The client itself has ID -1
-
-        // Replace the client socket with -1 for the client itself
-        json playerInfo;
-        playerInfo["playerID"] = playerID;
-        playerInfo["x"] = player.getX();
-        playerInfo["y"] = player.getY();
-        playerInfo["moveX"] = player.getMoveX();
-        playerInfo["moveY"] = player.getMoveY();
-
-        message["players"].push_back(playerInfo);
     }
 
-    return send(clientSocket, message.dump());
+    connection.readBuffer.erase(connection.readBuffer.begin(), connection.readBuffer.begin() + static_cast<ptrdiff_t>(offset));
+    return connected;
 }
 
-bool TCPServer::relayClientConnection(int clientSocket) const {
-    using json = nlohmann::json;
-
-    json message;
-    message["messageType"] = "playerConnect";
-    message["playerID"] = clientSocket;
+bool TCPServer::queueMessage(Connection &connection, std::string_view message) const {
+    // Frame the message with its size, as the clients expect it
+    auto messageSize = static_cast<int>(message.length());
+    connection.writeBuffer.append(reinterpret_cast<const char *>(&messageSize), sizeof(int));
+    connection.writeBuffer.append(message);
 
-    return broadcast(message.dump(), clientSocket);
+    return flushConnection(connection);
 }
 
-bool TCPServer::relayClientDisconnection(int clientSocket) const {
-    using json = nlohmann::json;
-
-    json message;
-    message["messageType"] = "playerDisconnect";
-    message["playerID"] = clientSocket;
-
-    return broadcast(message.dump(), clientSocket);
-}
+bool TCPServer::flushConnection(Connection &connection) const {
+    while (connection.writeOffset < connection.writeBuffer.size()) {
+        ssize_t bytesSent = ::send(connection.socket, connection.writeBuffer.data() + connection.writeOffset, connection.writeBuffer.size() - connection.writeOffset, MSG_NOSIGNAL);
+        if (bytesSent == -1) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) break; // The socket is full, wait for writability
+            if (errno == EINTR) continue;
 
-// Stop the server
-void TCPServer::stop() {
-    // Send a disconnect message to all connected clients
-    if (clientAddressesMutexPtr && clientAddressesMutexPtr->try_lock()) {
-        if (!clientAddressesPtr->empty()) {
-            clientAddressesMutexPtr->unlock();
-            std::cout << "TCPServer: Sending disconnect message to all clients" << std::endl;
-            broadcast("DISCONNECT", 0);
-        } else {
-            clientAddressesMutexPtr->unlock();
+            perror("TCPServer: Error sending message");
+            return false;
         }
+        connection.writeOffset += bytesSent;
     }
 
-    // Stop message handling
-    stopRequested = true;
-    if (socketFileDescriptor != -1) {
-        ::shutdown(socketFileDescriptor, SHUT_RDWR);
-        close(socketFileDescriptor);
-        socketFileDescriptor = -1;
+    if (connection.writeOffset == connection.writeBuffer.size()) {
+        connection.writeBuffer.clear();
+        connection.writeOffset = 0;
+    }
 
-        std::cout << "TCPServer: Server socket closed" << std::endl;
+    // Watch the writability of the socket only while bytes are waiting
+    bool pending = !connection.writeBuffer.empty();
+    if (pending != connection.writing) {
+        epoll_event event = {};
+        event.events = EPOLLIN;
+        if (pending) event.events |= EPOLLOUT;
+        event.data.fd = connection.socket;
+        epoll_ctl(epollFileDescriptor, EPOLL_CTL_MOD, connection.socket, &event);
+        connection.writing = pending;
     }
+
+    return true;
 }
 
 void TCPServer::clearResources() {
-    // Close all client connections (clientAddressPtr)
-    clientAddressesMutexPtr->lock();
-    for (const auto& [clientSocket, _]: *clientAddressesPtr) {
+    // Close all client connections, after a last attempt to send their pending messages
+    std::cout << "TCPServer: Closing all client connections..." << std::endl;
+    connectionsMutex.lock();
+    for (const auto &[clientSocket, connection] : connections) {
+        flushConnection(*connection);
         ::shutdown(clientSocket, SHUT_RDWR);
         close(clientSocket);
     }
+    std::cout << "TCPServer: " << connections.size() << " client connections closed" << std::endl;
+    connections.clear();
+    connectionsMutex.unlock();
+
+    clientAddressesMutexPtr->lock();
     clientAddressesPtr->clear();
     clientAddressesMutexPtr->unlock();
 
-    std::cout << "TCPServer: Closing all client connections..." << std::endl;
-    for (std::jthread& clientThread: clientThreads) {
-        if (clientThread.joinable()) {
-            clientThread.request_stop();
-            clientThread.join();
-        }
-    }
-    std::cout << "TCPServer: " << clientThreads.size() << " client threads stopped" << std::endl;
-
-    clientThreads.clear();
+    close(epollFileDescriptor);
+    close(wakeFileDescriptor);
+    epollFileDescriptor = -1;
+    wakeFileDescriptor = -1;
 }
 
-#endif // !_WIN32
\ No newline at end of file
+#endif // !_WIN32
@@ -66,12 +66,12 @@ void UDPClient::handleMessages() const {
     std::cout << "UDPClient: Stopping message handling" << std::endl;
 }
 
-bool UDPClient::send(const std::string &message) const {
+bool UDPClient::send(std::string_view message) const {
 #ifdef DEVELOPMENT_MODE
-    std::cout << "UDPClient: Sending message: " << message << " (" << message.length() << " bytes) to " << inet_ntoa(serverAddress.sin_addr) << ":" << ntohs(serverAddress.sin_port) << std::endl;
+    std::cout << "UDPClient: Sending message: " << WireProtocol::describe(message) << " (" << message.length() << " bytes) to " << inet_ntoa(serverAddress.sin_addr) << ":" << ntohs(serverAddress.sin_port) << std::endl;
 #endif
 
-    if (sendto(socketFileDescriptor, message.c_str(), message.length(), 0, (const sockaddr*)&serverAddress, sizeof(serverAddress)) == -1) {
+    if (sendto(socketFileDescriptor, message.data(), message.length(), 0, (const sockaddr*)&serverAddress, sizeof(serverAddress)) == -1) {
         perror("UDPClient: Error sending message");
         return false;
     }
@@ -108,8 +108,8 @@ std::string UDPClient::receive(int timeoutMilliseconds) const {
             return "";
         }
 
-        buffer[bytesRead] = '\0'; // Null-terminate the received data
-        return buffer;
+        // Keep every byte, the binary messages contain null bytes
+        return {buffer, static_cast<size_t>(bytesRead)};
     }
 }
 
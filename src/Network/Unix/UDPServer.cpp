@@ -16,7 +16,7 @@ int UDPServer::getSocketFileDescriptor() const {
 
 /** METHODS **/
 
-void UDPServer::initialize(short port) {
+void UDPServer::initialize(unsigned short port) {
     // Create socket
     socketFileDescriptor = socket(AF_INET, SOCK_DGRAM, 0);
     if (socketFileDescriptor == -1) {
@@ -31,6 +31,12 @@ void UDPServer::initialize(short port) {
     if (bind(socketFileDescriptor, (struct sockaddr *) &serverAddr, sizeof(serverAddr)) == -1) {
         throw UDPSocketBindError("UDPServer: Error during bind");
     }
+
+    // The receiving thread waits for the socket or for this eventfd, written when the server stops
+    wakeFileDescriptor = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wakeFileDescriptor == -1) {
+        throw UDPSocketCreationError("UDPServer: Error during eventfd creation");
+    }
 }
 
 void UDPServer::start(std::map<int, sockaddr_in> &clientAddresses, std::mutex &clientAddressesMutex) {
@@ -38,16 +44,18 @@ void UDPServer::start(std::map<int, sockaddr_in> &clientAddresses, std::mutex &c
     clientAddressesMutexPtr = &clientAddressesMutex;
 
     stopRequested = false;
+    clientsByAddress.clear();
     handleMessage();
+    clearResources();
     std::cout << "UDPServer: Server shutdown" << std::endl;
 }
 
-bool UDPServer::send(const sockaddr_in& clientAddress, const std::string &message) const {
+bool UDPServer::send(const sockaddr_in& clientAddress, std::string_view message) const {
 #ifdef DEVELOPMENT_MODE
-    std::cout << "UDPServer: Sending message: " << message << " (" << message.length() << " bytes)" << std::endl;
+    std::cout << "UDPServer: Sending message: " << WireProtocol::describe(message) << " (" << message.length() << " bytes)" << std::endl;
 #endif
 
-    if (sendto(socketFileDescriptor, message.c_str(), message.length(), 0, (const sockaddr*)&clientAddress, sizeof(clientAddress)) == -1) {
+    if (sendto(socketFileDescriptor, message.data(), message.length(), 0, (const sockaddr*)&clientAddress, sizeof(clientAddress)) == -1) {
         perror("UDPServer: Error sending message");
         return false;
     }
@@ -55,86 +63,63 @@ bool UDPServer::send(const sockaddr_in& clientAddress, const std::string &messag
     return true;
 }
 
-bool UDPServer::broadcast(const std::string &message, int socketIgnored) const {
+bool UDPServer::broadcast(std::string_view message, int socketIgnored) const {
 #ifdef DEVELOPMENT_MODE
-    std::cout << "UDPServer: Broadcasting message: " << message << " (" << message.length() << " bytes)" << std::endl;
+    std::cout << "UDPServer: Broadcasting message: " << WireProtocol::describe(message) << " (" << message.length() << " bytes)" << std::endl;
 #endif
 
-    clientAddressesMutexPtr->lock();
+    // Every datagram of the batch points to the same message
+    iovec messageVector = {const_cast<char *>(message.data()), message.length()};
+    std::array<mmsghdr, BATCH_SIZE> messages = {};
+    std::array<sockaddr_in, BATCH_SIZE> addresses = {};
+    size_t count = 0;
+    bool success = true;
+
+    std::scoped_lock<std::mutex> lock(*clientAddressesMutexPtr);
     for (const auto& [id, address] : *clientAddressesPtr) {
         if (id == socketIgnored) continue;
-        if (!send(address, message)) {
-            clientAddressesMutexPtr->unlock();
-
-            return false;
-        }
-    }
-    clientAddressesMutexPtr->unlock();
 
-    return true; // Placeholder
-}
+        addresses[count] = address;
+        messages[count].msg_hdr = {};
+        messages[count].msg_hdr.msg_name = &addresses[count];
+        messages[count].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+        messages[count].msg_hdr.msg_iov = &messageVector;
+        messages[count].msg_hdr.msg_iovlen = 1;
 
-std::string UDPServer::receive(sockaddr_in& clientAddress, int timeoutMilliseconds) const {
-    char buffer[1024];
-    socklen_t clientLen = sizeof(clientAddress);
-
-    fd_set readSet;
-    FD_ZERO(&readSet);
-    FD_SET(socketFileDescriptor, &readSet);
-
-    // Specify timeout
-    struct timeval timeout = {};
-    timeout.tv_sec = timeoutMilliseconds / 1000;
-    timeout.tv_usec = (timeoutMilliseconds % 1000) * 1000;
-
-    // Wait until data is available or timeout expires
-    int ready = select(socketFileDescriptor + 1, &readSet, nullptr, nullptr, &timeout);
-    if (ready == -1) {
-        perror("UDPServer: Error in select()");
-        return "";
-    } else if (ready == 0) {
-        // No data available within the specified timeout, return an empty string
-        return "";
-    } else {
-        // Data is available for reading, receive the data
-        ssize_t bytesRead = recvfrom(socketFileDescriptor, buffer, sizeof(buffer), 0, (sockaddr*)&clientAddress, &clientLen);
-        if (bytesRead == -1) {
-            if(!stopRequested) perror("UDPServer: Error receiving message");
-            return "";
+        if (++count == BATCH_SIZE) {
+            success = sendBatch(std::span(messages.data(), count)) && success;
+            count = 0;
         }
-
-        buffer[bytesRead] = '\0'; // Null-terminate the received data
-        return buffer;
     }
+    if (count > 0) success = sendBatch(std::span(messages.data(), count)) && success;
+
+    return success;
 }
 
 void UDPServer::handleMessage() {
     std::cout << "UDPServer: Handling incoming messages..." << std::endl;
 
+    std::array<mmsghdr, BATCH_SIZE> messages = {};
+    std::array<sockaddr_in, BATCH_SIZE> addresses = {};
+    std::array<int, BATCH_SIZE> clientIDs = {};
+
     while (!stopRequested && socketFileDescriptor != -1) {
-        // Receive message with timeout
-        struct sockaddr_in clientAddress;
-        std::string message = receive(clientAddress, 200); // 1 second timeout
-
-        // Handle the received message
-        if (!message.empty()) {
-            // Identify the client with the address (find)
-            clientAddressesMutexPtr->lock();
-            int clientID = -1;
-            for (const auto& [id, address] : *clientAddressesPtr) {
-                if (address.sin_addr.s_addr == clientAddress.sin_addr.s_addr && address.sin_port == clientAddress.sin_port) {
-                    clientID = id;
-                    break;
-                }
-            }
-            clientAddressesMutexPtr->unlock();
+        // Receive every datagram available, then identify their senders at once
+        int count = receiveBatch(messages, addresses);
+        if (count <= 0) continue;
+        resolveClients(std::span(addresses.data(), count), std::span(clientIDs.data(), count));
+
+        for (int i = 0; i < count; i++) {
+            // Drop the datagrams larger than the buffer, they are truncated
+            if (messages[i].msg_hdr.msg_flags & MSG_TRUNC) continue;
+            std::string_view message(receiveBuffers[i].data(), messages[i].msg_len);
 
-            if (clientID != -1) {
+            if (clientIDs[i] != -1) {
                 // Handle received message
-                Mediator::handleMessages(1, message, clientID);
+                Mediator::handleMessages(1, message, clientIDs[i]);
             } else {
             #ifdef DEVELOPMENT_MODE
-                std::cout << "UDPServer: Received message: " << message << " from unknown client" << std::endl;
+                std::cout << "UDPServer: Received message: " << WireProtocol::describe(message) << " from unknown client" << std::endl;
             #endif
             }
         }
@@ -143,33 +128,125 @@ void UDPServer::handleMessage() {
     std::cout << "UDPServer: Stopping message handling" << std::endl;
 }
 
-bool UDPServer::sendSyncCorrection(int clientSocket, sockaddr_in address, nlohmann::json &message) const {
-    using json = nlohmann::json;
+int UDPServer::receiveBatch(std::span<mmsghdr, BATCH_SIZE> messages, std::span<sockaddr_in, BATCH_SIZE> addresses) {
+    // Wait until a datagram is available or the server stops (no timeout)
+    std::array<pollfd, 2> pollFileDescriptors = {{
+        {socketFileDescriptor, POLLIN, 0},
+        {wakeFileDescriptor, POLLIN, 0}
+    }};
+    if (poll(pollFileDescriptors.data(), pollFileDescriptors.size(), -1) == -1) {
+        if (errno != EINTR) perror("UDPServer: Error in poll()");
+        return 0;
+    }
+    if (pollFileDescriptors[1].revents != 0 || stopRequested) return 0;
+
+    // The headers are reset, the kernel overwrites the address length and the flags
+    std::array<iovec, BATCH_SIZE> vectors = {};
+    for (size_t i = 0; i < BATCH_SIZE; i++) {
+        vectors[i] = {receiveBuffers[i].data(), receiveBuffers[i].size()};
+        messages[i].msg_hdr = {};
+        messages[i].msg_hdr.msg_name = &addresses[i];
+        messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+        messages[i].msg_hdr.msg_iov = &vectors[i];
+        messages[i].msg_hdr.msg_iovlen = 1;
+        messages[i].msg_len = 0;
+    }
+
+    int count = recvmmsg(socketFileDescriptor, messages.data(), BATCH_SIZE, MSG_DONTWAIT, nullptr);
+    if (count == -1) {
+        if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR && !stopRequested) perror("UDPServer: Error receiving messages");
+        return 0;
+    }
+
+    return count;
+}
+
+void UDPServer::resolveClients(std::span<const sockaddr_in> addresses, std::span<int> clientIDs) {
+    std::scoped_lock<std::mutex> lock(*clientAddressesMutexPtr);
 
-    // Add each player's position and movement to the message
-    message["players"] = json::array();
+    for (size_t i = 0; i < addresses.size(); i++) {
+        uint64_t key = getAddressKey(addresses[i]);
 
-    for (const Player &player : Mediator::getAlivePlayers()) {
-        json playerData;
+        // A known address is valid while its client is still connected with it
+        auto it = clientsByAddress.find(key);
+        if (it != clientsByAddress.end()) {
+            auto client = clientAddressesPtr->find(it->second);
+            if (client != clientAddressesPtr->end() && getAddressKey(client->second) == key) {
+                clientIDs[i] = it->second;
+                continue;
+            }
+            clientsByAddress.erase(it);
+        }
 
-        int playerID = player.getPlayerID();
-        if (playerID == -1) playerID = 0; // The server player has ID 0
-        if (playerID == clientSocket) playerID = -1; // The client itself has ID -1
+        // A new address is searched once in the connected clients
+        clientIDs[i] = -1;
+        for (const auto& [id, address] : *clientAddressesPtr) {
+            if (getAddressKey(address) == key) {
+                clientIDs[i] = id;
+                clientsByAddress.emplace(key, id);
+                break;
+            }
+        }
+    }
+}
 
-        playerData["playerID"] = playerID;
-        playerData["x"] = player.getX();
-        playerData["y"] = player.getY();
-        playerData["moveX"] = player.getMoveX();
-        playerData["moveY"] = player.getMoveY();
-        message["players"].push_back(playerData);
+bool UDPServer::sendBatch(std::span<mmsghdr> messages) const {
+    size_t sent = 0;
+    bool success = true;
+    while (sent < messages.size()) {
+        int count = sendmmsg(socketFileDescriptor, messages.data() + sent, static_cast<unsigned int>(messages.size() - sent), 0);
+        if (count == -1) {
+            if (errno == EINTR) continue;
+
+            // The error belongs to the first datagram left, skip it so the other clients still receive theirs
+            perror("UDPServer: Error sending messages");
+            success = false;
+            sent += 1;
+            continue;
+        }
+        sent += count;
     }
 
-    return send(address, message.dump());
+    return success;
 }
 
-// Stop the server
+uint64_t UDPServer::getAddressKey(const sockaddr_in &address) {
+    return (static_cast<uint64_t>(address.sin_addr.s_addr) << 16) | address.sin_port;
+}
+
+bool UDPServer::sendSyncCorrection(int clientSocket, sockaddr_in address, uint16_t sequence, int32_t baseline, int32_t processedInput, std::string_view delta) const {
+    std::array<char, WireProtocol::MAX_MESSAGE_SIZE> buffer;
+    WireWriter writer(buffer);
+    writer.writeHeader(MessageID::SYNC_CORRECTION);
+    writer.writeU16(sequence);
+    writer.writeU16(static_cast<uint16_t>(baseline == SnapshotManager::NO_BASELINE ? 0 : baseline));
+    writer.writeU8(baseline != SnapshotManager::NO_BASELINE);
+    writer.writeI32(clientSocket); // The client finds itself in the players with its ID
+    writer.writeU16(static_cast<uint16_t>(processedInput == PredictionManager::NO_INPUT ? 0 : processedInput));
+    writer.writeU8(processedInput != PredictionManager::NO_INPUT);
+    writer.writeBytes(delta);
+
+    if (!writer.isValid()) {
+        std::cerr << "UDPServer: Sync correction too large for a datagram" << std::endl;
+        return false;
+    }
+
+    return send(address, writer.getMessage());
+}
+
+// Stop the server, the receiving thread closes the socket once it leaves its loop
 void UDPServer::stop() {
     stopRequested = true;
+
+    // Wake the receiving thread
+    if (wakeFileDescriptor != -1) {
+        uint64_t value = 1;
+        if (write(wakeFileDescriptor, &value, sizeof(value)) == -1) perror("UDPServer: Error waking the receiving thread");
+    }
+}
+
+void UDPServer::clearResources() {
+    // The receiving thread has stopped polling the socket, it can be closed
     if (socketFileDescriptor != -1) {
         ::shutdown(socketFileDescriptor, SHUT_RDWR);
         close(socketFileDescriptor);
@@ -177,6 +254,9 @@ void UDPServer::stop() {
 
         std::cout << "UDPServer: Server socket closed" << std::endl;
     }
+
+    close(wakeFileDescriptor);
+    wakeFileDescriptor = -1;
 }
 
 #endif // _WIN32
\ No newline at end of file
@@ -90,9 +90,9 @@ void TCPClient::handleMessages() {
     std::cout << "TCPClient: Stopping message handling" << std::endl;
 }
 
-bool TCPClient::send(const std::string &message) const {
+bool TCPClient::send(std::string_view message) const {
 #ifdef DEVELOPMENT_MODE
-    std::cout << "TCPClient: Sending message: " << message << " (" << message.length() << " bytes) to server (socket " << socketFileDescriptor << ")" << std::endl;
+    std::cout << "TCPClient: Sending message: " << WireProtocol::describe(message) << " (" << message.length() << " bytes) to server (socket " << socketFileDescriptor << ")" << std::endl;
 #endif
 
     // First, send the size of the message
@@ -103,7 +103,7 @@ bool TCPClient::send(const std::string &message) const {
     }
 
     // Then, send the message itself
-    const char *messagePtr = message.c_str();
+    const char *messagePtr = message.data();
     int totalBytesSent = 0;
     while (totalBytesSent < messageSize) {
         int bytesSent = ::send(socketFileDescriptor, messagePtr + totalBytesSent, messageSize - totalBytesSent, 0);
@@ -38,7 +38,7 @@ SOCKET TCPServer::getSocketFileDescriptor() const {
 /** METHODS **/
 
 // Initialize the server with a specified port
-void TCPServer::initialize(short port) {
+void TCPServer::initialize(unsigned short port) {
     // Create socket
     socketFileDescriptor = socket(AF_INET, SOCK_STREAM, 0);
     if (socketFileDescriptor == INVALID_SOCKET) {
@@ -173,9 +173,9 @@ void TCPServer::handleMessage(SOCKET clientSocket) {
 }
 
 // Send a message to a client
-bool TCPServer::send(SOCKET clientSocket, const std::string &message) const {
+bool TCPServer::send(SOCKET clientSocket, std::string_view message) const {
 #ifdef DEVELOPMENT_MODE
-    std::cout << "TCPServer: Sending message: " << message << " (" << message.length() << " bytes) to client " << clientSocket << std::endl;
+    std::cout << "TCPServer: Sending message: " << WireProtocol::describe(message) << " (" << message.length() << " bytes) to client " << clientSocket << std::endl;
 #endif
 
     // First, send the size of the message
@@ -186,7 +186,7 @@ bool TCPServer::send(SOCKET clientSocket, const std::string &message) const {
     }
 
     // Then, send the message itself
-    const char *messagePtr = message.c_str();
+    const char *messagePtr = message.data();
     int totalBytesSent = 0;
     while (totalBytesSent < messageSize) {
         int bytesSent = ::send(clientSocket, messagePtr + totalBytesSent, static_cast<int>(messageSize - totalBytesSent), 0);
@@ -201,10 +201,10 @@ bool TCPServer::send(SOCKET clientSocket, const std::string &message) const {
 }
 
 // Broadcast a message to all connected clients
-bool TCPServer::broadcast(const std::string &message, SOCKET socketIgnored) const {
+bool TCPServer::broadcast(std::string_view message, SOCKET socketIgnored) const {
     clientAddressesMutexPtr->lock();
 #ifdef DEVELOPMENT_MODE
-    std::cout << "TCPServer: Broadcasting message: " << message << " (" << message.length() << " bytes) to " << clientAddressesPtr->size() << " clients" << std::endl;
+    std::cout << "TCPServer: Broadcasting message: " << WireProtocol::describe(message) << " (" << message.length() << " bytes) to " << clientAddressesPtr->size() << " clients" << std::endl;
 #endif
 
     auto send_successful = std::ranges::all_of(*clientAddressesPtr, [&](const auto& client) {
@@ -275,7 +275,7 @@ bool TCPServer::sendGameProperties(SOCKET clientSocket) const {
 
     // Add all connected clients to the player list
     message["players"] = json::array();
-    for (std::vector<Player> players = Mediator::getAlivePlayers(); const auto &player : players) {
+    for (const Player &player : Mediator::getAlivePlayers()) {
         int playerID = player.getPlayerID();
         if (playerID == -1) playerID = 0; // The server player has ID 0
         if (playerID == static_cast<int>(clientSocket)) playerID = -1; // The client itself has ID -1
@@ -296,23 +296,21 @@ bool TCPServer::sendGameProperties(SOCKET clientSocket) const {
 
 
 bool TCPServer::relayClientConnection(SOCKET clientSocket) const {
-    using json = nlohmann::json;
-
-    json message;
-    message["messageType"] = "playerConnect";
-    message["playerID"] = clientSocket;
+    std::array<char, WireProtocol::getSize(MessageID::PLAYER_CONNECT)> buffer;
+    WireWriter writer(buffer);
+    writer.writeHeader(MessageID::PLAYER_CONNECT);
+    writer.writeI32(static_cast<int32_t>(clientSocket));
 
-    return broadcast(message.dump(), clientSocket);
+    return broadcast(writer.getMessage(), clientSocket);
 }
 
 bool TCPServer::relayClientDisconnection(SOCKET clientSocket) const {
-    using json = nlohmann::json;
-
-    json message;
-    message["messageType"] = "playerDisconnect";
-    message["playerID"] = clientSocket;
+    std::array<char, WireProtocol::getSize(MessageID::PLAYER_DISCONNECT)> buffer;
+    WireWriter writer(buffer);
+    writer.writeHeader(MessageID::PLAYER_DISCONNECT);
+    writer.writeI32(static_cast<int32_t>(clientSocket));
 
-    return broadcast(message.dump(), clientSocket);
+    return broadcast(writer.getMessage(), clientSocket);
 }
 
 // Stop the server
@@ -67,12 +67,12 @@ void UDPClient::handleMessages() const {
     std::cout << "UDPClient: Stopping message handling" << std::endl;
 }
 
-bool UDPClient::send(const std::string &message) const {
+bool UDPClient::send(std::string_view message) const {
 #ifdef DEVELOPMENT_MODE
-    std::cout << "UDPClient: Sending message: " << message << " (" << message.length() << " bytes) to " << inet_ntoa(serverAddress.sin_addr) << ":" << ntohs(serverAddress.sin_port) << std::endl;
+    std::cout << "UDPClient: Sending message: " << WireProtocol::describe(message) << " (" << message.length() << " bytes) to " << inet_ntoa(serverAddress.sin_addr) << ":" << ntohs(serverAddress.sin_port) << std::endl;
 #endif
 
-    if (sendto(socketFileDescriptor, message.c_str(), static_cast<int>(message.length()), 0, (const sockaddr*)&serverAddress, sizeof(serverAddress)) == -1) {
+    if (sendto(socketFileDescriptor, message.data(), static_cast<int>(message.length()), 0, (const sockaddr*)&serverAddress, sizeof(serverAddress)) == -1) {
         std::cerr << "UDPClient: Error sending message: " << WSAGetLastError() << std::endl;
         return false;
     }
@@ -109,8 +109,8 @@ std::string UDPClient::receive(int timeoutMilliseconds) const {
             return "";
         }
 
-        buffer[bytesRead] = '\0'; // Null-terminate the received data
-        return buffer;
+        // Keep every byte, the binary messages contain null bytes
+        return {buffer, static_cast<size_t>(bytesRead)};
     }
 }
 
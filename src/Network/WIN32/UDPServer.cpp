@@ -16,7 +16,7 @@ SOCKET UDPServer::getSocketFileDescriptor() const {
 
 /** METHODS **/
 
-void UDPServer::initialize(short port) {
+void UDPServer::initialize(unsigned short port) {
     // Create socket
     socketFileDescriptor = socket(AF_INET, SOCK_DGRAM, 0);
     if (socketFileDescriptor == INVALID_SOCKET) {
@@ -42,12 +42,12 @@ void UDPServer::start(std::map<SOCKET, sockaddr_in> &clientAddresses, std::mutex
     std::cout << "UDPServer: Server shutdown" << std::endl;
 }
 
-bool UDPServer::send(const sockaddr_in& clientAddress, const std::string &message) const {
+bool UDPServer::send(const sockaddr_in& clientAddress, std::string_view message) const {
 #ifdef DEVELOPMENT_MODE
-    std::cout << "UDPServer: Sending message: " << message << " (" << message.length() << " bytes)" << std::endl;
+    std::cout << "UDPServer: Sending message: " << WireProtocol::describe(message) << " (" << message.length() << " bytes)" << std::endl;
 #endif
 
-    if (sendto(socketFileDescriptor, message.c_str(), static_cast<int>(message.length()), 0, (const sockaddr*)&clientAddress, sizeof(clientAddress)) == -1) {
+    if (sendto(socketFileDescriptor, message.data(), static_cast<int>(message.length()), 0, (const sockaddr*)&clientAddress, sizeof(clientAddress)) == -1) {
         std::cerr << "UDPServer: Error sending message: " << WSAGetLastError() << std::endl;
         return false;
     }
@@ -55,9 +55,9 @@ bool UDPServer::send(const sockaddr_in& clientAddress, const std::string &messag
     return true;
 }
 
-bool UDPServer::broadcast(const std::string &message, SOCKET socketIgnored) const {
+bool UDPServer::broadcast(std::string_view message, SOCKET socketIgnored) const {
 #ifdef DEVELOPMENT_MODE
-    std::cout << "UDPServer: Broadcasting message: " << message << " (" << message.length() << " bytes)" << std::endl;
+    std::cout << "UDPServer: Broadcasting message: " << WireProtocol::describe(message) << " (" << message.length() << " bytes)" << std::endl;
 #endif
 
     clientAddressesMutexPtr->lock();
@@ -103,8 +103,8 @@ std::string UDPServer::receive(sockaddr_in& clientAddress, int timeoutMillisecon
             return "";
         }
 
-        buffer[bytesRead] = '\0'; // Null-terminate the received data
-        return buffer;
+        // Keep every byte, the binary messages contain null bytes
+        return {buffer, static_cast<size_t>(bytesRead)};
     }
 }
 
@@ -134,7 +134,7 @@ void UDPServer::handleMessage() {
                 Mediator::handleMessages(1, message, static_cast<int>(clientID));
             } else {
         #ifdef DEVELOPMENT_MODE
-                std::cout << "UDPServer: Received message: " << message << " from unknown client" << std::endl;
+                std::cout << "UDPServer: Received message: " << WireProtocol::describe(message) << " from unknown client" << std::endl;
         #endif
             }
         }
@@ -143,29 +143,24 @@ void UDPServer::handleMessage() {
     std::cout << "UDPServer: Stopping message handling" << std::endl;
 }
 
-bool UDPServer::sendSyncCorrection(int clientSocket, sockaddr_in address, nlohmann::json &message) const {
-    using json = nlohmann::json;
-
-    // Add each player's position and movement to the message
-    message["players"] = json::array();
-
-    for (const Player &player : Mediator::getAlivePlayers()) {
-        json playerData;
-
-        int playerID = player.getPlayerID();
-        if (playerID == -1) playerID = 0; // The server player has ID 0
-        if (playerID == clientSocket) playerID = -1; // The client itself has ID -1
-
-        playerData["playerID"] = playerID;
-        playerData["x"] = player.getX();
-        playerData["y"] = player.getY();
-        playerData["moveX"] = player.getMoveX();
-        playerData["moveY"] = player.getMoveY();
-        message["players"].push_back(playerData);
+bool UDPServer::sendSyncCorrection(int clientSocket, sockaddr_in address, uint16_t sequence, int32_t baseline, int32_t processedInput, std::string_view delta) const {
+    std::array<char, WireProtocol::MAX_MESSAGE_SIZE> buffer;
+    WireWriter writer(buffer);
+    writer.writeHeader(MessageID::SYNC_CORRECTION);
+    writer.writeU16(sequence);
+    writer.writeU16(static_cast<uint16_t>(baseline == SnapshotManager::NO_BASELINE ? 0 : baseline));
+    writer.writeU8(baseline != SnapshotManager::NO_BASELINE);
+    writer.writeI32(clientSocket); // The client finds itself in the players with its ID
+    writer.writeU16(static_cast<uint16_t>(processedInput == PredictionManager::NO_INPUT ? 0 : processedInput));
+    writer.writeU8(processedInput != PredictionManager::NO_INPUT);
+    writer.writeBytes(delta);
+
+    if (!writer.isValid()) {
+        std::cerr << "UDPServer: Sync correction too large for a datagram" << std::endl;
+        return false;
     }
 
-    std::cout << message.dump() << std::endl;
-    return send(address, message.dump());
+    return send(address, writer.getMessage());
 }
 
 // Stop the server
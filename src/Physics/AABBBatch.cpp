@@ -0,0 +1,98 @@
+#include "../../include/Physics/AABBBatch.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define PLAY_TOGETHER_AABBBATCH_SSE2
+#endif
+
+/**
+ * @file AABBBatch.cpp
+ * @brief Implements the AABBBatch class storing rectangles as a structure of arrays for batched overlap tests.
+ */
+
+
+/* ACCESSORS */
+
+size_t AABBBatch::size() const {
+    return minX.size();
+}
+
+
+/* METHODS */
+
+void AABBBatch::clear() {
+    minX.clear();
+    minY.clear();
+    maxX.clear();
+    maxY.clear();
+}
+
+void AABBBatch::push(const SDL_FRect &rect) {
+    minX.push_back(rect.x);
+    minY.push_back(rect.y);
+    maxX.push_back(rect.x + rect.w);
+    maxY.push_back(rect.y + rect.h);
+}
+
+void AABBBatch::query(const SDL_FRect &box, std::vector<size_t> &result) const {
+    result.clear();
+
+    const float box_min_x = box.x;
+    const float box_min_y = box.y;
+    const float box_max_x = box.x + box.w;
+    const float box_max_y = box.y + box.h;
+
+    const size_t count = size();
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    const __m256 query_min_x = _mm256_set1_ps(box_min_x);
+    const __m256 query_min_y = _mm256_set1_ps(box_min_y);
+    const __m256 query_max_x = _mm256_set1_ps(box_max_x);
+    const __m256 query_max_y = _mm256_set1_ps(box_max_y);
+
+    // Test 8 rectangles at a time
+    for (; i + 8 <= count; i += 8) {
+        __m256 overlap_x = _mm256_and_ps(_mm256_cmp_ps(query_min_x, _mm256_loadu_ps(&maxX[i]), _CMP_LT_OQ),
+                                         _mm256_cmp_ps(query_max_x, _mm256_loadu_ps(&minX[i]), _CMP_GT_OQ));
+        __m256 overlap_y = _mm256_and_ps(_mm256_cmp_ps(query_min_y, _mm256_loadu_ps(&maxY[i]), _CMP_LT_OQ),
+                                         _mm256_cmp_ps(query_max_y, _mm256_loadu_ps(&minY[i]), _CMP_GT_OQ));
+
+        // One bit per rectangle, extract the index of each set bit
+        auto mask = static_cast<unsigned>(_mm256_movemask_ps(_mm256_and_ps(overlap_x, overlap_y)));
+        while (mask != 0) {
+            result.push_back(i + std::countr_zero(mask));
+            mask &= mask - 1;
+        }
+    }
+#elif defined(PLAY_TOGETHER_AABBBATCH_SSE2)
+    const __m128 query_min_x = _mm_set1_ps(box_min_x);
+    const __m128 query_min_y = _mm_set1_ps(box_min_y);
+    const __m128 query_max_x = _mm_set1_ps(box_max_x);
+    const __m128 query_max_y = _mm_set1_ps(box_max_y);
+
+    // Test 4 rectangles at a time
+    for (; i + 4 <= count; i += 4) {
+        __m128 overlap_x = _mm_and_ps(_mm_cmplt_ps(query_min_x, _mm_loadu_ps(&maxX[i])),
+                                      _mm_cmpgt_ps(query_max_x, _mm_loadu_ps(&minX[i])));
+        __m128 overlap_y = _mm_and_ps(_mm_cmplt_ps(query_min_y, _mm_loadu_ps(&maxY[i])),
+                                      _mm_cmpgt_ps(query_max_y, _mm_loadu_ps(&minY[i])));
+
+        // One bit per rectangle, extract the index of each set bit
+        auto mask = static_cast<unsigned>(_mm_movemask_ps(_mm_and_ps(overlap_x, overlap_y)));
+        while (mask != 0) {
+            result.push_back(i + std::countr_zero(mask));
+            mask &= mask - 1;
+        }
+    }
+#endif
+
+    // Scalar fallback and remaining rectangles
+    for (; i < count; i++) {
+        if (box_min_x < maxX[i] && box_max_x > minX[i] && box_min_y < maxY[i] && box_max_y > minY[i]) {
+            result.push_back(i);
+        }
+    }
+}
@@ -13,34 +13,29 @@ bool checkAABBCollision(const SDL_FRect &a, const SDL_FRect &b) {
             a.y + a.h > b.y);
 }
 
-bool checkSATCollision(const std::vector<Point> &playerVertices, const Polygon &obstacle) {
-    // Check for convexity of the obstacle
+/**
+ * @brief SAT kernel shared by the vector and the quad overloads.
+ * @param playerVertices The vertices of the player object.
+ * @param obstacle The polygon obstacle.
+ * @return True if a collision is detected, false otherwise.
+ */
+static bool checkSATCollision(std::span<const Point> playerVertices, const Polygon &obstacle) {
+    // Check for convexity of the obstacle (cached when the polygon is built)
     if (!obstacle.isConvex()) {
         printf("The obstacle is not convex\n");
         return false;
     }
 
-    // Potential separation axes (normals to the sides of the rectangle)
-    std::vector<Point> axes = {
-            {1, 0},
-            {0, 1}
-    };
-
-    // Add axes perpendicular to the sides of the polygon
-    for (size_t i = 0; i < obstacle.getVertices().size(); ++i) {
-        std::vector<Point> vertices = obstacle.getVertices();
-        const Point &vertex1 = vertices[i];
-        const Point &vertex2 = vertices[(i + 1) % vertices.size()];
-
-        Point edge = {vertex2.x - vertex1.x, vertex2.y - vertex1.y};
-        Point axis = {-edge.y, edge.x};
-        axes.push_back(axis);
-    }
+    // The axes and the projections of the obstacle are precomputed, only the player has to be projected
+    const std::vector<Point> &axes = obstacle.getAxes();
+    const std::vector<Projection> &obstacleProjections = obstacle.getProjections();
+
+    for (size_t i = 0; i < axes.size(); ++i) {
+        const Point &axis = axes[i];
 
-    for (Point axis: axes) {
-        // Project the rectangle and the polygon onto the axis
-        auto playerProjectionMin = static_cast<float>(std::numeric_limits<int>::max());
-        auto playerProjectionMax = static_cast<float>(std::numeric_limits<int>::min());
+        // Project the rectangle onto the axis
+        float playerProjectionMin = std::numeric_limits<float>::max();
+        float playerProjectionMax = std::numeric_limits<float>::lowest();
 
         for (const Point &vertex: playerVertices) {
             float projection = vertex.x * axis.x + vertex.y * axis.y;
@@ -48,17 +43,8 @@ bool checkSATCollision(const std::vector<Point> &playerVertices, const Polygon &
             playerProjectionMax = std::max(playerProjectionMax, projection);
         }
 
-        auto obstacleProjectionMin = static_cast<float>(std::numeric_limits<int>::max());
-        auto obstacleProjectionMax = static_cast<float>(std::numeric_limits<int>::min());
-
-        for (const Point &vertex: obstacle.getVertices()) {
-            float projection = vertex.x * axis.x + vertex.y * axis.y;
-            obstacleProjectionMin = std::min(obstacleProjectionMin, projection);
-            obstacleProjectionMax = std::max(obstacleProjectionMax, projection);
-        }
-
         // Check for separation on the axis
-        if (playerProjectionMax < obstacleProjectionMin || obstacleProjectionMax < playerProjectionMin) {
+        if (playerProjectionMax < obstacleProjections[i].min || obstacleProjections[i].max < playerProjectionMin) {
             return false; // No collision detected
         }
     }
@@ -66,346 +52,114 @@ bool checkSATCollision(const std::vector<Point> &playerVertices, const Polygon &
     return true; // Collision detected
 }
 
-static bool checkAABBCollisionTunnelingOnXAxis(Player *player, const SDL_FRect &obstacle) {
-
-    // Initialization
-    float x = player->getX();
-    float y = player->getY();
-    float w = player->getW();
-    float h = player->getH();
-    float move = player->getMoveX();
-    bool direction = player->getDirectionX() == 1;
-
-    SDL_FRect playerBoundingBox = {x + move, y, w, h};
-
-    // Direction on x-axis is right
-    if (direction) {
-        // Check for collisions along the player's entire route to avoid tunneling effect
-        while (move > 0 && !checkAABBCollision(playerBoundingBox, obstacle)) {
-            move -= w;
-            playerBoundingBox = {x + move, y, w, h};
-        }
-    }
-    // Direction on x-axis is left
-    else {
-        // Check for collisions along the player's entire route to avoid tunneling effect
-        while (move < 0 && !checkAABBCollision(playerBoundingBox, obstacle)) {
-            move += w;
-            playerBoundingBox = {x + move, y, w, h};
-        }
-    }
-
-    // Check if a collision has been detected in the loop
-    if ((direction && move > 0) || (!direction && move < 0)) {
-        player->setMoveX(move); // Set moveX inside the collision
-        return true;
-    } else {
-        return false;
-    }
+bool checkSATCollision(const std::vector<Point> &playerVertices, const Polygon &obstacle) {
+    return checkSATCollision(std::span<const Point>(playerVertices), obstacle);
 }
 
-static bool checkAABBCollisionTunnelingOnYAxis(Player *player, const SDL_FRect &obstacle) {
-
-    // Initialization
-    float x = player->getX();
-    float y = player->getY();
-    float w = player->getW();
-    float h = player->getH();
-    float move = player->getMoveY();
-    bool direction = player->getDirectionY() == 1;
-
-    SDL_FRect playerBoundingBox = {x, y + move, w, h};
-
-    // Direction on y-axis is down
-    if (direction) {
-        // Check for collisions along the player's entire route to avoid tunneling effect
-        while (move > 0 && !checkAABBCollision(playerBoundingBox, obstacle)) {
-            move -= h;
-            playerBoundingBox = {x, y + move, w, h};
-        }
-    }
-    // Direction on y-axis is up
-    else {
-        // Check for collisions along the player's entire route to avoid tunneling effect
-        while (move < 0 && !checkAABBCollision(playerBoundingBox, obstacle)) {
-            move += h;
-            playerBoundingBox = {x, y + move, w, h};
-        }
-    }
-
-    // Check if a collision has been detected in the loop
-    if ((direction && move > 0) || (!direction && move < 0)) {
-        player->setMoveY(move); // Set moveY inside the collision
-        return true;
-    } else {
-        return false;
-    }
+bool checkSATCollision(const Quad &playerVertices, const Polygon &obstacle) {
+    return checkSATCollision(std::span<const Point>(playerVertices), obstacle);
 }
 
-static bool checkAABBCollisionTunnelingOnBothAxis(Player *player, const SDL_FRect &obstacle) {
-
-    // Initialization
-    float x = player->getX();
-    float y = player->getY();
-    float w = player->getW();
-    float h = player->getH();
-    float moveX = player->getMoveX();
-    float moveY = player->getMoveY();
-    bool directionX = player->getDirectionX() == 1; // True for right, false for left
-
-    float addX; // Value that will be added to moveX at each iteration
-    float addY; // Value that will be added to moveY at each iteration
-    float add = w < h ? w : h; // Select the player's shortest side
-
-    // Create a ratio between moveX and moveY so they increment proportionally
-    float ratio = std::abs(moveX / moveY);
-    if (ratio > 1) {
-        addX = add;
-        addY = add / ratio;
-    }
-    else {
-        addX = add * ratio;
-        addY = add;
+/**
+ * @brief Narrow the time interval during which two moving projections overlap on one axis.
+ * @param boxMin The minimum of the moving box projection at the start of the move.
+ * @param boxMax The maximum of the moving box projection at the start of the move.
+ * @param velocity The projection of the move onto the axis.
+ * @param obstacleMin The minimum of the obstacle projection.
+ * @param obstacleMax The maximum of the obstacle projection.
+ * @param[in,out] entry The time at which the projections start to overlap on every axis tested so far.
+ * @param[in,out] exit The time at which the projections stop to overlap on one of the axes tested so far.
+ * @return False if the projections never overlap on this axis, true otherwise.
+ */
+static bool narrowSweptInterval(float boxMin, float boxMax, float velocity, float obstacleMin, float obstacleMax, float &entry, float &exit) {
+    // No motion on this axis: the projections overlap either always or never
+    if (velocity == 0) {
+        return boxMax > obstacleMin && obstacleMax > boxMin;
     }
 
-    // Choose whether to add or subtract the value according to direction
-    if (directionX == 1) addX *= -1;
-    if (player->getDirectionY() == 1) addY *= -1;
-
-    SDL_FRect playerBoundingBox = {x + moveX, y + moveY, w, h};
-
-    // The x-axis direction is right
-    if (directionX) {
-        // Check for collisions along the player's entire route to avoid tunneling effect
-        while (moveX > 0 && !checkAABBCollision(playerBoundingBox, obstacle)) {
-            moveX += addX;
-            moveY += addY;
-            playerBoundingBox = {x + moveX, y + moveY, w, h};
-        }
-    }
-    // The x-axis direction is left
-    else {
-        // Check for collisions along the player's entire route to avoid tunneling effect
-        while (moveX < 0 && !checkAABBCollision(playerBoundingBox, obstacle)) {
-            moveX += addX;
-            moveY += addY;
-            playerBoundingBox = {x + moveX, y + moveY, w, h};
-        }
-    }
+    // Times at which the leading and the trailing sides cross the obstacle
+    float axis_entry = (velocity > 0 ? obstacleMin - boxMax : obstacleMax - boxMin) / velocity;
+    float axis_exit = (velocity > 0 ? obstacleMax - boxMin : obstacleMin - boxMax) / velocity;
 
-    // Check if a collision has been detected in the loop
-    if ((directionX && moveX > 0) || (!directionX && moveX < 0)) {
-        // Set the move positions inside the collision
-        player->setMoveX(moveX);
-        player->setMoveY(moveY);
-        return true;
-    } else {
-        return false;
-    }
+    entry = std::max(entry, axis_entry);
+    exit = std::min(exit, axis_exit);
+    return true;
 }
 
-bool checkAABBCollisionTunneling(Player *player, const SDL_FRect &obstacle) {
-    // The player has moved only on y-axis
-    if (player->getMoveX() == 0 && player->getMoveY() != 0) {
-        return checkAABBCollisionTunnelingOnYAxis(player, obstacle);
-    }
-    // The player has moved on both axis
-    else if (player->getMoveX() != 0 && player->getMoveY() != 0) {
-        return checkAABBCollisionTunnelingOnBothAxis(player, obstacle);
-    }
-    // The player has moved only on x-axis
-    else if (player->getMoveX() != 0 && player->getMoveY() == 0) {
-        return checkAABBCollisionTunnelingOnXAxis(player, obstacle);
-    }
-    // The player hasn't moved (supposed to be checked before calling this function)
-    else {
-        return false;
-    }
-}
+/**
+ * @brief Compute the interval of the move during which a moving box overlaps a fixed convex polygon.
+ * @param box The box at the start of the move.
+ * @param move The displacement of the box.
+ * @param obstacle The fixed polygon.
+ * @param[out] entry The time of first contact, as a fraction of the move (may be negative if already overlapping).
+ * @param[out] exit The time of separation, as a fraction of the move.
+ * @return True if the box overlaps the obstacle during the move, false otherwise.
+ */
+static bool sweptSATInterval(const SDL_FRect &box, const Point &move, const Polygon &obstacle, float &entry, float &exit) {
+    entry = -std::numeric_limits<float>::infinity();
+    exit = std::numeric_limits<float>::infinity();
 
-static bool checkSATCollisionTunnelingOnXAxis(Player *player, const Polygon &obstacle) {
+    if (!obstacle.isConvex()) return false;
 
-    // Initialization
-    float x = player->getX();
-    float y = player->getY();
-    float w = player->getW();
-    float h = player->getH();
-    float move = player->getMoveX();
-    bool direction = player->getDirectionX() == 1;
-
-    std::vector<Point> playerVertices = {{x + move,     y},
-                                         {x + move + w, y},
-                                         {x + move + w, y + h},
-                                         {x + move,     y + h}};
-
-    // Direction on x-axis is right
-    if (direction) {
-        // Check for collisions along the player's entire route to avoid tunneling effect
-        while (move > 0 && !checkSATCollision(playerVertices, obstacle)) {
-            move -= w;
-            playerVertices = {{x + move,     y},
-                              {x + move + w, y},
-                              {x + move + w, y + h},
-                              {x + move,     y + h}};
-        }
-    }
-    // Direction on x-axis is left
-    else {
-        // Check for collisions along the player's entire route to avoid tunneling effect
-        while (move < 0 && !checkSATCollision(playerVertices, obstacle)) {
-            move += w;
-            playerVertices = {{x + move,     y},
-                              {x + move + w, y},
-                              {x + move + w, y + h},
-                              {x + move,     y + h}};
-        }
-    }
+    // The axes of both shapes do not depend on time, so the SAT holds at every instant of the move
+    const std::vector<Point> &axes = obstacle.getAxes();
+    const std::vector<Projection> &obstacleProjections = obstacle.getProjections();
 
-    // Check if a collision has been detected in the loop
-    if ((direction && move > 0) || (!direction && move < 0)) {
-        player->setMoveX(move); // Set moveX inside the collision
-        return true;
-    } else {
-        return false;
-    }
-}
+    for (size_t i = 0; i < axes.size(); ++i) {
+        const Point &axis = axes[i];
 
-static bool checkSATCollisionTunnelingOnYAxis(Player *player, const Polygon &obstacle) {
+        // Project the box onto the axis without building its vertices
+        float origin = box.x * axis.x + box.y * axis.y;
+        float extent_x = box.w * axis.x;
+        float extent_y = box.h * axis.y;
+        float box_min = origin + std::min(0.0F, extent_x) + std::min(0.0F, extent_y);
+        float box_max = origin + std::max(0.0F, extent_x) + std::max(0.0F, extent_y);
 
-    // Initialization
-    float x = player->getX();
-    float y = player->getY();
-    float w = player->getW();
-    float h = player->getH();
-    float move = player->getMoveY();
-    bool direction = player->getDirectionY() == 1;
-
-    std::vector<Point> playerVertices = {{x,     y + move},
-                                         {x + w, y + move},
-                                         {x + w, y + move + h},
-                                         {x,     y + move + h}};
-
-    // Direction on y-axis is down
-    if (direction) {
-        // Check for collisions along the player's entire route to avoid tunneling effect
-        while (move > 0 && !checkSATCollision(playerVertices, obstacle)) {
-            move -= h;
-            playerVertices = {{x,     y + move},
-                              {x + w, y + move},
-                              {x + w, y + move + h},
-                              {x,     y + move + h}};
-        }
-    }
-    // Direction on y-axis is up
-    else {
-        // Check for collisions along the player's entire route to avoid tunneling effect
-        while (move < 0 && !checkSATCollision(playerVertices, obstacle)) {
-            move += h;
-            playerVertices = {{x,     y + move},
-                              {x + w, y + move},
-                              {x + w, y + move + h},
-                              {x,     y + move + h}};
-        }
+        float velocity = move.x * axis.x + move.y * axis.y;
+        if (!narrowSweptInterval(box_min, box_max, velocity, obstacleProjections[i].min, obstacleProjections[i].max, entry, exit)) return false;
+        if (entry >= exit) return false;
     }
 
-    // Check if a collision has been detected in the loop
-    if ((direction && move > 0) || (!direction && move < 0)) {
-        player->setMoveY(move); // Set moveY inside the collision
-        return true;
-    } else {
-        return false;
-    }
+    return entry < exit && entry < 1 && exit > 0;
 }
 
+bool sweptSATCollision(const SDL_FRect &box, const Point &move, const Polygon &obstacle, float &timeOfImpact) {
+    float entry, exit;
+    if (!sweptSATInterval(box, move, obstacle, entry, exit)) return false;
 
-static bool checkSATCollisionTunnelingOnBothAxis(Player *player, const Polygon &obstacle) {
-
-    // Initialization
-    float x = player->getX();
-    float y = player->getY();
-    float w = player->getW();
-    float h = player->getH();
-    float moveX = player->getMoveX();
-    float moveY = player->getMoveY();
-    bool directionX = player->getDirectionX() == 1; // True for right, false for left
-
-    float addX; // Value that will be added to moveX at each iteration
-    float addY; // Value that will be added to moveY at each iteration
-    float add = w < h ? w : h; // Select the player's shortest side
-
-    // Create a ratio between moveX and moveY so they increment proportionally
-    float ratio = std::abs(moveX / moveY);
-    if (ratio > 1) {
-        addX = add;
-        addY = add / ratio;
-    }
-    else {
-        addX = add * ratio;
-        addY = add;
-    }
-
-    // Choose whether to add or subtract the value according to direction
-    if (directionX == 1) addX *= -1;
-    if (player->getDirectionY() == 1) addY *= -1;
-
-    std::vector<Point> playerVertices = {{x + moveX,     y + moveY},
-                                         {x + moveX + w, y + moveY},
-                                         {x + moveX + w, y + moveY + h},
-                                         {x + moveX,     y + moveY + h}};
-
-    // The x-axis direction is right
-    if (directionX) {
-        // Check for collisions along the player's entire route to avoid tunneling effect
-        while (moveX > 0 && !checkSATCollision(playerVertices, obstacle)) {
-            moveX += addX;
-            moveY += addY;
-            playerVertices = {{x + moveX,     y + moveY},
-                              {x + moveX + w, y + moveY},
-                              {x + moveX + w, y + moveY + h},
-                              {x + moveX,     y + moveY + h}};
-        }
-    }
-    // The x-axis direction is left
-    else {
-        // Check for collisions along the player's entire route to avoid tunneling effect
-        while (moveX < 0 && !checkSATCollision(playerVertices, obstacle)) {
-            moveX += addX;
-            moveY += addY;
-            playerVertices = {{x + moveX,     y + moveY},
-                              {x + moveX + w, y + moveY},
-                              {x + moveX + w, y + moveY + h},
-                              {x + moveX,     y + moveY + h}};
-        }
-    }
+    timeOfImpact = std::max(entry, 0.0F);
+    return true;
+}
 
-    // Check if a collision has been detected in the loop
-    if ((directionX && moveX > 0) || (!directionX && moveX < 0)) {
-        // Set the move positions inside the collision
-        player->setMoveX(moveX);
-        player->setMoveY(moveY);
-        return true;
-    } else {
-        return false;
-    }
+/**
+ * @brief Move a player back to the part of its move overlapping an obstacle, the move starts at the same position.
+ * @param player The player, which already moved.
+ * @param entry The time of first contact.
+ * @param exit The time of separation.
+ */
+static void moveInsideCollision(Player *player, float entry, float exit) {
+    // Middle of the overlapping part of the move, so the player is strictly inside the obstacle
+    float time = std::midpoint(std::max(entry, 0.0F), std::min(exit, 1.0F));
+    float move_x = player->getMoveX() * time;
+    float move_y = player->getMoveY() * time;
+
+    player->setX(player->getX() - player->getMoveX() + move_x);
+    player->setY(player->getY() - player->getMoveY() + move_y);
+    player->setMoveX(move_x);
+    player->setMoveY(move_y);
 }
 
 bool checkSATCollisionTunneling(Player *player, const Polygon &obstacle) {
-    // The player has moved only on y-axis
-    if (player->getMoveX() == 0 && player->getMoveY() != 0) {
-        return checkSATCollisionTunnelingOnYAxis(player, obstacle);
-    }
-    // The player has moved on both axes
-    else if (player->getMoveX() != 0 && player->getMoveY() != 0) {
-        return checkSATCollisionTunnelingOnBothAxis(player, obstacle);
-    }
-    // The player has moved only on x-axis
-    else if (player->getMoveX() != 0 && player->getMoveY() == 0) {
-        return checkSATCollisionTunnelingOnXAxis(player, obstacle);
-    }
     // The player hasn't moved (supposed to be checked before calling this function)
-    else {
-        return false;
-    }
+    if (player->getMoveX() == 0 && player->getMoveY() == 0) return false;
+
+    // The narrow phase runs once the player moved, the move starts at the previous position
+    SDL_FRect box = {player->getX() - player->getMoveX(), player->getY() - player->getMoveY(), player->getW(), player->getH()};
+    float entry, exit;
+    if (!sweptSATInterval(box, {player->getMoveX(), player->getMoveY()}, obstacle, entry, exit)) return false;
+
+    moveInsideCollision(player, entry, exit);
+    return true;
 }
 
 void correctAABBCollision(Player *player, const SDL_FRect &obstacle) {
@@ -470,7 +224,7 @@ static float correctSATCollisionOnXAxis(const Player *player, const Polygon &obs
     float min = x - player->getMoveX();
     float max = x;
 
-    std::vector<Point> playerVertices;
+    Quad playerVertices;
 
     int i = 0;
 
@@ -479,10 +233,7 @@ static float correctSATCollisionOnXAxis(const Player *player, const Polygon &obs
 
         move = std::midpoint(max, min);
 
-        playerVertices = {{move, y},
-                          {move + w, y},
-                          {move + w, y + h},
-                          {move, y + h}};
+        playerVertices = makeQuad(move, y, w, h);
 
         // The point is inside the collision
         if (checkSATCollision(playerVertices, obstacle)) {
@@ -512,7 +263,7 @@ static float correctSATCollisionOnYAxis(const Player *player, const Polygon &obs
     float min = y - player->getMoveY();
     float max = y;
 
-    std::vector<Point> playerVertices;
+    Quad playerVertices;
 
     int i = 0;
 
@@ -521,10 +272,7 @@ static float correctSATCollisionOnYAxis(const Player *player, const Polygon &obs
 
         move = std::midpoint(max, min);
 
-        playerVertices = {{x, move},
-                          {x + w, move},
-                          {x + w, move + h},
-                          {x, move + h}};
+        playerVertices = makeQuad(x, move, w, h);
 
         // The point is inside the collision
         if (checkSATCollision(playerVertices, obstacle)) {
@@ -570,7 +318,7 @@ static void correctSATCollisionOnBothAxis(Player *player, const Polygon &obstacl
         divideY = 2;
     }
 
-    std::vector<Point> playerVertices;
+    Quad playerVertices;
 
     int i = 0;
 
@@ -580,10 +328,7 @@ static void correctSATCollisionOnBothAxis(Player *player, const Polygon &obstacl
         moveX = std::lerp(minX, maxX, divideX);
         moveY = std::lerp(minY, maxY, divideY);
 
-        playerVertices = {{moveX, moveY},
-                          {moveX + w, moveY},
-                          {moveX + w, moveY + h},
-                          {moveX, moveY + h}};
+        playerVertices = makeQuad(moveX, moveY, w, h);
 
         // The point is inside the collision
         if (checkSATCollision(playerVertices, obstacle)) {
@@ -619,20 +364,14 @@ void correctSATCollision(Player *player, const Polygon &obstacle) {
     // COLLISION ANALYSIS
 
     // Check if the collision concerns the x-axis movement
-    std::vector<Point> playerVertices = {{x, y - moveY},
-                                         {x + w, y - moveY},
-                                         {x + w, y - moveY + h},
-                                         {x, y - moveY + h }};
+    Quad playerVertices = makeQuad(x, y - moveY, w, h);
 
     if (moveX != 0 && checkSATCollision(playerVertices, obstacle)) {
         xaxis = true;
     }
 
     // Check if the collision concerns the y-axis movement
-    playerVertices = {{x - moveX, y},
-                      {x - moveX + w, y},
-                      {x - moveX + w, y + h},
-                      {x - moveX, y + h}};
+    playerVertices = makeQuad(x - moveX, y, w, h);
 
     if (moveY != 0 && checkSATCollision(playerVertices, obstacle)) {
         yaxis = true;
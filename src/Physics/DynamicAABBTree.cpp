@@ -0,0 +1,280 @@
+#include "../../include/Physics/DynamicAABBTree.h"
+
+/**
+ * @file DynamicAABBTree.cpp
+ * @brief Implements the DynamicAABBTree class used to index moving objects.
+ */
+
+
+/**
+ * @brief Check if two boxes overlap, touching boxes do not overlap (same test as checkAABBCollision).
+ * @param a The first box.
+ * @param b The second box.
+ * @return True if the boxes overlap, false otherwise.
+ */
+static bool overlaps(const SDL_FRect &a, const SDL_FRect &b) {
+    return a.x < b.x + b.w && a.x + a.w > b.x && a.y < b.y + b.h && a.y + a.h > b.y;
+}
+
+
+/* CONSTRUCTORS */
+
+DynamicAABBTree::DynamicAABBTree(float margin) : margin(margin) {}
+
+
+/* ACCESSORS */
+
+size_t DynamicAABBTree::size() const {
+    return leaves.size();
+}
+
+int DynamicAABBTree::getHeight() const {
+    return root == -1 ? 0 : nodes[root].height;
+}
+
+
+/* METHODS */
+
+void DynamicAABBTree::clear() {
+    nodes.clear();
+    leaves.clear();
+    root = -1;
+    freeList = -1;
+}
+
+void DynamicAABBTree::push(const SDL_FRect &bounds) {
+    int leaf = allocateNode();
+    nodes[leaf].bounds = bounds;
+    nodes[leaf].fat = {bounds.x - margin, bounds.y - margin, bounds.w + 2 * margin, bounds.h + 2 * margin};
+    nodes[leaf].index = leaves.size();
+
+    leaves.push_back(leaf);
+    insertLeaf(leaf);
+}
+
+bool DynamicAABBTree::update(size_t index, const SDL_FRect &bounds) {
+    int leaf = leaves[index];
+    nodes[leaf].bounds = bounds;
+
+    // The object is still inside its fat box, the tree does not change
+    if (contains(nodes[leaf].fat, bounds)) return false;
+
+    // Move the leaf to the best place for its new fat box
+    removeLeaf(leaf);
+    nodes[leaf].fat = {bounds.x - margin, bounds.y - margin, bounds.w + 2 * margin, bounds.h + 2 * margin};
+    insertLeaf(leaf);
+    return true;
+}
+
+void DynamicAABBTree::swapRemove(size_t index) {
+    int leaf = leaves[index];
+    removeLeaf(leaf);
+    freeNode(leaf);
+
+    // The last object takes the index of the removed one, like in the collection
+    if (index != leaves.size() - 1) {
+        leaves[index] = leaves.back();
+        nodes[leaves[index]].index = index;
+    }
+    leaves.pop_back();
+}
+
+void DynamicAABBTree::query(const SDL_FRect &area, std::vector<size_t> &result) const {
+    result.clear();
+    if (root == -1) return;
+
+    TraversalStack stack;
+    stack.push(root);
+
+    // Visit only the subtrees whose box overlaps the area
+    while (!stack.empty()) {
+        const Node &node = nodes[stack.pop()];
+
+        if (!overlaps(node.fat, area)) continue;
+
+        if (node.isLeaf()) {
+            if (overlaps(node.bounds, area)) result.push_back(node.index);
+        } else {
+            stack.push(node.left);
+            stack.push(node.right);
+        }
+    }
+
+    // Keep the order of the collection
+    std::ranges::sort(result);
+}
+
+int DynamicAABBTree::allocateNode() {
+    // No free node, grow the storage
+    if (freeList == -1) {
+        nodes.emplace_back();
+        return static_cast<int>(nodes.size()) - 1;
+    }
+
+    int node = freeList;
+    freeList = nodes[node].parent;
+    nodes[node] = Node();
+    return node;
+}
+
+void DynamicAABBTree::freeNode(int node) {
+    nodes[node].parent = freeList;
+    nodes[node].height = -1;
+    freeList = node;
+}
+
+void DynamicAABBTree::insertLeaf(int leaf) {
+    if (root == -1) {
+        root = leaf;
+        nodes[leaf].parent = -1;
+        return;
+    }
+
+    // Find the best sibling, going down while splitting a child costs less than splitting the current node
+    const SDL_FRect box = nodes[leaf].fat;
+    int sibling = root;
+
+    while (!nodes[sibling].isLeaf()) {
+        const Node &node = nodes[sibling];
+        float combined = perimeter(combine(node.fat, box));
+
+        // Cost of creating a new parent for this node and the leaf
+        float cost = 2 * combined;
+
+        // Minimum cost of pushing the leaf further down, every ancestor grows by the same amount
+        float inheritance = 2 * (combined - perimeter(node.fat));
+
+        auto descentCost = [&](int child) {
+            const Node &child_node = nodes[child];
+            float grown = perimeter(combine(box, child_node.fat));
+            return child_node.isLeaf() ? grown + inheritance : grown - perimeter(child_node.fat) + inheritance;
+        };
+
+        float left_cost = descentCost(node.left);
+        float right_cost = descentCost(node.right);
+
+        if (cost < left_cost && cost < right_cost) break;
+        sibling = left_cost < right_cost ? node.left : node.right;
+    }
+
+    // Create a new parent holding the sibling and the leaf (the storage may grow, so no reference is kept)
+    int old_parent = nodes[sibling].parent;
+    int new_parent = allocateNode();
+    nodes[new_parent].parent = old_parent;
+    nodes[new_parent].fat = combine(box, nodes[sibling].fat);
+    nodes[new_parent].height = nodes[sibling].height + 1;
+    nodes[new_parent].left = sibling;
+    nodes[new_parent].right = leaf;
+    nodes[sibling].parent = new_parent;
+    nodes[leaf].parent = new_parent;
+
+    if (old_parent == -1) {
+        root = new_parent;
+    } else if (nodes[old_parent].left == sibling) {
+        nodes[old_parent].left = new_parent;
+    } else {
+        nodes[old_parent].right = new_parent;
+    }
+
+    refit(new_parent);
+}
+
+void DynamicAABBTree::removeLeaf(int leaf) {
+    if (leaf == root) {
+        root = -1;
+        return;
+    }
+
+    int parent = nodes[leaf].parent;
+    int grand_parent = nodes[parent].parent;
+    int sibling = nodes[parent].left == leaf ? nodes[parent].right : nodes[parent].left;
+
+    // The sibling takes the place of the parent
+    nodes[sibling].parent = grand_parent;
+    freeNode(parent);
+
+    if (grand_parent == -1) {
+        root = sibling;
+        return;
+    }
+
+    if (nodes[grand_parent].left == parent) nodes[grand_parent].left = sibling;
+    else nodes[grand_parent].right = sibling;
+
+    refit(grand_parent);
+}
+
+void DynamicAABBTree::refit(int node) {
+    while (node != -1) {
+        node = balance(node);
+
+        Node &current = nodes[node];
+        current.height = 1 + std::max(nodes[current.left].height, nodes[current.right].height);
+        current.fat = combine(nodes[current.left].fat, nodes[current.right].fat);
+
+        node = current.parent;
+    }
+}
+
+int DynamicAABBTree::balance(int node) {
+    if (nodes[node].isLeaf() || nodes[node].height < 2) return node;
+
+    int left = nodes[node].left;
+    int right = nodes[node].right;
+    int difference = nodes[right].height - nodes[left].height;
+
+    if (difference > 1) return rotate(node, right);
+    if (difference < -1) return rotate(node, left);
+    return node;
+}
+
+int DynamicAABBTree::rotate(int node, int child) {
+    int parent = nodes[node].parent;
+    bool child_is_right = nodes[node].right == child;
+    int other = child_is_right ? nodes[node].left : nodes[node].right;
+
+    // The tallest grandchild stays under the child, the shortest one takes the place of the child under the node
+    int first = nodes[child].left;
+    int second = nodes[child].right;
+    int kept = nodes[first].height > nodes[second].height ? first : second;
+    int moved = kept == first ? second : first;
+
+    // The child takes the place of the node
+    nodes[child].parent = parent;
+    if (parent == -1) root = child;
+    else if (nodes[parent].left == node) nodes[parent].left = child;
+    else nodes[parent].right = child;
+
+    nodes[child].left = node;
+    nodes[child].right = kept;
+    nodes[node].parent = child;
+
+    if (child_is_right) nodes[node].right = moved;
+    else nodes[node].left = moved;
+    nodes[moved].parent = node;
+
+    // Refit the two nodes whose children changed, bottom-up
+    nodes[node].fat = combine(nodes[other].fat, nodes[moved].fat);
+    nodes[node].height = 1 + std::max(nodes[other].height, nodes[moved].height);
+    nodes[child].fat = combine(nodes[node].fat, nodes[kept].fat);
+    nodes[child].height = 1 + std::max(nodes[node].height, nodes[kept].height);
+
+    return child;
+}
+
+SDL_FRect DynamicAABBTree::combine(const SDL_FRect &a, const SDL_FRect &b) {
+    float min_x = std::min(a.x, b.x);
+    float min_y = std::min(a.y, b.y);
+    float max_x = std::max(a.x + a.w, b.x + b.w);
+    float max_y = std::max(a.y + a.h, b.y + b.h);
+    return {min_x, min_y, max_x - min_x, max_y - min_y};
+}
+
+float DynamicAABBTree::perimeter(const SDL_FRect &box) {
+    return 2 * (box.w + box.h);
+}
+
+bool DynamicAABBTree::contains(const SDL_FRect &outer, const SDL_FRect &inner) {
+    return outer.x <= inner.x && outer.y <= inner.y &&
+           inner.x + inner.w <= outer.x + outer.w && inner.y + inner.h <= outer.y + outer.h;
+}
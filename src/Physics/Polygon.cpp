@@ -8,12 +8,30 @@
 
 /* CONSTRUCTOR */
 
-Polygon::Polygon(const std::vector<Point> &vertices, PolygonType type) : vertices(vertices), type(type) {}
+Polygon::Polygon(const std::vector<Point> &vertices, PolygonType type) : vertices(vertices), type(type) {
+    if (vertices.empty()) return;
+
+    // Compute the bounding box once, the vertices never change
+    float min_x = vertices[0].x;
+    float min_y = vertices[0].y;
+    float max_x = vertices[0].x;
+    float max_y = vertices[0].y;
+    for (const Point &vertex: vertices) {
+        min_x = std::min(min_x, vertex.x);
+        min_y = std::min(min_y, vertex.y);
+        max_x = std::max(max_x, vertex.x);
+        max_y = std::max(max_y, vertex.y);
+    }
+
+    boundingBox = {min_x, min_y, max_x - min_x, max_y - min_y};
+
+    bake();
+}
 
 
 /* ACCESSORS */
 
-std::vector<Point> Polygon::getVertices() const {
+const std::vector<Point> &Polygon::getVertices() const {
     return vertices;
 }
 
@@ -21,9 +39,53 @@ PolygonType Polygon::getType() const {
     return type;
 }
 
+SDL_FRect Polygon::getBoundingBox() const {
+    return boundingBox;
+}
+
+const std::vector<Point> &Polygon::getAxes() const {
+    return axes;
+}
+
+const std::vector<Projection> &Polygon::getProjections() const {
+    return projections;
+}
+
 
 /* METHODS */
 
+bool Polygon::isConvex() const {
+    return convex;
+}
+
+void Polygon::bake() {
+    convex = computeConvexity();
+
+    // Potential separation axes: the normals to the sides of an axis-aligned rectangle (the players)
+    axes.reserve(vertices.size() + 2);
+    axes.push_back({1, 0});
+    axes.push_back({0, 1});
+
+    // Add axes perpendicular to the sides of the polygon
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        const Point &vertex1 = vertices[i];
+        const Point &vertex2 = vertices[(i + 1) % vertices.size()];
+        axes.push_back({-(vertex2.y - vertex1.y), vertex2.x - vertex1.x});
+    }
+
+    // Project the polygon onto each axis
+    projections.reserve(axes.size());
+    for (const Point &axis: axes) {
+        Projection projection = {std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest()};
+        for (const Point &vertex: vertices) {
+            float value = vertex.x * axis.x + vertex.y * axis.y;
+            projection.min = std::min(projection.min, value);
+            projection.max = std::max(projection.max, value);
+        }
+        projections.push_back(projection);
+    }
+}
+
 double Polygon::distance(const Point &a, const Point &b) {
     return std::hypot(b.x - a.x, b.y - a.y);
 }
@@ -66,7 +128,7 @@ double Polygon::totalAngles() const {
     return sumAngles;
 }
 
-bool Polygon::isConvex() const{
+bool Polygon::computeConvexity() const {
     size_t n = vertices.size();
     if (n < 3) {
         return false;
@@ -0,0 +1,79 @@
+#include "../../include/Physics/SpatialGrid.h"
+
+/**
+ * @file SpatialGrid.cpp
+ * @brief Implements the SpatialGrid class used to index static level geometry.
+ */
+
+
+/* CONSTRUCTORS */
+
+SpatialGrid::SpatialGrid(float cellSize) : cellSize(cellSize) {}
+
+
+/* ACCESSORS */
+
+float SpatialGrid::getCellSize() const {
+    return cellSize;
+}
+
+size_t SpatialGrid::getCount() const {
+    return count;
+}
+
+
+/* METHODS */
+
+void SpatialGrid::clear() {
+    cells.clear();
+    count = 0;
+}
+
+void SpatialGrid::insert(size_t index, const SDL_FRect &bounds) {
+    int min_x = toCell(bounds.x);
+    int min_y = toCell(bounds.y);
+    int max_x = toCell(bounds.x + bounds.w);
+    int max_y = toCell(bounds.y + bounds.h);
+
+    // Register the object in every cell overlapped by its bounding box
+    for (int cell_x = min_x; cell_x <= max_x; cell_x++) {
+        for (int cell_y = min_y; cell_y <= max_y; cell_y++) {
+            cells[key(cell_x, cell_y)].push_back(index);
+        }
+    }
+
+    count++;
+}
+
+void SpatialGrid::query(const SDL_FRect &area, std::vector<size_t> &result) const {
+    result.clear();
+    if (cells.empty()) return;
+
+    int min_x = toCell(area.x);
+    int min_y = toCell(area.y);
+    int max_x = toCell(area.x + area.w);
+    int max_y = toCell(area.y + area.h);
+
+    // Gather the content of every cell overlapped by the area
+    for (int cell_x = min_x; cell_x <= max_x; cell_x++) {
+        for (int cell_y = min_y; cell_y <= max_y; cell_y++) {
+            auto it = cells.find(key(cell_x, cell_y));
+            if (it != cells.end()) {
+                result.insert(result.end(), it->second.begin(), it->second.end());
+            }
+        }
+    }
+
+    // An object overlapping several cells is found several times, keep the level order and remove duplicates
+    std::ranges::sort(result);
+    auto [first, last] = std::ranges::unique(result);
+    result.erase(first, last);
+}
+
+int SpatialGrid::toCell(float value) const {
+    return static_cast<int>(std::floor(value / cellSize));
+}
+
+uint64_t SpatialGrid::key(int cellX, int cellY) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(cellX)) << 32) | static_cast<uint32_t>(cellY);
+}
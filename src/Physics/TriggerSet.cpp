@@ -0,0 +1,20 @@
+#include "../../include/Physics/TriggerSet.h"
+
+/**
+ * @file TriggerSet.cpp
+ * @brief Implements the TriggerSet class tracking the trigger zones overlapped by a player.
+ */
+
+
+/* ACCESSORS */
+
+size_t TriggerSet::count(AABBType type) const {
+    return static_cast<size_t>(std::ranges::count(overlaps, type, &Overlap::type));
+}
+
+
+/* METHODS */
+
+void TriggerSet::overlap(AABBType type, Handle<AABB> zone) {
+    touching.push_back({type, zone});
+}
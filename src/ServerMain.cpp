@@ -0,0 +1,93 @@
+#include <string>
+#include "../include/Game/Game.h"
+#include "../include/Network/NetworkManager.h"
+#include "../include/Utils/MessageQueue.h"
+
+/**
+ * @file ServerMain.cpp
+ * @brief Entry point of the dedicated server, it runs the game without window, renderer, fonts nor audio.
+ */
+
+int main(int argc, char *args[]) {
+#ifdef DEVELOPMENT_MODE
+    std::cout << "SERVER : WARNING : DEVELOPMENT_MODE is enabled" << std::endl;
+#endif
+
+    // Parse the options given as "--option value" pairs
+    unsigned short port = 8080;
+    int slot = 0;
+    uint64_t tickRate = SIMULATION_TICK_RATE;
+
+    try {
+        if (argc % 2 == 0) throw std::invalid_argument("missing value");
+
+        for (int i = 1; i < argc; i += 2) {
+            std::string option = args[i];
+            if (option == "--port") {
+                int value = std::stoi(args[i + 1]);
+                if (value < 1 || value > 65535) throw std::invalid_argument("the port must be between 1 and 65535");
+                port = static_cast<unsigned short>(value);
+            }
+            else if (option == "--tick-rate") tickRate = std::stoull(args[i + 1]);
+            else if (option == "--slot") slot = std::stoi(args[i + 1]);
+            else throw std::invalid_argument("unknown option " + option);
+        }
+
+        if (tickRate == 0) throw std::invalid_argument("the tick rate must be positive");
+    } catch (const std::exception &e) {
+        std::cerr << "Invalid arguments (" << e.what() << ")" << std::endl;
+        std::cerr << "Usage: play-together-server [--port <port>] [--tick-rate <ticks per second>] [--slot <save slot>]" << std::endl;
+        return 1;
+    }
+
+// Initialize Winsock on Windows
+#ifdef _WIN32
+    WSADATA wsaData;
+    int result = WSAStartup(MAKEWORD(2, 2), &wsaData);
+    if (result != 0) {
+        std::cerr << "WSAStartup failed: " << result << std::endl;
+        return 1;
+    }
+#endif
+
+    // Initialize only the SDL events, they turn SIGINT and SIGTERM into SDL_QUIT (no video, no audio)
+    if (SDL_Init(SDL_INIT_EVENTS) < 0) {
+        std::cerr << "Error initializing SDL2: " << SDL_GetError() << std::endl;
+        return 1;
+    }
+
+    // Initialize game objects, the game has no window nor renderer
+    bool quit = false;
+
+    MessageQueue messageQueue;
+    Game game(nullptr, nullptr, 60, &quit, &messageQueue);
+    NetworkManager networkManager;
+
+    // Initialize pointers for communication between objects (no menu on the server)
+    Mediator::setMessageQueuePtr(&messageQueue);
+    Mediator::setGamePtr(&game);
+    Mediator::setNetworkManagerPtr(&networkManager);
+
+    try {
+        networkManager.startServers(port);
+    } catch (const NetworkError &e) {
+        std::cerr << "(NetworkError) " << e.what() << std::endl;
+        SDL_Quit();
+        return 1;
+    }
+
+    SimulationClock::setTickRate(tickRate);
+    std::cout << "SERVER : Simulating " << SimulationClock::getTickRate() << " ticks per second" << std::endl;
+
+    game.initializeHostedGame(slot);
+    game.run(); // Block the main thread until the server is stopped
+
+    /* Clean up resources */
+    networkManager.stopServers();
+    SDL_Quit();
+
+#ifdef _WIN32
+    WSACleanup();
+#endif
+    return 0;
+}
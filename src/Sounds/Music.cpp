@@ -12,6 +12,9 @@ int Music::volume = 20;
 /* CONSTRUCTORS */
 
 Music::Music(const std::string& file_name) {
+    // The audio device is not opened (headless server), the music is never played
+    if (Mix_QuerySpec(nullptr, nullptr, nullptr) == 0) return;
+
     std::string file_path = std::string(MUSICS_DIRECTORY) + file_name;
     music = Mix_LoadMUS(file_path.c_str());
 
@@ -32,6 +35,7 @@ void Music::setVolume(int new_volume) {
 }
 
 void Music::play(int loop) {
+    if (music == nullptr) return;
     Mix_PlayMusic(music, loop);
     setVolume(volume);
 }
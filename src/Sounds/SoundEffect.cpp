@@ -12,6 +12,9 @@ int SoundEffect::masterVolume = 32;
 /* CONSTRUCTORS */
 
 SoundEffect::SoundEffect(const std::string& file_name) {
+    // The audio device is not opened (headless server), the sound is never played
+    if (Mix_QuerySpec(nullptr, nullptr, nullptr) == 0) return;
+
     std::string file_path = std::string(SOUNDS_DIRECTORY) + file_name;
     sound = Mix_LoadWAV(file_path.c_str());
 
@@ -24,6 +27,9 @@ SoundEffect::SoundEffect(const std::string& file_name) {
 }
 
 SoundEffect::SoundEffect(const std::string& file_name, int volume) : volume(volume) {
+    // The audio device is not opened (headless server), the sound is never played
+    if (Mix_QuerySpec(nullptr, nullptr, nullptr) == 0) return;
+
     std::string file_path = std::string(SOUNDS_DIRECTORY) + file_name;
     sound = Mix_LoadWAV(file_path.c_str());
 
@@ -54,6 +60,7 @@ int SoundEffect::getVolume() const {
 /* MUTATORS */
 
 void SoundEffect::setVolume(int new_volume) {
+    if (sound == nullptr) return;
     Mix_VolumeChunk(sound, new_volume);
 }
 
@@ -65,6 +72,7 @@ void SoundEffect::stop() {
 }
 
 void SoundEffect::play(int loop, int vol) {
+    if (sound == nullptr) return;
     Mix_PlayChannel(-1, sound, loop); // '-1' takes the first available channel
     setVolume(vol < 0 ? masterVolume : vol);
 }
@@ -0,0 +1,54 @@
+#include "../../include/Utils/ActiveSet.h"
+
+/**
+ * @file ActiveSet.cpp
+ * @brief Implements the ActiveSet class used to schedule the awake objects of a collection.
+ */
+
+
+/* ACCESSORS */
+
+size_t ActiveSet::size() const {
+    return dense.size();
+}
+
+bool ActiveSet::contains(size_t index) const {
+    return index < sparse.size() && sparse[index] != npos;
+}
+
+std::vector<size_t>::const_iterator ActiveSet::begin() const {
+    return dense.begin();
+}
+
+std::vector<size_t>::const_iterator ActiveSet::end() const {
+    return dense.end();
+}
+
+
+/* METHODS */
+
+void ActiveSet::reset(size_t size) {
+    dense.clear();
+    dense.reserve(size);
+    sparse.assign(size, npos);
+}
+
+bool ActiveSet::insert(size_t index) {
+    if (contains(index)) return false;
+
+    sparse[index] = dense.size();
+    dense.push_back(index);
+    return true;
+}
+
+bool ActiveSet::erase(size_t index) {
+    if (!contains(index)) return false;
+
+    // The last awake object takes the position of the removed one
+    size_t position = sparse[index];
+    dense[position] = dense.back();
+    sparse[dense[position]] = position;
+    dense.pop_back();
+    sparse[index] = npos;
+    return true;
+}
@@ -0,0 +1,33 @@
+#include "../../include/Utils/AllocationCounter.h"
+
+/**
+ * @file AllocationCounter.cpp
+ * @brief Implements the heap allocation counter available in development mode.
+ */
+
+#ifdef DEVELOPMENT_MODE
+
+#include <new>
+#include <cstdlib>
+
+static thread_local size_t allocationCount = 0; /**< The number of allocations made by the current thread. */
+
+size_t getAllocationCount() {
+    return allocationCount;
+}
+
+void *operator new(size_t size) {
+    allocationCount++;
+    if (void *ptr = std::malloc(size == 0 ? 1 : size)) return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
+#endif
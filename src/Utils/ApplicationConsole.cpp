@@ -42,6 +42,8 @@ void ApplicationConsole::executeGameRunningCommand(const std::string &command) c
         toggleRendering();
     } else if (command.find("fps") != std::string::npos) {
         toggleFPSRendering();
+    } else if (command.find("broadphase") != std::string::npos) {
+        configureBroadPhase(command);
     } else {
         std::cout << "Unknown command. Type 'help' to display help.\n" << std::endl;
     }
@@ -85,6 +87,7 @@ void ApplicationConsole::displayHelp(int gameState) const {
         std::cout << "enable [all | camera_shake | platforms | crushers] - Enable game mechanic\n";
         std::cout << "disable [all | camera_shake | platforms | crushers] - Disable game mechanic\n";
         std::cout << "render - Toggle rendering between textures and collisions box\n";
+        std::cout << "broadphase [incremental | full] - Display the broad phase counters or change its mode\n";
     } else {
         std::cout << "ping - Test the console\n";
         std::cout << "fps [fps] - Set the max frame rate (must be greater or equal to 30)\n";
@@ -109,7 +112,7 @@ void ApplicationConsole::changeMap(const std::string &command) const {
     std::string map_name;
     iss >> command_name >> map_name;
     if (command_name == "map") {
-        gamePtr->setLevel(map_name);
+        gamePtr->requestLevel(map_name); // The level is changed between two frames, the simulation and the rendering use it
     } else {
         std::cout << "Invalid syntax. Usage: map [mapName]\n";
     }
@@ -263,6 +266,35 @@ void ApplicationConsole::toggleFPSRendering() const {
     std::cout << "FPS rendering toggled.\n";
 }
 
+void ApplicationConsole::configureBroadPhase(const std::string &command) const {
+    BroadPhaseManager &broadPhaseManager = gamePtr->getBroadPhaseManager();
+    std::istringstream iss(command);
+    std::string command_name;
+    std::string option;
+    iss >> command_name >> option;
+
+    if (command_name != "broadphase") {
+        std::cout << "Invalid syntax. Usage: broadphase [incremental | full]\n";
+        return;
+    }
+
+    if (option == "incremental") {
+        broadPhaseManager.setIncremental(true);
+        std::cout << "Broad phase static sets are reused while the camera stays inside their area.\n";
+    }
+    else if (option == "full") {
+        broadPhaseManager.setIncremental(false);
+        std::cout << "Broad phase static sets are rebuilt every frame.\n";
+    }
+    else if (option.empty()) {
+        std::cout << "Broad phase mode: " << (broadPhaseManager.getIncremental() ? "incremental" : "full") << "\n";
+        std::cout << "Full rebuilds: " << broadPhaseManager.getFullRebuildCount() << ", reused frames: " << broadPhaseManager.getReusedFrameCount() << "\n";
+    }
+    else {
+        std::cout << "Invalid option. Usage: broadphase [incremental | full]\n";
+    }
+}
+
 
 /* GAME NOT RUNNING COMMANDS METHODS */
 
@@ -0,0 +1,174 @@
+#include "../../include/Utils/JobSystem.h"
+
+/**
+ * @file JobSystem.cpp
+ * @brief Implements the JobSystem class used to spread the work of a frame over the cores.
+ */
+
+
+/**
+ * @brief Get the time elapsed since an instant.
+ * @param start The instant.
+ * @return The elapsed time in milliseconds.
+ */
+static double millisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+
+/* CONSTRUCTORS */
+
+JobSystem::JobSystem(size_t threadCount) {
+    // The queues exist before any worker starts stealing from them
+    for (size_t i = 0; i <= threadCount; i++) queues.push_back(std::make_unique<WorkQueue>());
+
+    workers.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; i++) {
+        workers.emplace_back([this, i](const std::stop_token &stopToken) { work(stopToken, i + 1); });
+    }
+}
+
+
+/* ACCESSORS */
+
+size_t JobSystem::getWorkerCount() const {
+    return queues.size();
+}
+
+
+/* METHODS */
+
+void JobSystem::parallelFor(size_t iterations, const std::function<void(size_t, size_t)> &body, size_t grain) {
+    size_t worker = currentWorker;
+
+    // A few jobs per worker, so the workers finishing first steal the rest
+    size_t chunk_count = std::min((iterations + std::max<size_t>(grain, 1) - 1) / std::max<size_t>(grain, 1), getWorkerCount() * 4);
+
+    // Nothing to share, the calling worker runs the loop alone
+    if (workers.empty() || chunk_count < 2) {
+        for (size_t i = 0; i < iterations; i++) body(i, worker);
+        return;
+    }
+
+    std::atomic<size_t> pending = chunk_count;
+    size_t chunk_size = iterations / chunk_count;
+    size_t remainder = iterations % chunk_count;
+
+    size_t begin = 0;
+    for (size_t chunk = 0; chunk < chunk_count; chunk++) {
+        size_t end = begin + chunk_size + (chunk < remainder ? 1 : 0);
+        push(worker, {&body, nullptr, begin, end, &pending});
+        begin = end;
+    }
+
+    waitFor(pending, worker);
+}
+
+void JobSystem::run(TaskGraph &graph) {
+    auto start = std::chrono::steady_clock::now();
+    size_t worker = currentWorker;
+
+    std::atomic<size_t> pending = graph.stages.size();
+    for (TaskGraph::Stage &stage: graph.stages) stage.remaining = stage.dependencies;
+
+    // Queue the stages without dependencies, the others are queued by the last stage they depend on
+    for (size_t i = 0; i < graph.stages.size(); i++) {
+        if (graph.stages[i].dependencies == 0) push(worker, {nullptr, &graph, i, 0, &pending});
+    }
+
+    waitFor(pending, worker);
+
+    graph.milliseconds = millisecondsSince(start);
+    graph.totalMilliseconds += graph.milliseconds;
+    graph.runs++;
+}
+
+void JobSystem::push(size_t worker, const Job &job) {
+    {
+        std::scoped_lock lock(queues[worker]->mutex);
+        queues[worker]->jobs.push_back(job);
+    }
+    queuedJobs.fetch_add(1, std::memory_order_release);
+
+    // Lock the sleep mutex so a worker checking the queues right now does not miss the notification
+    { std::scoped_lock lock(sleepMutex); }
+    wakeUp.notify_one();
+}
+
+bool JobSystem::take(size_t worker, Job &job) {
+    // Newest job of the worker first, its data is still in the cache
+    {
+        WorkQueue &queue = *queues[worker];
+        std::scoped_lock lock(queue.mutex);
+        if (!queue.jobs.empty()) {
+            job = queue.jobs.back();
+            queue.jobs.pop_back();
+            queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    // Steal the oldest job of another worker, the biggest remaining part of its work
+    for (size_t i = 1; i < queues.size(); i++) {
+        WorkQueue &queue = *queues[(worker + i) % queues.size()];
+        std::scoped_lock lock(queue.mutex);
+        if (!queue.jobs.empty()) {
+            job = queue.jobs.front();
+            queue.jobs.pop_front();
+            queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void JobSystem::waitFor(const std::atomic<size_t> &pending, size_t worker) {
+    Job job;
+
+    // Help the other workers instead of sleeping, the jobs waited for may be stolen by anyone
+    while (pending.load(std::memory_order_acquire) != 0) {
+        if (take(worker, job)) execute(job, worker);
+        else std::this_thread::yield();
+    }
+}
+
+void JobSystem::work(const std::stop_token &stopToken, size_t worker) {
+    currentWorker = worker;
+    Job job;
+
+    while (!stopToken.stop_requested()) {
+        if (take(worker, job)) {
+            execute(job, worker);
+            continue;
+        }
+
+        // Sleep until a job is queued
+        std::unique_lock lock(sleepMutex);
+        wakeUp.wait(lock, stopToken, [this] { return queuedJobs.load(std::memory_order_acquire) != 0; });
+    }
+}
+
+void JobSystem::execute(const Job &job, size_t worker) {
+    // Chunk of a parallel loop
+    if (job.body != nullptr) {
+        for (size_t i = job.begin; i < job.end; i++) (*job.body)(i, worker);
+        job.pending->fetch_sub(1, std::memory_order_release);
+        return;
+    }
+
+    // Stage of a graph
+    TaskGraph::Stage &stage = job.graph->stages[job.begin];
+    auto start = std::chrono::steady_clock::now();
+    stage.function();
+    stage.milliseconds = millisecondsSince(start);
+    stage.totalMilliseconds += stage.milliseconds;
+
+    // The last dependency done queues the successor
+    for (size_t successor: stage.successors) {
+        if (job.graph->stages[successor].remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            push(worker, {nullptr, job.graph, successor, 0, job.pending});
+        }
+    }
+    job.pending->fetch_sub(1, std::memory_order_release);
+}
@@ -9,6 +9,9 @@ Menu *Mediator::menuPtr = nullptr;
 MessageQueue *Mediator::messageQueuePtr = nullptr;
 NetworkManager *Mediator::networkManagerPtr = nullptr;
 std::unordered_map<int, std::unordered_map<SDL_Scancode, bool>> Mediator::playersKeyStates;
+std::mutex Mediator::networkEventsMutex;
+std::vector<std::function<void()>> Mediator::networkEvents;
+std::vector<std::function<void()>> Mediator::tickNetworkEvents;
 const std::array<SDL_Scancode, 7> Mediator::keyMapping = {
         SDL_SCANCODE_UP, SDL_SCANCODE_LEFT, SDL_SCANCODE_RIGHT, SDL_SCANCODE_DOWN,
         SDL_SCANCODE_LSHIFT, SDL_SCANCODE_E, SDL_SCANCODE_F
@@ -61,50 +64,91 @@ void Mediator::startClients(const std::string& serverIP, short serverPort) {
 
 void Mediator::stopServers() {
     Mediator::networkManagerPtr->stopServers();
+    clearNetworkEvents();
 }
 
 void Mediator::stopClients() {
     Mediator::networkManagerPtr->stopClients();
+    clearNetworkEvents();
 }
 
-void Mediator::sendPlayerUpdate(uint16_t keyboardStateMask) {
+void Mediator::sendPlayerUpdate(uint16_t inputSequence, uint16_t keyboardStateMask) {
     // If the server is not running, return
-    Mediator::networkManagerPtr->sendPlayerUpdate(keyboardStateMask);
+    Mediator::networkManagerPtr->sendPlayerUpdate(inputSequence, keyboardStateMask);
 }
 
 void Mediator::sendAsteroidCreation(Asteroid const &asteroid) {
     Mediator::networkManagerPtr->sendAsteroidCreation(asteroid);
 }
 
-void Mediator::sendSyncCorrection(nlohmann::json &message) {
-    nlohmann::json platforms1D = nlohmann::json::array();
-    for (const auto &platform : gamePtr->getLevel()->getMovingPlatforms1D()) {
-        nlohmann::json platformProperties;
-        platformProperties["x"] = platform.getX();
-        platformProperties["y"] = platform.getY();
-        platforms1D.push_back(platformProperties);
+void Mediator::sendSyncCorrection() {
+    // Capture the positions of the players, platforms and crushers, only their changes are sent
+    Snapshot &snapshot = Mediator::networkManagerPtr->getSnapshotManager().capture();
+    auto quantize = [](float x, float y) {
+        return QuantizedPosition{SnapshotManager::quantize(x), SnapshotManager::quantize(y)};
+    };
+
+    for (const Player &player : getAlivePlayers()) {
+        int playerID = player.getPlayerID();
+        if (playerID == -1) playerID = 0; // The server player has ID 0
+        snapshot.players.push_back({playerID, quantize(player.getX(), player.getY())});
     }
+    std::ranges::sort(snapshot.players, {}, &SnapshotPlayer::id);
 
-    nlohmann::json platforms2D = nlohmann::json::array();
-    for (const auto &platform : gamePtr->getLevel()->getMovingPlatforms2D()) {
-        nlohmann::json platformProperties;
-        platformProperties["x"] = platform.getX();
-        platformProperties["y"] = platform.getY();
-        platforms2D.push_back(platformProperties);
+    Level *level = gamePtr->getLevel();
+    for (const auto &platform : level->getMovingPlatforms1D()) snapshot.platforms1D.push_back(quantize(platform.getX(), platform.getY()));
+    for (const auto &platform : level->getMovingPlatforms2D()) snapshot.platforms2D.push_back(quantize(platform.getX(), platform.getY()));
+    for (const auto &crusher : level->getCrushers()) snapshot.crushers.push_back(quantize(crusher.getX(), crusher.getY()));
+
+    Mediator::networkManagerPtr->sendSyncCorrection(SimulationClock::getTick());
+}
+
+void Mediator::reconcilePrediction() {
+    PredictionManager &predictionManager = Mediator::networkManagerPtr->getPredictionManager();
+    AuthoritativeState state;
+    if (!predictionManager.takeAuthoritativeState(state)) return;
+
+    Player *playerPtr = gamePtr->getPlayerManager().findPlayerById(-1);
+    if (playerPtr == nullptr) return;
+
+    PredictionCorrection correction;
+    switch (predictionManager.reconcile(state, correction)) {
+        case Reconciliation::CORRECTED: {
+            // Only the error of the prediction of the acknowledged input is corrected
+            Buffer buffer = playerPtr->getBuffer();
+            playerPtr->setBuffer({buffer.deltaX + correction.deltaX, buffer.deltaY + correction.deltaY});
+            break;
+        }
+
+        case Reconciliation::WITHIN_TOLERANCE:
+            break;
+
+        case Reconciliation::NO_PREDICTION:
+            // Smooth the player to the server state (snapped beyond 40 pixels), the predictions no longer hold
+            playerPtr->setBuffer({state.x - playerPtr->getX(), state.y - playerPtr->getY()});
+            predictionManager.clearPredictions();
+            break;
     }
+}
 
-    nlohmann::json crushers = nlohmann::json::array();
-    for (const auto &crusher : gamePtr->getLevel()->getCrushers()) {
-        nlohmann::json crusherProperties;
-        crusherProperties["x"] = crusher.getX();
-        crusherProperties["y"] = crusher.getY();
-        crushers.push_back(crusherProperties);
+void Mediator::savePredictedPosition() {
+    Player const *playerPtr = gamePtr->getPlayerManager().findPlayerById(-1);
+    if (playerPtr == nullptr) return;
+
+    // The tick is the input sequence, the buffer not applied yet is part of the prediction
+    Buffer buffer = playerPtr->getBuffer();
+    Mediator::networkManagerPtr->getPredictionManager().record(static_cast<uint16_t>(SimulationClock::getTick()),
+                                                               playerPtr->getX() + buffer.deltaX, playerPtr->getY() + buffer.deltaY);
+}
+
+void Mediator::applyNetworkEvents() {
+    {
+        std::scoped_lock lock(networkEventsMutex);
+        std::swap(networkEvents, tickNetworkEvents);
     }
 
-    message["platforms1D"] = platforms1D;
-    message["platforms2D"] = platforms2D;
-    message["crushers"] = crushers;
-    Mediator::networkManagerPtr->sendSyncCorrection(message);
+    for (const std::function<void()> &event : tickNetworkEvents) event();
+    tickNetworkEvents.clear();
 }
 
 /** MENU METHODS **/
@@ -145,7 +189,7 @@ void Mediator::stop() {
 }
 
 void Mediator::save() {
-    gamePtr->getSaveManager().saveGameState();
+    gamePtr->save();
 }
 
 void Mediator::getGameProperties(nlohmann::json &properties) {
@@ -191,52 +235,62 @@ void Mediator::getGameProperties(nlohmann::json &properties) {
     properties["platforms1D"] = platforms1D;
     properties["platforms2D"] = platforms2D;
     properties["crushers"] = crushers;
+    properties["seed"] = gamePtr->getSeed();
+    properties["tickRate"] = SimulationClock::getTickRate();
     properties["camera"] = {
         {"x", gamePtr->getCamera()->getX()},
         {"y", gamePtr->getCamera()->getY()}
     };
 }
 
-std::vector<Player> const &Mediator::getAlivePlayers() {
+PlayerSlotMap::View Mediator::getAlivePlayers() {
     return gamePtr->getPlayerManager().getAlivePlayers();
 }
 
 
 /** OTHER METHODS **/
 
-int Mediator::handleClientConnect(int playerID) {
-    // Check if the player ID is not already taken by another character.
-    for (const auto &character : gamePtr->getPlayerManager().getAlivePlayers()) {
-        if (character.getPlayerID() == playerID) {
-            return -1; // ID already taken.
+void Mediator::handleClientConnect(int playerID) {
+    // The players are simulated by the simulation thread, the new player is added between two ticks
+    queueNetworkEvent([playerID] {
+        // Check if the player ID is not already taken by another character.
+        for (const auto &character : gamePtr->getPlayerManager().getAlivePlayers()) {
+            if (character.getPlayerID() == playerID) return; // ID already taken.
         }
-    }
-
-    // If the ID is valid and not taken, create a new character for the new player.
-    // Get the player's position id based on his position in the players list
 
-    size_t spawnIndex = gamePtr->getPlayerManager().getPlayerCount();
-    Level const *level = gamePtr->getLevel();
-    Point spawnPoint = level->getSpawnPoints(level->getLastCheckpoint())[spawnIndex];
-    Player newPlayer(playerID, spawnPoint, 2);
-    gamePtr->getPlayerManager().addPlayer(newPlayer);
+        // If the ID is valid and not taken, create a new character for the new player.
+        // Get the player's position id based on his position in the players list
+        size_t spawnIndex = gamePtr->getPlayerManager().getPlayerCount();
+        Level const *level = gamePtr->getLevel();
+        Point spawnPoint = level->getSpawnPoints(level->getLastCheckpoint())[spawnIndex];
+        Player newPlayer(playerID, spawnPoint, 2);
+        gamePtr->getPlayerManager().addPlayer(newPlayer);
+    });
 
     std::cout << "Mediator: Player " << playerID << " connected" << std::endl;
-    return 0;
 }
 
-int Mediator::handleClientDisconnect(int playerID) {
-    PlayerManager &playerManager = gamePtr->getPlayerManager();
+void Mediator::handleClientDisconnect(int playerID) {
+    networkManagerPtr->getSnapshotManager().removeClient(playerID);
+    networkManagerPtr->getPredictionManager().removeClient(playerID);
 
-    // Find the character with the given player ID and remove it from the game.
-    Player const *playerPtr = playerManager.findPlayerById(playerID);
-    if (playerPtr != nullptr) gamePtr->getPlayerManager().removePlayer(*playerPtr);
+    // Find the character with the given player ID and remove it from the game at the next tick
+    queueNetworkEvent([playerID] {
+        PlayerManager &playerManager = gamePtr->getPlayerManager();
+        Player const *playerPtr = playerManager.findPlayerById(playerID);
+        if (playerPtr != nullptr) playerManager.removePlayer(*playerPtr);
+    });
 
     std::cout << "Mediator: Player " << playerID << " disconnected" << std::endl;
-    return 0;
 }
 
-void Mediator::handleMessages(int protocol, const std::string &rawMessage, int playerID) {
+void Mediator::handleMessages(int protocol, std::string_view rawMessage, int playerID) {
+    // The gameplay messages are binary, only the game properties are still sent in JSON
+    if (WireProtocol::isBinary(rawMessage)) {
+        handleBinaryMessage(protocol, rawMessage, playerID);
+        return;
+    }
+
 #ifdef DEVELOPMENT_MODE
     std::cout << "Mediator: Received message: " << rawMessage << " from player " << playerID << std::endl;
 #endif
@@ -247,140 +301,15 @@ void Mediator::handleMessages(int protocol, const std::string &rawMessage, int p
         // Parse the received message as JSON
         json message = json::parse(rawMessage);
 
-        // If the application is a server, broadcast the message to all clients (except the sender) with the protocol used by the sender
-        if (networkManagerPtr->isServerRunning()) {
-            message["playerID"] = playerID;
-            Mediator::networkManagerPtr->broadcastMessage(protocol, message.dump(), playerID);
-        }
-
         // Check message type and handle it accordingly
         std::string messageType = message["messageType"];
 
-        if (messageType == "playerUpdate") {
-            // Get the player ID from the message if it exists, otherwise use the playerID parameter
-            int playerSocketID = (message.contains("playerID") ? (int)message["playerID"] : playerID);
-
-            // Decode the keyboard state mask
-            uint16_t keyboardStateMask = message["keyboardStateMask"];
-            std::array<int, SDL_NUM_SCANCODES> keyStates = {0};
-            decodeKeyboardStateMask(keyboardStateMask, keyStates);
-
-            // Find the player with the given player ID and handle the keyboard state only if the player is alive
-            Player *playerPtr = gamePtr->getPlayerManager().findPlayerById(playerSocketID);
-            if (playerPtr != nullptr) handleKeyboardState(playerPtr, keyStates);
-        }
-
-        else if (messageType == "syncCorrection") {
-            // For each player in "Players" array, update the player's position
-            json playersArray = message["players"];
-            for (const auto &player : playersArray) {
-                int playerSocketID = player["playerID"];
-                Player *playerPtr = gamePtr->getPlayerManager().findPlayerById(playerSocketID);
-                if (playerPtr == nullptr) {
-                    continue;
-                }
-
-                if (!player.contains("x") || !player.contains("y")) continue;
-                float playerX = player["x"];
-                float playerY = player["y"];
-
-                playerPtr->setBuffer({
-                    playerX - playerPtr->getX(),
-                    playerY - playerPtr->getY(),
-                });
-            }
-
-            // For each 1D platform in "Platforms1D" array, update the platform's position
-            json platforms1DArray = message["platforms1D"];
-            std::vector<MovingPlatform1D>& movingPlatforms1D = gamePtr->getLevel()->getMovingPlatforms1D();
-            for (const auto& platform : platforms1DArray) {
-                if (!platform.contains("x") || !platform.contains("y")) continue;
-                float platformX = platform["x"];
-                float platformY = platform["y"];
-
-                // Find the corresponding index in movingPlatforms1D
-                // Assuming platforms1DArray and movingPlatforms1D have the same size
-                size_t index = &platform - &platforms1DArray[0];
-                if (index < movingPlatforms1D.size()) {
-                    movingPlatforms1D[index].setBuffer({
-                       platformX - movingPlatforms1D[index].getX(),
-                       platformY - movingPlatforms1D[index].getY()
-                    });
-                }
-            }
-
-            // For each 2D platform in "Platforms2D" array, update the platform's position
-            json platforms2DArray = message["platforms2D"];
-            std::vector<MovingPlatform2D>& movingPlatforms2D = gamePtr->getLevel()->getMovingPlatforms2D();
-            for (const auto& platform : platforms2DArray) {
-                if (!platform.contains("x") || !platform.contains("y")) continue;
-                float platformX = platform["x"];
-                float platformY = platform["y"];
-
-                // Find the corresponding index in movingPlatforms2D
-                // Assuming platforms2DArray and movingPlatforms2D have the same size
-                size_t index = &platform - &platforms2DArray[0];
-                if (index < movingPlatforms2D.size()) {
-                    movingPlatforms2D[index].setBuffer({
-                       platformX - movingPlatforms2D[index].getX(),
-                       platformY - movingPlatforms2D[index].getY()
-                    });
-                }
-            }
-
-            // For each crusher in "Crushers" array, update the crusher's position
-            json crushersArray = message["crushers"];
-            std::vector<Crusher>& crushers = gamePtr->getLevel()->getCrushers();
-            for (const auto& crusher : crushersArray) {
-                if (!crusher.contains("x") || !crusher.contains("y")) continue;
-                float crusherX = crusher["x"];
-                float crusherY = crusher["y"];
-
-                // Find the corresponding index in crushers
-                // Assuming crushersArray and crushers have the same size
-                size_t index = &crusher - &crushersArray[0];
-                if (index < crushers.size()) {
-                    crushers[index].setBuffer({
-                       crusherX - crushers[index].getX(),
-                       crusherY - crushers[index].getY()
-                    });
-                }
-            }
-
-        }
-
-        else if (messageType == "playerConnect") {
-            int playerSocketID = message["playerID"];
-
-            // Get the player's spawn point based on his position in the players list
-            size_t spawnIndex = gamePtr->getPlayerManager().getPlayerCount();
-            Level const *level = gamePtr->getLevel();
-            Point spawnPoint = level->getSpawnPoints(level->getLastCheckpoint())[spawnIndex];
-
-            Player newPlayer(playerSocketID, spawnPoint, 2);
-            gamePtr->getPlayerManager().addPlayer(newPlayer);
-        }
-
-        else if (messageType == "playerDisconnect") {
-            int playerSocketID = message["playerID"];
-            PlayerManager &playerManager = gamePtr->getPlayerManager();
-
-            Player const *playerPtr = playerManager.findPlayerById(playerSocketID);
-            playerManager.removePlayer(*playerPtr);
-        }
-
-        else if (messageType == "gameProperties") {
+        if (messageType == "gameProperties") {
             // Load the texture of the map and initialize the game
-            messageQueuePtr->push("InitializeClientGame", {rawMessage});
+            messageQueuePtr->push("InitializeClientGame", {std::string(rawMessage)});
             menuPtr->setMenuAction(MenuAction::MAIN);
         }
 
-        else if (messageType == "asteroidCreation") {
-            // Create a new asteroid with the received properties
-            Asteroid asteroid(message["x"], message["y"], message["speed"], message["h"], message["w"], message["angle"]);
-            gamePtr->getLevel()->addAsteroid(asteroid);
-        }
-
         else {
             std::cerr << "Mediator: Unknown message type: " << messageType << std::endl;
         }
@@ -439,3 +368,161 @@ void Mediator::handleKeyboardState(Player *player, std::array<int, SDL_NUM_SCANC
         }
     }
 }
+
+void Mediator::queueNetworkEvent(std::function<void()> event) {
+    std::scoped_lock lock(networkEventsMutex);
+    networkEvents.push_back(std::move(event));
+}
+
+void Mediator::clearNetworkEvents() {
+    std::scoped_lock lock(networkEventsMutex);
+    networkEvents.clear();
+}
+
+void Mediator::handleBinaryMessage(int protocol, std::string_view rawMessage, int playerID) {
+    WireReader reader(rawMessage);
+    MessageID messageID;
+    if (!reader.readHeader(messageID)) {
+        std::cerr << "Mediator: Invalid binary message (" << rawMessage.size() << " bytes) from player " << playerID << std::endl;
+        return;
+    }
+
+#ifdef DEVELOPMENT_MODE
+    std::cout << "Mediator: Received message: " << WireProtocol::getLayout(messageID).name << " (" << rawMessage.size() << " bytes) from player " << playerID << std::endl;
+#endif
+
+    switch (messageID) {
+        case MessageID::PLAYER_UPDATE: {
+            int playerSocketID = reader.readI32();
+            uint16_t inputSequence = reader.readU16();
+            uint16_t tickRate = reader.readU16();
+            uint16_t keyboardStateMask = reader.readU16();
+
+            // If the application is a server, relay the message to all clients (except the sender) with the ID of the sender
+            if (networkManagerPtr->isServerRunning()) {
+                playerSocketID = playerID;
+
+                // The input is applied from the next tick, the sync corrections acknowledge it to the sender
+                networkManagerPtr->getPredictionManager().receiveInput(playerID, inputSequence, tickRate, SimulationClock::getTick());
+
+                std::array<char, WireProtocol::getSize(MessageID::PLAYER_UPDATE)> buffer;
+                WireWriter writer(buffer);
+                writer.writeHeader(MessageID::PLAYER_UPDATE);
+                writer.writeI32(playerSocketID);
+                writer.writeU16(inputSequence);
+                writer.writeU16(tickRate);
+                writer.writeU16(keyboardStateMask);
+                Mediator::networkManagerPtr->broadcastMessage(protocol, writer.getMessage(), playerID);
+            }
+
+            queueNetworkEvent([playerSocketID, keyboardStateMask] {
+                // Decode the keyboard state mask
+                std::array<int, SDL_NUM_SCANCODES> keyStates = {0};
+                decodeKeyboardStateMask(keyboardStateMask, keyStates);
+
+                // Find the player with the given player ID and handle the keyboard state only if the player is alive
+                Player *playerPtr = gamePtr->getPlayerManager().findPlayerById(playerSocketID);
+                if (playerPtr != nullptr) handleKeyboardState(playerPtr, keyStates);
+            });
+            break;
+        }
+
+        case MessageID::SYNC_CORRECTION: {
+            uint16_t sequence = reader.readU16();
+            uint16_t baseline = reader.readU16();
+            bool hasBaseline = reader.readU8() != 0;
+            int clientID = reader.readI32();
+            uint16_t processedInput = reader.readU16();
+            bool hasProcessedInput = reader.readU8() != 0;
+
+            // Rebuild the snapshot from the baseline, then acknowledge it so the next delta starts from it
+            SnapshotManager &snapshotManager = networkManagerPtr->getSnapshotManager();
+            const Snapshot *snapshot = snapshotManager.decode(reader, sequence, hasBaseline ? baseline : SnapshotManager::NO_BASELINE);
+            if (snapshot == nullptr) break;
+            networkManagerPtr->sendSnapshotAck(sequence);
+
+            // The snapshot is copied, the next sync correction can overwrite it before the next tick
+            int32_t authoritativeInput = hasProcessedInput ? processedInput : PredictionManager::NO_INPUT;
+            queueNetworkEvent([correction = *snapshot, clientID, authoritativeInput] {
+                // Update the position of each player
+                for (const SnapshotPlayer &player : correction.players) {
+                    int playerSocketID = player.id == clientID ? -1 : player.id; // The client itself has ID -1
+                    Player *playerPtr = gamePtr->getPlayerManager().findPlayerById(playerSocketID);
+                    if (playerPtr == nullptr) continue;
+
+                    float x = SnapshotManager::dequantize(player.position.x);
+                    float y = SnapshotManager::dequantize(player.position.y);
+
+                    // The local player is predicted, it is reconciled once the network events are applied
+                    if (playerSocketID == -1) {
+                        networkManagerPtr->getPredictionManager().receiveAuthoritativeState({authoritativeInput, x, y});
+                        continue;
+                    }
+
+                    playerPtr->setBuffer({x - playerPtr->getX(), y - playerPtr->getY()});
+                }
+
+                // Update the position of each platform and crusher (same order as the level of the server)
+                auto correct = [](auto &objects, const std::vector<QuantizedPosition> &positions) {
+                    for (size_t i = 0; i < std::min(objects.size(), positions.size()); i++) {
+                        objects[i].setBuffer({
+                            SnapshotManager::dequantize(positions[i].x) - objects[i].getX(),
+                            SnapshotManager::dequantize(positions[i].y) - objects[i].getY()
+                        });
+                    }
+                };
+                correct(gamePtr->getLevel()->getMovingPlatforms1D(), correction.platforms1D);
+                correct(gamePtr->getLevel()->getMovingPlatforms2D(), correction.platforms2D);
+                correct(gamePtr->getLevel()->getCrushers(), correction.crushers);
+            });
+            break;
+        }
+
+        case MessageID::ASTEROID_CREATION: {
+            // Create a new asteroid with the received properties
+            float x = reader.readF32();
+            float y = reader.readF32();
+            float speed = reader.readF32();
+            float h = reader.readF32();
+            float w = reader.readF32();
+            float angle = reader.readF32();
+
+            Asteroid asteroid(x, y, speed, h, w, angle);
+            queueNetworkEvent([asteroid] { gamePtr->getLevel()->addAsteroid(asteroid); });
+            break;
+        }
+
+        case MessageID::PLAYER_CONNECT: {
+            int playerSocketID = reader.readI32();
+
+            queueNetworkEvent([playerSocketID] {
+                // Get the player's spawn point based on his position in the players list
+                size_t spawnIndex = gamePtr->getPlayerManager().getPlayerCount();
+                Level const *level = gamePtr->getLevel();
+                Point spawnPoint = level->getSpawnPoints(level->getLastCheckpoint())[spawnIndex];
+
+                Player newPlayer(playerSocketID, spawnPoint, 2);
+                gamePtr->getPlayerManager().addPlayer(newPlayer);
+            });
+            break;
+        }
+
+        case MessageID::PLAYER_DISCONNECT: {
+            int playerSocketID = reader.readI32();
+
+            queueNetworkEvent([playerSocketID] {
+                PlayerManager &playerManager = gamePtr->getPlayerManager();
+                Player const *playerPtr = playerManager.findPlayerById(playerSocketID);
+                if (playerPtr != nullptr) playerManager.removePlayer(*playerPtr);
+            });
+            break;
+        }
+
+        case MessageID::SNAPSHOT_ACK: {
+            // The acknowledged snapshot becomes the baseline of the next sync corrections of the client
+            uint16_t sequence = reader.readU16();
+            if (networkManagerPtr->isServerRunning()) networkManagerPtr->getSnapshotManager().acknowledge(playerID, sequence);
+            break;
+        }
+    }
+}
@@ -0,0 +1,49 @@
+#include "../../include/Utils/SimulationClock.h"
+
+/**
+ * @file SimulationClock.cpp
+ * @brief Implements the SimulationClock class used to time the gameplay.
+ */
+
+// Define the static member variables
+std::atomic<uint64_t> SimulationClock::tick = 0;
+uint64_t SimulationClock::tickRate = SIMULATION_TICK_RATE;
+
+
+/* ACCESSORS */
+
+uint64_t SimulationClock::getTick() {
+    return tick.load(std::memory_order_relaxed);
+}
+
+Uint32 SimulationClock::getTicks() {
+    // Integer division, so every peer gets the same milliseconds for the same tick
+    return static_cast<Uint32>(getTick() * 1000 / tickRate);
+}
+
+uint64_t SimulationClock::getTickRate() {
+    return tickRate;
+}
+
+double SimulationClock::getStepSeconds() {
+    return 1.0 / static_cast<double>(tickRate);
+}
+
+
+/* MODIFIERS */
+
+void SimulationClock::setTick(uint64_t value) {
+    tick.store(value, std::memory_order_relaxed);
+}
+
+void SimulationClock::setTickRate(uint64_t rate) {
+    if (rate == 0) return;
+    tickRate = rate;
+}
+
+
+/* METHODS */
+
+void SimulationClock::advance() {
+    tick.fetch_add(1, std::memory_order_relaxed);
+}
@@ -0,0 +1,51 @@
+#include "../../include/Utils/TaskGraph.h"
+
+/**
+ * @file TaskGraph.cpp
+ * @brief Implements the TaskGraph class describing the stages of a frame and their dependencies.
+ */
+
+
+/* ACCESSORS */
+
+size_t TaskGraph::getStageCount() const {
+    return stages.size();
+}
+
+const std::string &TaskGraph::getStageName(size_t stage) const {
+    return stages[stage].name;
+}
+
+double TaskGraph::getStageMilliseconds(size_t stage) const {
+    return runs == 0 ? 0 : stages[stage].totalMilliseconds / static_cast<double>(runs);
+}
+
+double TaskGraph::getMilliseconds() const {
+    return runs == 0 ? 0 : totalMilliseconds / static_cast<double>(runs);
+}
+
+uint64_t TaskGraph::getRunCount() const {
+    return runs;
+}
+
+
+/* METHODS */
+
+size_t TaskGraph::addStage(std::string name, std::function<void()> function, std::initializer_list<size_t> dependencies) {
+    size_t index = stages.size();
+
+    Stage &stage = stages.emplace_back();
+    stage.name = std::move(name);
+    stage.function = std::move(function);
+    stage.dependencies = dependencies.size();
+
+    for (size_t dependency: dependencies) stages[dependency].successors.push_back(index);
+
+    return index;
+}
+
+void TaskGraph::resetTimings() {
+    for (Stage &stage: stages) stage.totalMilliseconds = 0;
+    totalMilliseconds = 0;
+    runs = 0;
+}